@@ -0,0 +1,57 @@
+#ifndef BENCH_STATISTICS_H__
+#define BENCH_STATISTICS_H__
+
+#include <vector>
+
+/**
+ * Robust statistics of repeated timings for bench_compare, which are not thrown off by the
+ * occasional slow repetition of a laptop that is doing something else.
+ */
+
+/**
+ * @return The median of the samples, 0 if there are none
+ */
+double median(std::vector<double> samples);
+
+/**
+ * @return The median absolute deviation from the median of the samples, 0 if there are none
+ */
+double medianAbsoluteDeviation(const std::vector<double>& samples);
+
+enum class Verdict { Unchanged, Improved, Regressed };
+
+struct Comparison {
+    double BaselineMedian;
+    double CurrentMedian;
+
+    /**
+     * (CurrentMedian - BaselineMedian) / BaselineMedian
+     */
+    double Change;
+
+    /**
+     * Standard error of the difference of the medians. The standard deviation of each sample
+     * set is estimated as 1.4826 * MAD, and the standard error of its median of n samples as
+     * 1.2533 * sigma / sqrt(n), so Noise = 1.2533 * 1.4826 * sqrt(MAD_b^2 / n_b + MAD_c^2 / n_c).
+     */
+    double Noise;
+
+    Verdict Result;
+};
+
+/**
+ * Compares the timings of one case. The medians differ significantly if the difference is
+ * larger than noiseFactor times the noise and larger than threshold times the baseline median,
+ * so that neither a noisy case nor a tiny but stable change is reported.
+ *
+ * @param baseline      Timings of the baseline, smaller is better.
+ * @param current       Timings of the current build.
+ * @param threshold     Smallest relative change that is reported, e.g. 0.05.
+ * @param noiseFactor   Smallest change that is reported in units of the noise, e.g. 3.
+ */
+Comparison compareSamples(const std::vector<double>& baseline,
+                          const std::vector<double>& current,
+                          double threshold,
+                          double noiseFactor);
+
+#endif  // BENCH_STATISTICS_H__
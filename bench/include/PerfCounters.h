@@ -0,0 +1,109 @@
+#ifndef BENCH_PERF_COUNTERS_H__
+#define BENCH_PERF_COUNTERS_H__
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * Hardware performance counters of the benchmarking thread, read with perf_event_open:
+ * cycles, instructions, L1D read misses and branch misses of user space code.
+ *
+ * The counters are opened as one group on first use, so they count the same instructions.
+ * If the kernel does not allow counter access, e.g. for perf_event_paranoid above 2 or in a
+ * container without the perf_event_open system call, or an event is not supported by the CPU,
+ * the affected counters are not reported and the benchmarks run as before. The reason is
+ * printed once to stderr.
+ */
+class PerfCounters {
+public:
+    struct Values {
+        uint64_t Cycles;
+        uint64_t Instructions;
+        uint64_t L1DMisses;
+        uint64_t BranchMisses;
+
+        /**
+         * Which of the members above were counted, a bit per member in declaration order
+         */
+        unsigned Valid;
+    };
+
+    static constexpr unsigned CyclesValid = 1U << 0;
+    static constexpr unsigned InstructionsValid = 1U << 1;
+    static constexpr unsigned L1DMissesValid = 1U << 2;
+    static constexpr unsigned BranchMissesValid = 1U << 3;
+
+    /**
+     * The counters of the calling thread. Benchmarks run on the thread of main unless they use
+     * Threads(), which these benchmarks do not.
+     */
+    static PerfCounters& instance();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+    ~PerfCounters();
+
+    /**
+     * @return true if at least the cycles are counted
+     */
+    bool available() const;
+
+    /**
+     * Resets and enables the counters
+     */
+    void start();
+
+    /**
+     * Disables the counters and reads them, scaled if the kernel multiplexed the group
+     */
+    Values stop();
+
+private:
+    PerfCounters();
+
+    int openEvent(uint32_t type, uint64_t config, const char* name);
+
+    static constexpr size_t maxEvents = 4;
+
+    int leader_;
+    int events_[maxEvents];
+    unsigned valid_[maxEvents];
+    size_t eventCount_;
+    std::string unavailable_;
+};
+
+/**
+ * Counts the benchmark loop of the scope with PerfCounters and adds the counters to the result
+ * of the benchmark when the scope ends:
+ * - cycles/byte, L1D-misses/KB and branch-misses/KB when the iterations process bytes
+ * - cycles/op, L1D-misses/op and branch-misses/op otherwise
+ * - IPC, instructions per cycle
+ *
+ *   void benchmarkCalculate(benchmark::State& state) {
+ *       PerfCountersScope counters(state, length);
+ *       for (auto _ : state) {
+ *           ...
+ *       }
+ *   }
+ */
+class PerfCountersScope {
+public:
+    /**
+     * @param state                 The benchmark to add the counters to.
+     * @param bytesPerIteration     Bytes processed by one iteration, 0 for per operation counters.
+     */
+    PerfCountersScope(benchmark::State& state, size_t bytesPerIteration);
+
+    PerfCountersScope(const PerfCountersScope&) = delete;
+    PerfCountersScope& operator=(const PerfCountersScope&) = delete;
+    ~PerfCountersScope();
+
+private:
+    benchmark::State& state_;
+    size_t bytesPerIteration_;
+};
+
+#endif  // BENCH_PERF_COUNTERS_H__
@@ -0,0 +1,79 @@
+#include "BenchStatistics.h"
+
+#include <algorithm>
+#include <cmath>
+
+double median(std::vector<double> samples) {
+    if (samples.empty()) {
+        return 0;
+    }
+
+    const size_t middle = samples.size() / 2;
+    std::nth_element(samples.begin(), samples.begin() + middle, samples.end());
+    const double upper = samples[middle];
+
+    if ((samples.size() % 2) != 0) {
+        return upper;
+    }
+
+    const double lower = *std::max_element(samples.begin(), samples.begin() + middle);
+    return (lower + upper) / 2;
+}
+
+double medianAbsoluteDeviation(const std::vector<double>& samples) {
+    const double center = median(samples);
+    std::vector<double> deviations;
+
+    deviations.reserve(samples.size());
+    for (const double sample : samples) {
+        deviations.push_back(std::fabs(sample - center));
+    }
+
+    return median(deviations);
+}
+
+namespace {
+    /**
+     * Standard error of the median of normally distributed samples, estimated from their MAD
+     */
+    double medianStandardError(const std::vector<double>& samples) {
+        /* Scales a MAD to the standard deviation of the samples */
+        const double madToSigma = 1.4826;
+        /* sqrt(pi / 2), the standard error of the median relative to that of the mean */
+        const double medianEfficiency = 1.2533;
+
+        if (samples.empty()) {
+            return 0;
+        }
+
+        return medianEfficiency * madToSigma * medianAbsoluteDeviation(samples) /
+               std::sqrt(static_cast<double>(samples.size()));
+    }
+}
+
+Comparison compareSamples(const std::vector<double>& baseline,
+                          const std::vector<double>& current,
+                          double threshold,
+                          double noiseFactor) {
+    const double baselineError = medianStandardError(baseline);
+    const double currentError = medianStandardError(current);
+
+    Comparison comparison;
+    comparison.BaselineMedian = median(baseline);
+    comparison.CurrentMedian = median(current);
+    comparison.Change = (comparison.BaselineMedian > 0)
+                            ? (comparison.CurrentMedian - comparison.BaselineMedian) / comparison.BaselineMedian
+                            : 0;
+    comparison.Noise = std::sqrt(baselineError * baselineError + currentError * currentError);
+    comparison.Result = Verdict::Unchanged;
+
+    const double difference = comparison.CurrentMedian - comparison.BaselineMedian;
+    const bool significant = (std::fabs(difference) > noiseFactor * comparison.Noise) &&
+                             (std::fabs(comparison.Change) > threshold);
+
+    if (significant) {
+        comparison.Result = (difference > 0) ? Verdict::Regressed : Verdict::Improved;
+    }
+
+    return comparison;
+}
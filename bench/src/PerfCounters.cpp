@@ -0,0 +1,189 @@
+#include "PerfCounters.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+PerfCounters& PerfCounters::instance() {
+    static thread_local PerfCounters counters;
+    return counters;
+}
+
+#ifdef __linux__
+
+PerfCounters::PerfCounters() : leader_(-1), events_(), valid_(), eventCount_(0) {
+    const uint64_t l1dReadMiss = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                 (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+    leader_ = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, "cycles");
+    if (leader_ < 0) {
+        std::fprintf(stderr, "perf counters not reported: %s\n", unavailable_.c_str());
+        return;
+    }
+    valid_[eventCount_] = CyclesValid;
+    events_[eventCount_++] = leader_;
+
+    const struct {
+        uint32_t type;
+        uint64_t config;
+        const char* name;
+        unsigned valid;
+    } siblings[] = {
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, "instructions", InstructionsValid},
+        {PERF_TYPE_HW_CACHE, l1dReadMiss, "L1D read misses", L1DMissesValid},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, "branch misses", BranchMissesValid},
+    };
+
+    for (const auto& sibling : siblings) {
+        const int event = openEvent(sibling.type, sibling.config, sibling.name);
+        if (event >= 0) {
+            valid_[eventCount_] = sibling.valid;
+            events_[eventCount_++] = event;
+        }
+    }
+
+    if (!unavailable_.empty()) {
+        std::fprintf(stderr, "perf counters partly reported: %s\n", unavailable_.c_str());
+    }
+}
+
+PerfCounters::~PerfCounters() {
+    for (size_t index = 0; index < eventCount_; ++index) {
+        close(events_[index]);
+    }
+}
+
+int PerfCounters::openEvent(uint32_t type, uint64_t config, const char* name) {
+    struct perf_event_attr attr;
+
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = (leader_ < 0) ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    const long event = syscall(__NR_perf_event_open, &attr, 0, -1, leader_, 0);
+    if (event < 0) {
+        unavailable_ += unavailable_.empty() ? "" : ", ";
+        unavailable_ += std::string(name) + ": " + std::strerror(errno);
+        if ((errno == EACCES) || (errno == EPERM)) {
+            unavailable_ += " (see /proc/sys/kernel/perf_event_paranoid)";
+        }
+    }
+    return static_cast<int>(event);
+}
+
+void PerfCounters::start() {
+    if (leader_ >= 0) {
+        ioctl(leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+}
+
+PerfCounters::Values PerfCounters::stop() {
+    Values values = {0, 0, 0, 0, 0};
+
+    if (leader_ < 0) {
+        return values;
+    }
+
+    ioctl(leader_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    /* nr, time enabled, time running and a value per event */
+    uint64_t buffer[3 + maxEvents];
+    const ssize_t length = read(leader_, buffer, sizeof(buffer));
+    if ((length < static_cast<ssize_t>(3 * sizeof(uint64_t))) || (buffer[0] != eventCount_) || (buffer[2] == 0)) {
+        return values;
+    }
+
+    const double scale = static_cast<double>(buffer[1]) / static_cast<double>(buffer[2]);
+    for (size_t index = 0; index < eventCount_; ++index) {
+        const uint64_t value = static_cast<uint64_t>(static_cast<double>(buffer[3 + index]) * scale);
+
+        switch (valid_[index]) {
+            case CyclesValid:
+                values.Cycles = value;
+                break;
+            case InstructionsValid:
+                values.Instructions = value;
+                break;
+            case L1DMissesValid:
+                values.L1DMisses = value;
+                break;
+            default:
+                values.BranchMisses = value;
+                break;
+        }
+        values.Valid |= valid_[index];
+    }
+
+    return values;
+}
+
+#else
+
+PerfCounters::PerfCounters() : leader_(-1), events_(), valid_(), eventCount_(0) {
+    std::fprintf(stderr, "perf counters not reported: perf_event_open requires Linux\n");
+}
+
+PerfCounters::~PerfCounters() {}
+
+int PerfCounters::openEvent(uint32_t, uint64_t, const char*) {
+    return -1;
+}
+
+void PerfCounters::start() {}
+
+PerfCounters::Values PerfCounters::stop() {
+    return Values{0, 0, 0, 0, 0};
+}
+
+#endif
+
+bool PerfCounters::available() const {
+    return leader_ >= 0;
+}
+
+PerfCountersScope::PerfCountersScope(benchmark::State& state, size_t bytesPerIteration)
+    : state_(state), bytesPerIteration_(bytesPerIteration) {
+    PerfCounters::instance().start();
+}
+
+PerfCountersScope::~PerfCountersScope() {
+    const PerfCounters::Values values = PerfCounters::instance().stop();
+    const double iterations = static_cast<double>(state_.iterations());
+
+    if (((values.Valid & PerfCounters::CyclesValid) == 0) || (iterations == 0)) {
+        return;
+    }
+
+    const double bytes = iterations * static_cast<double>(bytesPerIteration_);
+    const bool perByte = bytesPerIteration_ > 0;
+    const double units = perByte ? bytes : iterations;
+    const double missUnits = perByte ? (bytes / 1024) : iterations;
+    const char* const unit = perByte ? "byte" : "op";
+    const char* const missUnit = perByte ? "KB" : "op";
+
+    state_.counters[std::string("cycles/") + unit] = static_cast<double>(values.Cycles) / units;
+
+    if (((values.Valid & PerfCounters::InstructionsValid) != 0) && (values.Cycles != 0)) {
+        state_.counters["IPC"] = static_cast<double>(values.Instructions) / static_cast<double>(values.Cycles);
+    }
+    if ((values.Valid & PerfCounters::L1DMissesValid) != 0) {
+        state_.counters[std::string("L1D-misses/") + missUnit] = static_cast<double>(values.L1DMisses) / missUnits;
+    }
+    if ((values.Valid & PerfCounters::BranchMissesValid) != 0) {
+        state_.counters[std::string("branch-misses/") + missUnit] =
+            static_cast<double>(values.BranchMisses) / missUnits;
+    }
+}
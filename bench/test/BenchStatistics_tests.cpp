@@ -0,0 +1,94 @@
+#include "BenchStatistics.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+/**
+ * These tests cover the statistics of bench_compare:
+ * - median and median absolute deviation of odd, even and empty sample sets
+ * - the verdicts of compareSamples for changes above and below the threshold and the noise
+ * - the noise as the standard error of the medians, which shrinks with the number of samples
+ */
+
+TEST(BenchStatisticsTests, median) {
+    EXPECT_DOUBLE_EQ(median({}), 0);
+    EXPECT_DOUBLE_EQ(median({7}), 7);
+    EXPECT_DOUBLE_EQ(median({5, 1, 3}), 3);
+    EXPECT_DOUBLE_EQ(median({4, 1, 3, 2}), 2.5);
+    EXPECT_DOUBLE_EQ(median({2, 2, 100, 2}), 2);
+}
+
+TEST(BenchStatisticsTests, medianAbsoluteDeviation) {
+    EXPECT_DOUBLE_EQ(medianAbsoluteDeviation({}), 0);
+    EXPECT_DOUBLE_EQ(medianAbsoluteDeviation({3, 3, 3}), 0);
+    EXPECT_DOUBLE_EQ(medianAbsoluteDeviation({1, 1, 2, 2, 4, 6, 9}), 1);
+    EXPECT_DOUBLE_EQ(medianAbsoluteDeviation({10, 11, 9, 10, 1000}), 1);
+}
+
+TEST(BenchStatisticsTests, compareSamples_unchanged) {
+    const std::vector<double> samples = {100, 101, 99, 100, 102, 98, 100};
+    const Comparison comparison = compareSamples(samples, samples, 0.05, 3);
+
+    EXPECT_DOUBLE_EQ(comparison.BaselineMedian, 100);
+    EXPECT_DOUBLE_EQ(comparison.CurrentMedian, 100);
+    EXPECT_DOUBLE_EQ(comparison.Change, 0);
+    EXPECT_DOUBLE_EQ(comparison.Noise, 1.2533 * 1.4826 * std::sqrt(2.0 / 7));
+    EXPECT_EQ(comparison.Result, Verdict::Unchanged);
+}
+
+TEST(BenchStatisticsTests, compareSamples_regressed) {
+    const std::vector<double> baseline = {100, 101, 99, 100, 102, 98, 100};
+    const std::vector<double> current = {120, 121, 119, 120, 122, 118, 500};
+    const Comparison comparison = compareSamples(baseline, current, 0.05, 3);
+
+    EXPECT_DOUBLE_EQ(comparison.Change, 0.2);
+    EXPECT_EQ(comparison.Result, Verdict::Regressed);
+}
+
+TEST(BenchStatisticsTests, compareSamples_improved) {
+    const std::vector<double> baseline = {100, 101, 99, 100, 102, 98, 100};
+    const std::vector<double> current = {80, 81, 79, 80, 82, 78, 80};
+
+    EXPECT_EQ(compareSamples(baseline, current, 0.05, 3).Result, Verdict::Improved);
+}
+
+TEST(BenchStatisticsTests, compareSamples_noise_shrinks_with_samples) {
+    std::vector<double> baseline;
+    std::vector<double> current;
+
+    for (int sample = 0; sample < 50; ++sample) {
+        baseline.insert(baseline.end(), {98, 102});
+        current.insert(current.end(), {106, 110});
+    }
+
+    /*
+     * MAD 2 in both sets. The standard deviation of single samples, 1.4826 * 2 * sqrt(2) = 4.19,
+     * would hide the 8 ns change at 3 times the noise, the standard error of the medians of 100
+     * samples does not.
+     */
+    const Comparison comparison = compareSamples(baseline, current, 0.05, 3);
+
+    EXPECT_DOUBLE_EQ(comparison.Change, 0.08);
+    EXPECT_DOUBLE_EQ(comparison.Noise, 1.2533 * 1.4826 * 2 * std::sqrt(2.0 / 100));
+    EXPECT_EQ(comparison.Result, Verdict::Regressed);
+}
+
+TEST(BenchStatisticsTests, compareSamples_within_noise) {
+    const std::vector<double> baseline = {100, 120, 80, 100, 130, 70, 100};
+    const std::vector<double> current = {110, 130, 90, 110, 140, 80, 110};
+    const Comparison comparison = compareSamples(baseline, current, 0.05, 3);
+
+    EXPECT_DOUBLE_EQ(comparison.Change, 0.1);
+    EXPECT_EQ(comparison.Result, Verdict::Unchanged);
+}
+
+TEST(BenchStatisticsTests, compareSamples_below_threshold) {
+    const std::vector<double> baseline = {100, 100, 100, 100, 100};
+    const std::vector<double> current = {103, 103, 103, 103, 103};
+    const Comparison comparison = compareSamples(baseline, current, 0.05, 3);
+
+    EXPECT_DOUBLE_EQ(comparison.Noise, 0);
+    EXPECT_EQ(comparison.Result, Verdict::Unchanged);
+    EXPECT_EQ(compareSamples(baseline, current, 0.02, 3).Result, Verdict::Regressed);
+}
@@ -0,0 +1,497 @@
+/**
+ * @file BenchCompare.cpp
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * Regression check of the CRC and e2e libraries, see bench/CMakeLists.txt.
+ *
+ * Usage: bench_compare record <name> [options]
+ *        bench_compare compare <name> [options]
+ *        bench_compare diff <baseline name> <current name> [options]
+ *
+ * record runs the timing suite and stores the results as the baseline
+ * <directory>/<name>.json. compare runs the suite and compares it with
+ * the baseline, and diff compares two stored results. The exit status is
+ * 1 if a case regressed significantly, see compareSamples in
+ * BenchStatistics.h, and 2 on errors.
+ *
+ * Options:
+ *   --dir=<directory>      Where results are stored, bench_baselines
+ *   --repetitions=<n>      Timings per case, 15
+ *   --min_time_ms=<ms>     Duration of one timing, 20
+ *   --threshold=<percent>  Smallest change that is reported, 5
+ *   --noise_factor=<k>     Smallest change that is reported in units of
+ *                          the noise, the standard error of the
+ *                          difference of the medians, 3
+ *   --save=<name>          compare also stores the run as <name>
+ *
+ * The suite times Crc_CalculateCRCxx of every algorithm and
+ * E2E_P01Protect, E2E_P01Check, E2E_P05Protect and E2E_P05Check at a few
+ * lengths, on top of the CRC implementation bench_compare was built with.
+ * The repetitions of all cases are interleaved, so a slow phase of the
+ * machine affects every case a little instead of one case a lot.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+extern "C" {
+    #include "Crc.h"
+    #include "E2E_P01.h"
+    #include "E2E_P05.h"
+}
+
+#include "BenchStatistics.h"
+#include "E2EBenchMessages.h"
+
+#include <sys/stat.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Options {
+        std::string directory = "bench_baselines";
+        size_t repetitions = 15;
+        double minTimeMs = 20;
+        double threshold = 5;
+        double noiseFactor = 3;
+        std::string save;
+    };
+
+    struct Results {
+        std::string crc;
+
+        /**
+         * Nanoseconds per call of each repetition, by case name in suite order
+         */
+        std::vector<std::pair<std::string, std::vector<double>>> cases;
+    };
+
+    struct Case {
+        std::string name;
+        std::function<void()> call;
+        size_t callsPerTiming;
+    };
+
+    volatile uint64_t sink;
+
+    // -------------------------------------------------------------------------------------------
+    // Timing suite
+    // -------------------------------------------------------------------------------------------
+
+    /**
+     * Owns the data of the cases
+     */
+    class Suite {
+    public:
+        Suite() : data_(4096) {
+            fillPayload(data_.data(), data_.size());
+
+            for (const size_t length : {8U, 64U, 4096U}) {
+                const std::string bytes = "/bytes:" + std::to_string(length);
+                const uint8_t* data = data_.data();
+                const uint32_t crcLength = static_cast<uint32_t>(length);
+
+                add("Crc_CalculateCRC8" + bytes, [=]() { sink = Crc_CalculateCRC8(data, crcLength, 0, true); });
+                add("Crc_CalculateCRC8H2F" + bytes, [=]() { sink = Crc_CalculateCRC8H2F(data, crcLength, 0, true); });
+                add("Crc_CalculateCRC16" + bytes, [=]() { sink = Crc_CalculateCRC16(data, crcLength, 0, true); });
+                add("Crc_CalculateCRC16ARC" + bytes, [=]() { sink = Crc_CalculateCRC16ARC(data, crcLength, 0, true); });
+                add("Crc_CalculateCRC32" + bytes, [=]() { sink = Crc_CalculateCRC32(data, crcLength, 0, true); });
+                add("Crc_CalculateCRC32P4" + bytes, [=]() { sink = Crc_CalculateCRC32P4(data, crcLength, 0, true); });
+                add("Crc_CalculateCRC64" + bytes, [=]() { sink = Crc_CalculateCRC64(data, crcLength, 0, true); });
+            }
+
+            addP01(8);
+            for (const size_t length : {8U, 64U, 512U}) {
+                addP05(length);
+            }
+        }
+
+        std::vector<Case>& cases() {
+            return cases_;
+        }
+
+    private:
+        struct P01Data {
+            E2E_P01ConfigType config;
+            std::vector<uint8_t> data;
+            E2E_P01ProtectStateType protectState;
+            MessageRing ring;
+            E2E_P01CheckStateType checkState;
+            size_t index;
+        };
+
+        struct P05Data {
+            E2E_P05ConfigType config;
+            std::vector<uint8_t> data;
+            E2E_P05ProtectStateType protectState;
+            MessageRing ring;
+            E2E_P05CheckStateType checkState;
+            size_t index;
+        };
+
+        void add(const std::string& name, std::function<void()> call) {
+            cases_.push_back({name, call, 0});
+        }
+
+        void addP01(size_t length) {
+            const E2E_P01ConfigType config = p01Config(E2E_P01_DATAID_BOTH, length, false);
+            p01Data_.emplace_back(new P01Data{config, std::vector<uint8_t>(length), {},
+                                               p01Messages(config, inputMixes[0]), {}, 0});
+            P01Data* p01 = p01Data_.back().get();
+            const std::string bytes = "/bytes:" + std::to_string(length);
+
+            fillPayload(p01->data.data(), p01->data.size());
+            E2E_P01ProtectInit(&p01->protectState);
+            E2E_P01CheckInit(&p01->checkState);
+
+            add("E2E_P01Protect" + bytes,
+                [p01]() { sink = E2E_P01Protect(&p01->config, &p01->protectState, p01->data.data()); });
+            add("E2E_P01Check" + bytes, [p01]() {
+                sink = E2E_P01Check(&p01->config, &p01->checkState, p01->ring.message(p01->index));
+                p01->index = (p01->index + 1U == p01->ring.count()) ? 0U : p01->index + 1U;
+            });
+        }
+
+        void addP05(size_t length) {
+            const E2E_P05ConfigType config = p05Config(length, false);
+            p05Data_.emplace_back(new P05Data{config, std::vector<uint8_t>(length), {},
+                                               p05Messages(config, inputMixes[0]), {}, 0});
+            P05Data* p05 = p05Data_.back().get();
+            const std::string bytes = "/bytes:" + std::to_string(length);
+            const uint16_t dataLength = static_cast<uint16_t>(length);
+
+            fillPayload(p05->data.data(), p05->data.size());
+            E2E_P05ProtectInit(&p05->protectState);
+            E2E_P05CheckInit(&p05->checkState);
+
+            add("E2E_P05Protect" + bytes, [p05, dataLength]() {
+                sink = E2E_P05Protect(&p05->config, &p05->protectState, p05->data.data(), dataLength);
+            });
+            add("E2E_P05Check" + bytes, [p05, dataLength]() {
+                sink = E2E_P05Check(&p05->config, &p05->checkState, p05->ring.message(p05->index), dataLength);
+                p05->index = (p05->index + 1U == p05->ring.count()) ? 0U : p05->index + 1U;
+            });
+        }
+
+        std::vector<uint8_t> data_;
+        std::vector<std::unique_ptr<P01Data>> p01Data_;
+        std::vector<std::unique_ptr<P05Data>> p05Data_;
+        std::vector<Case> cases_;
+    };
+
+    double timeCalls(const Case& testCase, size_t calls) {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t call = 0; call < calls; ++call) {
+            testCase.call();
+        }
+        const auto end = std::chrono::steady_clock::now();
+
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+
+    /**
+     * Doubles the calls until they take an eighth of the minimum time, then scales them up
+     */
+    size_t calibrate(const Case& testCase, double minTimeNs) {
+        size_t calls = 1;
+        double elapsed = timeCalls(testCase, calls);
+
+        while (elapsed < minTimeNs / 8) {
+            calls *= 2;
+            elapsed = timeCalls(testCase, calls);
+        }
+
+        return static_cast<size_t>(static_cast<double>(calls) * minTimeNs / elapsed) + 1U;
+    }
+
+    Results runSuite(const Options& options) {
+        Suite suite;
+        std::vector<Case>& cases = suite.cases();
+        const double minTimeNs = options.minTimeMs * 1e6;
+        Results results;
+
+        results.crc = BENCH_COMPARE_CRC;
+        for (Case& testCase : cases) {
+            testCase.callsPerTiming = calibrate(testCase, minTimeNs);
+            results.cases.push_back({testCase.name, {}});
+        }
+
+        for (size_t repetition = 0; repetition < options.repetitions; ++repetition) {
+            std::fprintf(stderr, "\rbench_compare: repetition %zu of %zu", repetition + 1U, options.repetitions);
+            for (size_t index = 0; index < cases.size(); ++index) {
+                const double elapsed = timeCalls(cases[index], cases[index].callsPerTiming);
+                results.cases[index].second.push_back(elapsed / static_cast<double>(cases[index].callsPerTiming));
+            }
+        }
+        std::fprintf(stderr, "\n");
+
+        return results;
+    }
+
+    // -------------------------------------------------------------------------------------------
+    // Result files
+    // -------------------------------------------------------------------------------------------
+
+    std::string resultPath(const Options& options, const std::string& name) {
+        return options.directory + "/" + name + ".json";
+    }
+
+    bool writeResults(const Options& options, const std::string& name, const Results& results) {
+        if ((mkdir(options.directory.c_str(), 0777) != 0) && (errno != EEXIST)) {
+            std::fprintf(stderr, "bench_compare: cannot create %s\n", options.directory.c_str());
+            return false;
+        }
+
+        const std::string path = resultPath(options, name);
+        std::ofstream file(path);
+        file.precision(6);
+        file << std::fixed;
+
+        file << "{\n  \"name\": \"" << name << "\",\n  \"crc\": \"" << results.crc << "\",\n  \"results\": [\n";
+        for (size_t index = 0; index < results.cases.size(); ++index) {
+            const std::vector<double>& samples = results.cases[index].second;
+
+            file << "    {\"name\": \"" << results.cases[index].first << "\", \"median_ns\": " << median(samples)
+                 << ", \"mad_ns\": " << medianAbsoluteDeviation(samples) << ", \"samples_ns\": [";
+            for (size_t sample = 0; sample < samples.size(); ++sample) {
+                file << ((sample == 0) ? "" : ", ") << samples[sample];
+            }
+            file << "]}" << ((index + 1U == results.cases.size()) ? "" : ",") << "\n";
+        }
+        file << "  ]\n}\n";
+
+        file.close();
+        if (!file) {
+            std::fprintf(stderr, "bench_compare: cannot write %s\n", path.c_str());
+            return false;
+        }
+
+        std::printf("bench_compare: results stored in %s\n", path.c_str());
+        return true;
+    }
+
+    /**
+     * @return The string value of the first "<key>": "<value>" at or after position, which is
+     *         moved past it
+     */
+    bool readString(const std::string& text, const char* key, size_t& position, std::string& value) {
+        const std::string pattern = std::string("\"") + key + "\": \"";
+        const size_t start = text.find(pattern, position);
+        if (start == std::string::npos) {
+            return false;
+        }
+
+        const size_t valueStart = start + pattern.size();
+        const size_t valueEnd = text.find('"', valueStart);
+        if (valueEnd == std::string::npos) {
+            return false;
+        }
+
+        value = text.substr(valueStart, valueEnd - valueStart);
+        position = valueEnd + 1U;
+        return true;
+    }
+
+    /**
+     * Reads the files written by writeResults, which is all this parser supports
+     */
+    bool readResults(const Options& options, const std::string& name, Results& results) {
+        const std::string path = resultPath(options, name);
+        std::ifstream file(path);
+        std::stringstream contents;
+
+        if (!file.is_open() || !(contents << file.rdbuf())) {
+            std::fprintf(stderr, "bench_compare: cannot read %s, record it with bench_compare record %s\n",
+                         path.c_str(), name.c_str());
+            return false;
+        }
+
+        const std::string text = contents.str();
+        size_t position = 0;
+        std::string caseName;
+
+        if (!readString(text, "crc", position, results.crc)) {
+            std::fprintf(stderr, "bench_compare: %s is not a bench_compare result\n", path.c_str());
+            return false;
+        }
+
+        while (readString(text, "name", position, caseName)) {
+            const std::string pattern = "\"samples_ns\": [";
+            const size_t samplesStart = text.find(pattern, position);
+            const size_t samplesEnd = text.find(']', samplesStart);
+            if ((samplesStart == std::string::npos) || (samplesEnd == std::string::npos)) {
+                std::fprintf(stderr, "bench_compare: %s has no samples for %s\n", path.c_str(), caseName.c_str());
+                return false;
+            }
+
+            std::vector<double> samples;
+            const char* sample = &text[samplesStart + pattern.size()];
+            const char* const end = &text[samplesEnd];
+            while (sample < end) {
+                char* next = nullptr;
+                samples.push_back(std::strtod(sample, &next));
+                sample = (*next == ',') ? next + 1 : end;
+            }
+
+            results.cases.push_back({caseName, samples});
+            position = samplesEnd;
+        }
+
+        return true;
+    }
+
+    // -------------------------------------------------------------------------------------------
+    // Comparison
+    // -------------------------------------------------------------------------------------------
+
+    /**
+     * @return true if no case regressed
+     */
+    bool compareResults(const Options& options, const Results& baseline, const Results& current) {
+        std::map<std::string, const std::vector<double>*> baselineCases;
+        size_t regressions = 0;
+
+        for (const auto& baselineCase : baseline.cases) {
+            baselineCases[baselineCase.first] = &baselineCase.second;
+        }
+
+        if (baseline.crc != current.crc) {
+            std::printf("Note: the baseline was measured with crc_%s, this run with crc_%s\n", baseline.crc.c_str(),
+                        current.crc.c_str());
+        }
+
+        std::printf("%-32s %12s %12s %9s %10s  %s\n", "Case", "Baseline ns", "Current ns", "Change", "Noise ns",
+                    "Verdict");
+        for (const auto& currentCase : current.cases) {
+            const auto found = baselineCases.find(currentCase.first);
+            if (found == baselineCases.end()) {
+                std::printf("%-32s %12s %12.2f %9s %10s  new\n", currentCase.first.c_str(), "-",
+                            median(currentCase.second), "-", "-");
+                continue;
+            }
+
+            const Comparison comparison = compareSamples(*found->second, currentCase.second, options.threshold / 100,
+                                                         options.noiseFactor);
+            const char* verdict = "";
+            if (comparison.Result == Verdict::Regressed) {
+                verdict = "REGRESSED";
+                ++regressions;
+            } else if (comparison.Result == Verdict::Improved) {
+                verdict = "improved";
+            }
+
+            std::printf("%-32s %12.2f %12.2f %+8.1f%% %10.2f  %s\n", currentCase.first.c_str(),
+                        comparison.BaselineMedian, comparison.CurrentMedian, comparison.Change * 100, comparison.Noise,
+                        verdict);
+            baselineCases.erase(found);
+        }
+
+        for (const auto& missing : baselineCases) {
+            std::printf("%-32s %12.2f %12s %9s %10s  missing\n", missing.first.c_str(), median(*missing.second), "-",
+                        "-", "-");
+        }
+
+        std::printf("%zu of %zu cases regressed by more than %.1f%% and %.1f times the noise\n", regressions,
+                    current.cases.size(), options.threshold, options.noiseFactor);
+        return regressions == 0;
+    }
+
+    bool parseNumber(const char* text, double& value) {
+        char* end = nullptr;
+        value = std::strtod(text, &end);
+        return (end != text) && (*end == '\0') && (value >= 0);
+    }
+
+    /**
+     * Moves the positional arguments to names
+     */
+    bool parseOptions(int argc, char** argv, Options& options, std::vector<std::string>& names) {
+        for (int index = 2; index < argc; ++index) {
+            const std::string argument = argv[index];
+            const size_t separator = argument.find('=');
+            const std::string name = argument.substr(0, separator);
+            const char* value = (separator == std::string::npos) ? "" : &argv[index][separator + 1];
+            double number = 0;
+
+            if (argument.compare(0, 2, "--") != 0) {
+                names.push_back(argument);
+            } else if ((name == "--dir") && (*value != '\0')) {
+                options.directory = value;
+            } else if ((name == "--save") && (*value != '\0')) {
+                options.save = value;
+            } else if (!parseNumber(value, number)) {
+                return false;
+            } else if ((name == "--repetitions") && (number >= 1)) {
+                options.repetitions = static_cast<size_t>(number);
+            } else if ((name == "--min_time_ms") && (number > 0)) {
+                options.minTimeMs = number;
+            } else if (name == "--threshold") {
+                options.threshold = number;
+            } else if (name == "--noise_factor") {
+                options.noiseFactor = number;
+            } else {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+    const int regressed = 1;
+    const int failed = 2;
+    const std::string command = (argc >= 2) ? argv[1] : "";
+    const size_t nameCount = (command == "diff") ? 2U : 1U;
+    Options options;
+    std::vector<std::string> names;
+
+    if (((command != "record") && (command != "compare") && (command != "diff")) ||
+        !parseOptions(argc, argv, options, names) || (names.size() != nameCount)) {
+        std::fprintf(stderr,
+                     "Usage: %s record <name> [options]\n"
+                     "       %s compare <name> [options]\n"
+                     "       %s diff <baseline name> <current name> [options]\n"
+                     "Options: --dir=<directory> --repetitions=<n> --min_time_ms=<ms> --threshold=<percent>\n"
+                     "         --noise_factor=<k> --save=<name>\n",
+                     argv[0], argv[0], argv[0]);
+        return failed;
+    }
+
+    Results baseline;
+    Results current;
+
+    if (command == "record") {
+        return writeResults(options, names[0], runSuite(options)) ? EXIT_SUCCESS : failed;
+    }
+
+    if (!readResults(options, names[0], baseline)) {
+        return failed;
+    }
+
+    if (command == "diff") {
+        if (!readResults(options, names[1], current)) {
+            return failed;
+        }
+    } else {
+        current = runSuite(options);
+        if (!options.save.empty() && !writeResults(options, options.save, current)) {
+            return failed;
+        }
+    }
+
+    return compareResults(options, baseline, current) ? EXIT_SUCCESS : regressed;
+}
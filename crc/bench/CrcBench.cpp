@@ -0,0 +1,104 @@
+extern "C" {
+    #include "Crc.h"
+}
+
+#include "CrcBenchImplementations.h"
+#include "PerfCounters.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+/**
+ * Benchmarks of the Crc_CalculateCRCxxLong kernel of every implementation in
+ * CrcBenchImplementations.h, named <algorithm>/<implementation>/bytes:<length>/offset:<offset>.
+ * Messages of 1 byte to 1 MiB start on a 64-byte cache line (offset 0) or one byte after it
+ * (offset 1). Time is per call and bytes_per_second is the message length over the time.
+ * Where the kernel allows it, the results also have cycles/byte, IPC and the L1D and branch
+ * misses per KB, see PerfCounters.h.
+ */
+
+#define CRC_BENCH_DECLARE(NAME) \
+    extern "C" uint8_t CrcBench_##NAME##_CalculateCRC8Long(const uint8_t*, size_t, uint8_t, bool); \
+    extern "C" uint8_t CrcBench_##NAME##_CalculateCRC8H2FLong(const uint8_t*, size_t, uint8_t, bool); \
+    extern "C" uint16_t CrcBench_##NAME##_CalculateCRC16Long(const uint8_t*, size_t, uint16_t, bool); \
+    extern "C" uint16_t CrcBench_##NAME##_CalculateCRC16ARCLong(const uint8_t*, size_t, uint16_t, bool); \
+    extern "C" uint32_t CrcBench_##NAME##_CalculateCRC32Long(const uint8_t*, size_t, uint32_t, bool); \
+    extern "C" uint32_t CrcBench_##NAME##_CalculateCRC32P4Long(const uint8_t*, size_t, uint32_t, bool); \
+    extern "C" uint64_t CrcBench_##NAME##_CalculateCRC64Long(const uint8_t*, size_t, uint64_t, bool);
+
+CRC_BENCH_IMPLEMENTATIONS(CRC_BENCH_DECLARE)
+
+namespace {
+    constexpr int64_t maxLength = 1 << 20;
+    constexpr size_t cacheLineLength = 64;
+
+    template <typename T>
+    using CalculateFunction = T (*)(const uint8_t*, size_t, T, bool);
+
+    /**
+     * Pseudo-random data of maxLength plus the largest offset, starting on a cache line
+     */
+    const uint8_t* messageData() {
+        static std::vector<uint8_t> storage;
+
+        if (storage.empty()) {
+            uint32_t state = 0x2545F491;
+
+            storage.resize(maxLength + 2 * cacheLineLength);
+            for (auto& byte : storage) {
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                byte = static_cast<uint8_t>(state);
+            }
+        }
+
+        const uintptr_t address = reinterpret_cast<uintptr_t>(storage.data());
+        return &storage[(cacheLineLength - (address % cacheLineLength)) % cacheLineLength];
+    }
+
+    template <typename T>
+    void benchmarkCalculate(benchmark::State& state, CalculateFunction<T> calculate) {
+        const size_t length = static_cast<size_t>(state.range(0));
+        const uint8_t* message = &messageData()[state.range(1)];
+        PerfCountersScope counters(state, length);
+
+        for (auto _ : state) {
+            T crc = calculate(message, length, 0, true);
+            benchmark::DoNotOptimize(crc);
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    }
+
+    template <typename T>
+    void registerCalculate(const std::string& algorithm, const char* implementation, CalculateFunction<T> calculate) {
+        benchmark::RegisterBenchmark((algorithm + "/" + implementation).c_str(), benchmarkCalculate<T>, calculate)
+            ->ArgNames({"bytes", "offset"})
+            ->ArgsProduct({benchmark::CreateRange(1, maxLength, 4), {0, 1}});
+    }
+}
+
+#define CRC_BENCH_REGISTER(NAME) \
+    registerCalculate<uint8_t>("CRC8", #NAME, CrcBench_##NAME##_CalculateCRC8Long); \
+    registerCalculate<uint8_t>("CRC8H2F", #NAME, CrcBench_##NAME##_CalculateCRC8H2FLong); \
+    registerCalculate<uint16_t>("CRC16", #NAME, CrcBench_##NAME##_CalculateCRC16Long); \
+    registerCalculate<uint16_t>("CRC16ARC", #NAME, CrcBench_##NAME##_CalculateCRC16ARCLong); \
+    registerCalculate<uint32_t>("CRC32", #NAME, CrcBench_##NAME##_CalculateCRC32Long); \
+    registerCalculate<uint32_t>("CRC32P4", #NAME, CrcBench_##NAME##_CalculateCRC32P4Long); \
+    registerCalculate<uint64_t>("CRC64", #NAME, CrcBench_##NAME##_CalculateCRC64Long);
+
+int main(int argc, char** argv) {
+    CRC_BENCH_IMPLEMENTATIONS(CRC_BENCH_REGISTER)
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
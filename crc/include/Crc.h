@@ -236,4 +236,984 @@ uint64_t Crc_CalculateCRC64(const uint8_t* Crc_DataPtr,
                             uint64_t Crc_StartValue64,
                             bool Crc_IsFirstCall);
 
+
+/*
+ * Lengths above 32 bits
+ *
+ * The AUTOSAR services above take a uint32_t length. The Long variants take a size_t
+ * length and process the whole range in one call with the fastest kernel of the library,
+ * so buffers of 4 GiB and more need neither a loop of chained calls nor the restart of
+ * the kernel that comes with each of them. Otherwise they behave exactly like the
+ * corresponding Crc_CalculateCRCxx, which every library implements as a wrapper of its
+ * Long variant.
+ */
+
+/**
+ * Crc_CalculateCRC8 with a size_t length.
+ *
+ * @param Crc_DataPtr        Pointer to start address of data block to be calculated.
+ * @param Crc_Length         Length of data block to be calculated in bytes.
+ * @param Crc_StartValue8    Start value, see Crc_CalculateCRC8.
+ * @param Crc_IsFirstCall    First call flag, see Crc_CalculateCRC8.
+ * @return uint8_t
+ */
+uint8_t Crc_CalculateCRC8Long(const uint8_t* Crc_DataPtr,
+                              size_t Crc_Length,
+                              uint8_t Crc_StartValue8,
+                              bool Crc_IsFirstCall);
+
+/**
+ * Crc_CalculateCRC8H2F with a size_t length.
+ *
+ * @param Crc_DataPtr           Pointer to start address of data block to be calculated.
+ * @param Crc_Length            Length of data block to be calculated in bytes.
+ * @param Crc_StartValue8H2F    Start value, see Crc_CalculateCRC8H2F.
+ * @param Crc_IsFirstCall       First call flag, see Crc_CalculateCRC8H2F.
+ * @return uint8_t
+ */
+uint8_t Crc_CalculateCRC8H2FLong(const uint8_t* Crc_DataPtr,
+                                 size_t Crc_Length,
+                                 uint8_t Crc_StartValue8H2F,
+                                 bool Crc_IsFirstCall);
+
+/**
+ * Crc_CalculateCRC16 with a size_t length.
+ *
+ * @param Crc_DataPtr         Pointer to start address of data block to be calculated.
+ * @param Crc_Length          Length of data block to be calculated in bytes.
+ * @param Crc_StartValue16    Start value, see Crc_CalculateCRC16.
+ * @param Crc_IsFirstCall     First call flag, see Crc_CalculateCRC16.
+ * @return uint16_t
+ */
+uint16_t Crc_CalculateCRC16Long(const uint8_t* Crc_DataPtr,
+                                size_t Crc_Length,
+                                uint16_t Crc_StartValue16,
+                                bool Crc_IsFirstCall);
+
+/**
+ * Crc_CalculateCRC16ARC with a size_t length.
+ *
+ * @param Crc_DataPtr         Pointer to start address of data block to be calculated.
+ * @param Crc_Length          Length of data block to be calculated in bytes.
+ * @param Crc_StartValue16    Start value, see Crc_CalculateCRC16ARC.
+ * @param Crc_IsFirstCall     First call flag, see Crc_CalculateCRC16ARC.
+ * @return uint16_t
+ */
+uint16_t Crc_CalculateCRC16ARCLong(const uint8_t* Crc_DataPtr,
+                                   size_t Crc_Length,
+                                   uint16_t Crc_StartValue16,
+                                   bool Crc_IsFirstCall);
+
+/**
+ * Crc_CalculateCRC32 with a size_t length.
+ *
+ * @param Crc_DataPtr         Pointer to start address of data block to be calculated.
+ * @param Crc_Length          Length of data block to be calculated in bytes.
+ * @param Crc_StartValue32    Start value, see Crc_CalculateCRC32.
+ * @param Crc_IsFirstCall     First call flag, see Crc_CalculateCRC32.
+ * @return uint32_t
+ */
+uint32_t Crc_CalculateCRC32Long(const uint8_t* Crc_DataPtr,
+                                size_t Crc_Length,
+                                uint32_t Crc_StartValue32,
+                                bool Crc_IsFirstCall);
+
+/**
+ * Crc_CalculateCRC32P4 with a size_t length.
+ *
+ * @param Crc_DataPtr         Pointer to start address of data block to be calculated.
+ * @param Crc_Length          Length of data block to be calculated in bytes.
+ * @param Crc_StartValue32    Start value, see Crc_CalculateCRC32P4.
+ * @param Crc_IsFirstCall     First call flag, see Crc_CalculateCRC32P4.
+ * @return uint32_t
+ */
+uint32_t Crc_CalculateCRC32P4Long(const uint8_t* Crc_DataPtr,
+                                  size_t Crc_Length,
+                                  uint32_t Crc_StartValue32,
+                                  bool Crc_IsFirstCall);
+
+/**
+ * Crc_CalculateCRC64 with a size_t length.
+ *
+ * @param Crc_DataPtr         Pointer to start address of data block to be calculated.
+ * @param Crc_Length          Length of data block to be calculated in bytes.
+ * @param Crc_StartValue64    Start value, see Crc_CalculateCRC64.
+ * @param Crc_IsFirstCall     First call flag, see Crc_CalculateCRC64.
+ * @return uint64_t
+ */
+uint64_t Crc_CalculateCRC64Long(const uint8_t* Crc_DataPtr,
+                                size_t Crc_Length,
+                                uint64_t Crc_StartValue64,
+                                bool Crc_IsFirstCall);
+
+
+/*
+ * Combining CRCs
+ *
+ * The combine functions return the CRC of the concatenation A||B of two messages from
+ * the CRCs of A and B and the length of B, without the message data. The time is
+ * logarithmic in the length of B. This allows the CRC of a large buffer to be computed
+ * in independent chunks, and a cached CRC to be updated when the part of the message
+ * before or after it changes.
+ */
+
+/**
+ * Combines two CRC8 results into the CRC8 of the concatenated messages, see
+ * Crc_CalculateCRC8.
+ *
+ * @param Crc_Crc1          Crc_CalculateCRC8 result of the first message.
+ * @param Crc_Crc2          Crc_CalculateCRC8 result of the second message.
+ * @param Crc_Length2       Length of the second message in bytes.
+ * @return uint8_t
+ */
+uint8_t Crc_CombineCRC8(uint8_t Crc_Crc1,
+                        uint8_t Crc_Crc2,
+                        size_t Crc_Length2);
+
+/**
+ * Combines two CRC8H2F results into the CRC8H2F of the concatenated messages, see
+ * Crc_CalculateCRC8H2F.
+ *
+ * @param Crc_Crc1          Crc_CalculateCRC8H2F result of the first message.
+ * @param Crc_Crc2          Crc_CalculateCRC8H2F result of the second message.
+ * @param Crc_Length2       Length of the second message in bytes.
+ * @return uint8_t
+ */
+uint8_t Crc_CombineCRC8H2F(uint8_t Crc_Crc1,
+                           uint8_t Crc_Crc2,
+                           size_t Crc_Length2);
+
+/**
+ * Combines two CRC16 results into the CRC16 of the concatenated messages, see
+ * Crc_CalculateCRC16.
+ *
+ * @param Crc_Crc1          Crc_CalculateCRC16 result of the first message.
+ * @param Crc_Crc2          Crc_CalculateCRC16 result of the second message.
+ * @param Crc_Length2       Length of the second message in bytes.
+ * @return uint16_t
+ */
+uint16_t Crc_CombineCRC16(uint16_t Crc_Crc1,
+                          uint16_t Crc_Crc2,
+                          size_t Crc_Length2);
+
+/**
+ * Combines two CRC16ARC results into the CRC16ARC of the concatenated messages, see
+ * Crc_CalculateCRC16ARC.
+ *
+ * @param Crc_Crc1          Crc_CalculateCRC16ARC result of the first message.
+ * @param Crc_Crc2          Crc_CalculateCRC16ARC result of the second message.
+ * @param Crc_Length2       Length of the second message in bytes.
+ * @return uint16_t
+ */
+uint16_t Crc_CombineCRC16ARC(uint16_t Crc_Crc1,
+                             uint16_t Crc_Crc2,
+                             size_t Crc_Length2);
+
+/**
+ * Combines two CRC32 results into the CRC32 of the concatenated messages, see
+ * Crc_CalculateCRC32.
+ *
+ * @param Crc_Crc1          Crc_CalculateCRC32 result of the first message.
+ * @param Crc_Crc2          Crc_CalculateCRC32 result of the second message.
+ * @param Crc_Length2       Length of the second message in bytes.
+ * @return uint32_t
+ */
+uint32_t Crc_CombineCRC32(uint32_t Crc_Crc1,
+                          uint32_t Crc_Crc2,
+                          size_t Crc_Length2);
+
+/**
+ * Combines two CRC32P4 results into the CRC32P4 of the concatenated messages, see
+ * Crc_CalculateCRC32P4.
+ *
+ * @param Crc_Crc1          Crc_CalculateCRC32P4 result of the first message.
+ * @param Crc_Crc2          Crc_CalculateCRC32P4 result of the second message.
+ * @param Crc_Length2       Length of the second message in bytes.
+ * @return uint32_t
+ */
+uint32_t Crc_CombineCRC32P4(uint32_t Crc_Crc1,
+                            uint32_t Crc_Crc2,
+                            size_t Crc_Length2);
+
+/**
+ * Combines two CRC64 results into the CRC64 of the concatenated messages, see
+ * Crc_CalculateCRC64.
+ *
+ * @param Crc_Crc1          Crc_CalculateCRC64 result of the first message.
+ * @param Crc_Crc2          Crc_CalculateCRC64 result of the second message.
+ * @param Crc_Length2       Length of the second message in bytes.
+ * @return uint64_t
+ */
+uint64_t Crc_CombineCRC64(uint64_t Crc_Crc1,
+                          uint64_t Crc_Crc2,
+                          size_t Crc_Length2);
+
+/*
+ * Zero-run fast-forward
+ *
+ * The append zeros functions return the CRC of a message followed by Crc_ZeroLength zero
+ * bytes from the CRC of the message, without reading any data. The time is logarithmic in
+ * Crc_ZeroLength, so zero-padded regions of any size cost about as much as a few bytes.
+ * The CRC of Crc_ZeroLength zero bytes alone is Crc_AppendZerosCRCxx of the CRC of an empty
+ * message.
+ */
+
+/**
+ * Appends Crc_ZeroLength zero bytes to a message, see Crc_CalculateCRC8.
+ *
+ * @param Crc_Crc           Crc_CalculateCRC8 result of the message.
+ * @param Crc_ZeroLength    Number of zero bytes to append.
+ * @return uint8_t
+ */
+uint8_t Crc_AppendZerosCRC8(uint8_t Crc_Crc,
+                            size_t Crc_ZeroLength);
+
+/**
+ * Appends Crc_ZeroLength zero bytes to a message, see Crc_CalculateCRC8H2F.
+ *
+ * @param Crc_Crc           Crc_CalculateCRC8H2F result of the message.
+ * @param Crc_ZeroLength    Number of zero bytes to append.
+ * @return uint8_t
+ */
+uint8_t Crc_AppendZerosCRC8H2F(uint8_t Crc_Crc,
+                               size_t Crc_ZeroLength);
+
+/**
+ * Appends Crc_ZeroLength zero bytes to a message, see Crc_CalculateCRC16.
+ *
+ * @param Crc_Crc           Crc_CalculateCRC16 result of the message.
+ * @param Crc_ZeroLength    Number of zero bytes to append.
+ * @return uint16_t
+ */
+uint16_t Crc_AppendZerosCRC16(uint16_t Crc_Crc,
+                              size_t Crc_ZeroLength);
+
+/**
+ * Appends Crc_ZeroLength zero bytes to a message, see Crc_CalculateCRC16ARC.
+ *
+ * @param Crc_Crc           Crc_CalculateCRC16ARC result of the message.
+ * @param Crc_ZeroLength    Number of zero bytes to append.
+ * @return uint16_t
+ */
+uint16_t Crc_AppendZerosCRC16ARC(uint16_t Crc_Crc,
+                                 size_t Crc_ZeroLength);
+
+/**
+ * Appends Crc_ZeroLength zero bytes to a message, see Crc_CalculateCRC32.
+ *
+ * @param Crc_Crc           Crc_CalculateCRC32 result of the message.
+ * @param Crc_ZeroLength    Number of zero bytes to append.
+ * @return uint32_t
+ */
+uint32_t Crc_AppendZerosCRC32(uint32_t Crc_Crc,
+                              size_t Crc_ZeroLength);
+
+/**
+ * Appends Crc_ZeroLength zero bytes to a message, see Crc_CalculateCRC32P4.
+ *
+ * @param Crc_Crc           Crc_CalculateCRC32P4 result of the message.
+ * @param Crc_ZeroLength    Number of zero bytes to append.
+ * @return uint32_t
+ */
+uint32_t Crc_AppendZerosCRC32P4(uint32_t Crc_Crc,
+                                size_t Crc_ZeroLength);
+
+/**
+ * Appends Crc_ZeroLength zero bytes to a message, see Crc_CalculateCRC64.
+ *
+ * @param Crc_Crc           Crc_CalculateCRC64 result of the message.
+ * @param Crc_ZeroLength    Number of zero bytes to append.
+ * @return uint64_t
+ */
+uint64_t Crc_AppendZerosCRC64(uint64_t Crc_Crc,
+                              size_t Crc_ZeroLength);
+
+/*
+ * Sparse updates
+ *
+ * The patch functions return the CRC of a buffer after some of its bytes were rewritten,
+ * from the CRC before the change, the length of the buffer and the old and new contents
+ * of the rewritten ranges. Because a CRC is linear, the change of the CRC only depends on
+ * the XOR of old and new bytes and on how far the range is from the end of the buffer.
+ * The time is proportional to the patched bytes plus the logarithm of Crc_Length per
+ * patch, so a counter or timestamp in a large PDU is updated without reading the rest of
+ * the buffer.
+ */
+
+/**
+ * A rewritten range of a buffer
+ */
+typedef struct {
+    /**
+     * Position of the range in the buffer in bytes
+     */
+    size_t Offset;
+
+    /**
+     * Length of the range in bytes
+     */
+    size_t Length;
+
+    /**
+     * Contents of the range before the change
+     */
+    const uint8_t* OldDataPtr;
+
+    /**
+     * Contents of the range after the change
+     */
+    const uint8_t* NewDataPtr;
+} Crc_PatchType;
+
+/**
+ * Updates a Crc_CalculateCRC8 result for rewritten ranges of the buffer.
+ *
+ * @param Crc_Crc           Crc_CalculateCRC8 result of the buffer before the change.
+ * @param Crc_Length        Length of the buffer in bytes.
+ * @param Crc_Patches       The rewritten ranges, which must lie within the buffer. Ranges may
+ *                          overlap if they are listed in the order they were written.
+ * @param Crc_PatchCount    Number of ranges.
+ * @return uint8_t
+ */
+uint8_t Crc_PatchCRC8(uint8_t Crc_Crc,
+                      size_t Crc_Length,
+                      const Crc_PatchType Crc_Patches[],
+                      uint32_t Crc_PatchCount);
+
+/**
+ * Updates a Crc_CalculateCRC8H2F result for rewritten ranges of the buffer.
+ *
+ * @param Crc_Crc           Crc_CalculateCRC8H2F result of the buffer before the change.
+ * @param Crc_Length        Length of the buffer in bytes.
+ * @param Crc_Patches       The rewritten ranges, which must lie within the buffer. Ranges may
+ *                          overlap if they are listed in the order they were written.
+ * @param Crc_PatchCount    Number of ranges.
+ * @return uint8_t
+ */
+uint8_t Crc_PatchCRC8H2F(uint8_t Crc_Crc,
+                         size_t Crc_Length,
+                         const Crc_PatchType Crc_Patches[],
+                         uint32_t Crc_PatchCount);
+
+/**
+ * Updates a Crc_CalculateCRC16 result for rewritten ranges of the buffer.
+ *
+ * @param Crc_Crc           Crc_CalculateCRC16 result of the buffer before the change.
+ * @param Crc_Length        Length of the buffer in bytes.
+ * @param Crc_Patches       The rewritten ranges, which must lie within the buffer. Ranges may
+ *                          overlap if they are listed in the order they were written.
+ * @param Crc_PatchCount    Number of ranges.
+ * @return uint16_t
+ */
+uint16_t Crc_PatchCRC16(uint16_t Crc_Crc,
+                        size_t Crc_Length,
+                        const Crc_PatchType Crc_Patches[],
+                        uint32_t Crc_PatchCount);
+
+/**
+ * Updates a Crc_CalculateCRC16ARC result for rewritten ranges of the buffer.
+ *
+ * @param Crc_Crc           Crc_CalculateCRC16ARC result of the buffer before the change.
+ * @param Crc_Length        Length of the buffer in bytes.
+ * @param Crc_Patches       The rewritten ranges, which must lie within the buffer. Ranges may
+ *                          overlap if they are listed in the order they were written.
+ * @param Crc_PatchCount    Number of ranges.
+ * @return uint16_t
+ */
+uint16_t Crc_PatchCRC16ARC(uint16_t Crc_Crc,
+                           size_t Crc_Length,
+                           const Crc_PatchType Crc_Patches[],
+                           uint32_t Crc_PatchCount);
+
+/**
+ * Updates a Crc_CalculateCRC32 result for rewritten ranges of the buffer.
+ *
+ * @param Crc_Crc           Crc_CalculateCRC32 result of the buffer before the change.
+ * @param Crc_Length        Length of the buffer in bytes.
+ * @param Crc_Patches       The rewritten ranges, which must lie within the buffer. Ranges may
+ *                          overlap if they are listed in the order they were written.
+ * @param Crc_PatchCount    Number of ranges.
+ * @return uint32_t
+ */
+uint32_t Crc_PatchCRC32(uint32_t Crc_Crc,
+                        size_t Crc_Length,
+                        const Crc_PatchType Crc_Patches[],
+                        uint32_t Crc_PatchCount);
+
+/**
+ * Updates a Crc_CalculateCRC32P4 result for rewritten ranges of the buffer.
+ *
+ * @param Crc_Crc           Crc_CalculateCRC32P4 result of the buffer before the change.
+ * @param Crc_Length        Length of the buffer in bytes.
+ * @param Crc_Patches       The rewritten ranges, which must lie within the buffer. Ranges may
+ *                          overlap if they are listed in the order they were written.
+ * @param Crc_PatchCount    Number of ranges.
+ * @return uint32_t
+ */
+uint32_t Crc_PatchCRC32P4(uint32_t Crc_Crc,
+                          size_t Crc_Length,
+                          const Crc_PatchType Crc_Patches[],
+                          uint32_t Crc_PatchCount);
+
+/**
+ * Updates a Crc_CalculateCRC64 result for rewritten ranges of the buffer.
+ *
+ * @param Crc_Crc           Crc_CalculateCRC64 result of the buffer before the change.
+ * @param Crc_Length        Length of the buffer in bytes.
+ * @param Crc_Patches       The rewritten ranges, which must lie within the buffer. Ranges may
+ *                          overlap if they are listed in the order they were written.
+ * @param Crc_PatchCount    Number of ranges.
+ * @return uint64_t
+ */
+uint64_t Crc_PatchCRC64(uint64_t Crc_Crc,
+                        size_t Crc_Length,
+                        const Crc_PatchType Crc_Patches[],
+                        uint32_t Crc_PatchCount);
+
+
+
+/*
+ * Batch calculation
+ *
+ * The batch functions calculate the CRCs of Crc_Count independent messages in one call.
+ * The messages are processed side by side, in SIMD lanes where the CPU supports it and
+ * as interleaved scalar calculations otherwise, so that many short messages are not
+ * limited by the latency of one calculation. Each result is identical to calling
+ * Crc_CalculateCRCxx on the message alone.
+ *
+ * Messages are taken 16 at a time in array order and a group takes as long as its longest
+ * message, so batches of similar lengths run fastest. Messages shorter than about 16 bytes
+ * gain little over separate Crc_CalculateCRCxx calls.
+ */
+
+/**
+ * Calculates Crc_CalculateCRC8 for Crc_Count messages.
+ *
+ * @param Crc_DataPtrs            Start addresses of the messages.
+ * @param Crc_Lengths             Lengths of the messages in bytes.
+ * @param Crc_StartValues8        Start values of the messages, see Crc_CalculateCRC8. May be
+ *                                NULL when Crc_IsFirstCall is TRUE.
+ * @param Crc_IsFirstCall         TRUE: First call in a sequence for every message, ignore
+ *                                Crc_StartValues8. FALSE: Subsequent call for every message.
+ * @param Crc_Results             Receives the CRC of each message, may be the same array as
+ *                                Crc_StartValues8.
+ * @param Crc_Count               Number of messages.
+ */
+void Crc_CalculateCRC8Batch(const uint8_t* const Crc_DataPtrs[],
+                            const uint32_t Crc_Lengths[],
+                            const uint8_t Crc_StartValues8[],
+                            bool Crc_IsFirstCall,
+                            uint8_t Crc_Results[],
+                            uint32_t Crc_Count);
+
+/**
+ * Calculates Crc_CalculateCRC8H2F for Crc_Count messages.
+ *
+ * @param Crc_DataPtrs            Start addresses of the messages.
+ * @param Crc_Lengths             Lengths of the messages in bytes.
+ * @param Crc_StartValues8H2F     Start values of the messages, see Crc_CalculateCRC8H2F. May be
+ *                                NULL when Crc_IsFirstCall is TRUE.
+ * @param Crc_IsFirstCall         TRUE: First call in a sequence for every message, ignore
+ *                                Crc_StartValues8H2F. FALSE: Subsequent call for every message.
+ * @param Crc_Results             Receives the CRC of each message, may be the same array as
+ *                                Crc_StartValues8H2F.
+ * @param Crc_Count               Number of messages.
+ */
+void Crc_CalculateCRC8H2FBatch(const uint8_t* const Crc_DataPtrs[],
+                               const uint32_t Crc_Lengths[],
+                               const uint8_t Crc_StartValues8H2F[],
+                               bool Crc_IsFirstCall,
+                               uint8_t Crc_Results[],
+                               uint32_t Crc_Count);
+
+/**
+ * Calculates Crc_CalculateCRC16 for Crc_Count messages.
+ *
+ * @param Crc_DataPtrs            Start addresses of the messages.
+ * @param Crc_Lengths             Lengths of the messages in bytes.
+ * @param Crc_StartValues16       Start values of the messages, see Crc_CalculateCRC16. May be
+ *                                NULL when Crc_IsFirstCall is TRUE.
+ * @param Crc_IsFirstCall         TRUE: First call in a sequence for every message, ignore
+ *                                Crc_StartValues16. FALSE: Subsequent call for every message.
+ * @param Crc_Results             Receives the CRC of each message, may be the same array as
+ *                                Crc_StartValues16.
+ * @param Crc_Count               Number of messages.
+ */
+void Crc_CalculateCRC16Batch(const uint8_t* const Crc_DataPtrs[],
+                             const uint32_t Crc_Lengths[],
+                             const uint16_t Crc_StartValues16[],
+                             bool Crc_IsFirstCall,
+                             uint16_t Crc_Results[],
+                             uint32_t Crc_Count);
+
+/**
+ * Calculates Crc_CalculateCRC16ARC for Crc_Count messages.
+ *
+ * @param Crc_DataPtrs            Start addresses of the messages.
+ * @param Crc_Lengths             Lengths of the messages in bytes.
+ * @param Crc_StartValues16       Start values of the messages, see Crc_CalculateCRC16ARC. May be
+ *                                NULL when Crc_IsFirstCall is TRUE.
+ * @param Crc_IsFirstCall         TRUE: First call in a sequence for every message, ignore
+ *                                Crc_StartValues16. FALSE: Subsequent call for every message.
+ * @param Crc_Results             Receives the CRC of each message, may be the same array as
+ *                                Crc_StartValues16.
+ * @param Crc_Count               Number of messages.
+ */
+void Crc_CalculateCRC16ARCBatch(const uint8_t* const Crc_DataPtrs[],
+                                const uint32_t Crc_Lengths[],
+                                const uint16_t Crc_StartValues16[],
+                                bool Crc_IsFirstCall,
+                                uint16_t Crc_Results[],
+                                uint32_t Crc_Count);
+
+/**
+ * Calculates Crc_CalculateCRC32 for Crc_Count messages.
+ *
+ * @param Crc_DataPtrs            Start addresses of the messages.
+ * @param Crc_Lengths             Lengths of the messages in bytes.
+ * @param Crc_StartValues32       Start values of the messages, see Crc_CalculateCRC32. May be
+ *                                NULL when Crc_IsFirstCall is TRUE.
+ * @param Crc_IsFirstCall         TRUE: First call in a sequence for every message, ignore
+ *                                Crc_StartValues32. FALSE: Subsequent call for every message.
+ * @param Crc_Results             Receives the CRC of each message, may be the same array as
+ *                                Crc_StartValues32.
+ * @param Crc_Count               Number of messages.
+ */
+void Crc_CalculateCRC32Batch(const uint8_t* const Crc_DataPtrs[],
+                             const uint32_t Crc_Lengths[],
+                             const uint32_t Crc_StartValues32[],
+                             bool Crc_IsFirstCall,
+                             uint32_t Crc_Results[],
+                             uint32_t Crc_Count);
+
+/**
+ * Calculates Crc_CalculateCRC32P4 for Crc_Count messages.
+ *
+ * @param Crc_DataPtrs            Start addresses of the messages.
+ * @param Crc_Lengths             Lengths of the messages in bytes.
+ * @param Crc_StartValues32       Start values of the messages, see Crc_CalculateCRC32P4. May be
+ *                                NULL when Crc_IsFirstCall is TRUE.
+ * @param Crc_IsFirstCall         TRUE: First call in a sequence for every message, ignore
+ *                                Crc_StartValues32. FALSE: Subsequent call for every message.
+ * @param Crc_Results             Receives the CRC of each message, may be the same array as
+ *                                Crc_StartValues32.
+ * @param Crc_Count               Number of messages.
+ */
+void Crc_CalculateCRC32P4Batch(const uint8_t* const Crc_DataPtrs[],
+                               const uint32_t Crc_Lengths[],
+                               const uint32_t Crc_StartValues32[],
+                               bool Crc_IsFirstCall,
+                               uint32_t Crc_Results[],
+                               uint32_t Crc_Count);
+
+/**
+ * Calculates Crc_CalculateCRC64 for Crc_Count messages.
+ *
+ * @param Crc_DataPtrs            Start addresses of the messages.
+ * @param Crc_Lengths             Lengths of the messages in bytes.
+ * @param Crc_StartValues64       Start values of the messages, see Crc_CalculateCRC64. May be
+ *                                NULL when Crc_IsFirstCall is TRUE.
+ * @param Crc_IsFirstCall         TRUE: First call in a sequence for every message, ignore
+ *                                Crc_StartValues64. FALSE: Subsequent call for every message.
+ * @param Crc_Results             Receives the CRC of each message, may be the same array as
+ *                                Crc_StartValues64.
+ * @param Crc_Count               Number of messages.
+ */
+void Crc_CalculateCRC64Batch(const uint8_t* const Crc_DataPtrs[],
+                             const uint32_t Crc_Lengths[],
+                             const uint64_t Crc_StartValues64[],
+                             bool Crc_IsFirstCall,
+                             uint64_t Crc_Results[],
+                             uint32_t Crc_Count);
+
+/*
+ * Streaming calculation
+ *
+ * A context holds the CRC register of a message that is calculated in several parts.
+ * Crc_InitCRCxx starts a message, Crc_UpdateCRCxx appends data to it and Crc_FinalCRCxx
+ * returns its CRC, applying the XOR value once. Parts are not limited to 32-bit lengths.
+ * The result is identical to a single Crc_CalculateCRCxx call over all parts.
+ */
+
+/**
+ * Context of a streaming Crc_CalculateCRC8 calculation
+ */
+typedef struct {
+    /**
+     * CRC register, the CRC without the final XOR value
+     */
+    uint8_t Register;
+} Crc_ContextCRC8Type;
+
+/**
+ * Context of a streaming Crc_CalculateCRC8H2F calculation
+ */
+typedef struct {
+    /**
+     * CRC register, the CRC without the final XOR value
+     */
+    uint8_t Register;
+} Crc_ContextCRC8H2FType;
+
+/**
+ * Context of a streaming Crc_CalculateCRC16 calculation
+ */
+typedef struct {
+    /**
+     * CRC register, the CRC without the final XOR value
+     */
+    uint16_t Register;
+} Crc_ContextCRC16Type;
+
+/**
+ * Context of a streaming Crc_CalculateCRC16ARC calculation
+ */
+typedef struct {
+    /**
+     * CRC register, the CRC without the final XOR value
+     */
+    uint16_t Register;
+} Crc_ContextCRC16ARCType;
+
+/**
+ * Context of a streaming Crc_CalculateCRC32 calculation
+ */
+typedef struct {
+    /**
+     * CRC register, the CRC without the final XOR value
+     */
+    uint32_t Register;
+} Crc_ContextCRC32Type;
+
+/**
+ * Context of a streaming Crc_CalculateCRC32P4 calculation
+ */
+typedef struct {
+    /**
+     * CRC register, the CRC without the final XOR value
+     */
+    uint32_t Register;
+} Crc_ContextCRC32P4Type;
+
+/**
+ * Context of a streaming Crc_CalculateCRC64 calculation
+ */
+typedef struct {
+    /**
+     * CRC register, the CRC without the final XOR value
+     */
+    uint64_t Register;
+} Crc_ContextCRC64Type;
+
+/**
+ * Starts a streaming Crc_CalculateCRC8 calculation.
+ *
+ * @param Crc_Context       Context to initialize.
+ */
+void Crc_InitCRC8(Crc_ContextCRC8Type* Crc_Context);
+
+/**
+ * Appends Crc_Length bytes to the message of a streaming Crc_CalculateCRC8 calculation.
+ *
+ * @param Crc_Context       Context of the calculation.
+ * @param Crc_DataPtr       Pointer to start address of data block to be appended.
+ * @param Crc_Length        Length of data block to be appended in bytes.
+ */
+void Crc_UpdateCRC8(Crc_ContextCRC8Type* Crc_Context,
+                    const uint8_t* Crc_DataPtr,
+                    size_t Crc_Length);
+
+/**
+ * Returns the Crc_CalculateCRC8 result of the message so far. The context is not
+ * changed and the calculation may continue.
+ *
+ * @param Crc_Context       Context of the calculation.
+ * @return uint8_t
+ */
+uint8_t Crc_FinalCRC8(const Crc_ContextCRC8Type* Crc_Context);
+
+/**
+ * Starts a streaming Crc_CalculateCRC8H2F calculation.
+ *
+ * @param Crc_Context       Context to initialize.
+ */
+void Crc_InitCRC8H2F(Crc_ContextCRC8H2FType* Crc_Context);
+
+/**
+ * Appends Crc_Length bytes to the message of a streaming Crc_CalculateCRC8H2F calculation.
+ *
+ * @param Crc_Context       Context of the calculation.
+ * @param Crc_DataPtr       Pointer to start address of data block to be appended.
+ * @param Crc_Length        Length of data block to be appended in bytes.
+ */
+void Crc_UpdateCRC8H2F(Crc_ContextCRC8H2FType* Crc_Context,
+                       const uint8_t* Crc_DataPtr,
+                       size_t Crc_Length);
+
+/**
+ * Returns the Crc_CalculateCRC8H2F result of the message so far. The context is not
+ * changed and the calculation may continue.
+ *
+ * @param Crc_Context       Context of the calculation.
+ * @return uint8_t
+ */
+uint8_t Crc_FinalCRC8H2F(const Crc_ContextCRC8H2FType* Crc_Context);
+
+/**
+ * Starts a streaming Crc_CalculateCRC16 calculation.
+ *
+ * @param Crc_Context       Context to initialize.
+ */
+void Crc_InitCRC16(Crc_ContextCRC16Type* Crc_Context);
+
+/**
+ * Appends Crc_Length bytes to the message of a streaming Crc_CalculateCRC16 calculation.
+ *
+ * @param Crc_Context       Context of the calculation.
+ * @param Crc_DataPtr       Pointer to start address of data block to be appended.
+ * @param Crc_Length        Length of data block to be appended in bytes.
+ */
+void Crc_UpdateCRC16(Crc_ContextCRC16Type* Crc_Context,
+                     const uint8_t* Crc_DataPtr,
+                     size_t Crc_Length);
+
+/**
+ * Returns the Crc_CalculateCRC16 result of the message so far. The context is not
+ * changed and the calculation may continue.
+ *
+ * @param Crc_Context       Context of the calculation.
+ * @return uint16_t
+ */
+uint16_t Crc_FinalCRC16(const Crc_ContextCRC16Type* Crc_Context);
+
+/**
+ * Starts a streaming Crc_CalculateCRC16ARC calculation.
+ *
+ * @param Crc_Context       Context to initialize.
+ */
+void Crc_InitCRC16ARC(Crc_ContextCRC16ARCType* Crc_Context);
+
+/**
+ * Appends Crc_Length bytes to the message of a streaming Crc_CalculateCRC16ARC calculation.
+ *
+ * @param Crc_Context       Context of the calculation.
+ * @param Crc_DataPtr       Pointer to start address of data block to be appended.
+ * @param Crc_Length        Length of data block to be appended in bytes.
+ */
+void Crc_UpdateCRC16ARC(Crc_ContextCRC16ARCType* Crc_Context,
+                        const uint8_t* Crc_DataPtr,
+                        size_t Crc_Length);
+
+/**
+ * Returns the Crc_CalculateCRC16ARC result of the message so far. The context is not
+ * changed and the calculation may continue.
+ *
+ * @param Crc_Context       Context of the calculation.
+ * @return uint16_t
+ */
+uint16_t Crc_FinalCRC16ARC(const Crc_ContextCRC16ARCType* Crc_Context);
+
+/**
+ * Starts a streaming Crc_CalculateCRC32 calculation.
+ *
+ * @param Crc_Context       Context to initialize.
+ */
+void Crc_InitCRC32(Crc_ContextCRC32Type* Crc_Context);
+
+/**
+ * Appends Crc_Length bytes to the message of a streaming Crc_CalculateCRC32 calculation.
+ *
+ * @param Crc_Context       Context of the calculation.
+ * @param Crc_DataPtr       Pointer to start address of data block to be appended.
+ * @param Crc_Length        Length of data block to be appended in bytes.
+ */
+void Crc_UpdateCRC32(Crc_ContextCRC32Type* Crc_Context,
+                     const uint8_t* Crc_DataPtr,
+                     size_t Crc_Length);
+
+/**
+ * Returns the Crc_CalculateCRC32 result of the message so far. The context is not
+ * changed and the calculation may continue.
+ *
+ * @param Crc_Context       Context of the calculation.
+ * @return uint32_t
+ */
+uint32_t Crc_FinalCRC32(const Crc_ContextCRC32Type* Crc_Context);
+
+/**
+ * Starts a streaming Crc_CalculateCRC32P4 calculation.
+ *
+ * @param Crc_Context       Context to initialize.
+ */
+void Crc_InitCRC32P4(Crc_ContextCRC32P4Type* Crc_Context);
+
+/**
+ * Appends Crc_Length bytes to the message of a streaming Crc_CalculateCRC32P4 calculation.
+ *
+ * @param Crc_Context       Context of the calculation.
+ * @param Crc_DataPtr       Pointer to start address of data block to be appended.
+ * @param Crc_Length        Length of data block to be appended in bytes.
+ */
+void Crc_UpdateCRC32P4(Crc_ContextCRC32P4Type* Crc_Context,
+                       const uint8_t* Crc_DataPtr,
+                       size_t Crc_Length);
+
+/**
+ * Returns the Crc_CalculateCRC32P4 result of the message so far. The context is not
+ * changed and the calculation may continue.
+ *
+ * @param Crc_Context       Context of the calculation.
+ * @return uint32_t
+ */
+uint32_t Crc_FinalCRC32P4(const Crc_ContextCRC32P4Type* Crc_Context);
+
+/**
+ * Starts a streaming Crc_CalculateCRC64 calculation.
+ *
+ * @param Crc_Context       Context to initialize.
+ */
+void Crc_InitCRC64(Crc_ContextCRC64Type* Crc_Context);
+
+/**
+ * Appends Crc_Length bytes to the message of a streaming Crc_CalculateCRC64 calculation.
+ *
+ * @param Crc_Context       Context of the calculation.
+ * @param Crc_DataPtr       Pointer to start address of data block to be appended.
+ * @param Crc_Length        Length of data block to be appended in bytes.
+ */
+void Crc_UpdateCRC64(Crc_ContextCRC64Type* Crc_Context,
+                     const uint8_t* Crc_DataPtr,
+                     size_t Crc_Length);
+
+/**
+ * Returns the Crc_CalculateCRC64 result of the message so far. The context is not
+ * changed and the calculation may continue.
+ *
+ * @param Crc_Context       Context of the calculation.
+ * @return uint64_t
+ */
+uint64_t Crc_FinalCRC64(const Crc_ContextCRC64Type* Crc_Context);
+
+/*
+ * Scatter-gather calculation
+ *
+ * The vector functions calculate the CRC of a message that is stored in several
+ * segments, e.g. a header and a payload in separate buffers, without copying the
+ * segments together. The result is identical to Crc_CalculateCRCxx over the concatenated
+ * segments.
+ */
+
+/**
+ * A part of a message
+ */
+typedef struct {
+    /**
+     * Start address of the segment, may be NULL when Length is 0.
+     */
+    const uint8_t* DataPtr;
+
+    /**
+     * Length of the segment in bytes
+     */
+    size_t Length;
+} Crc_SegmentType;
+
+/**
+ * Calculates Crc_CalculateCRC8 over Crc_SegmentCount segments in order.
+ *
+ * @param Crc_Segments        Segments of the data block to be calculated.
+ * @param Crc_SegmentCount    Number of segments.
+ * @param Crc_StartValue8     Start value when the algorithm starts, see Crc_CalculateCRC8.
+ * @param Crc_IsFirstCall     First call in a sequence, see Crc_CalculateCRC8.
+ * @return uint8_t
+ */
+uint8_t Crc_CalculateCRC8V(const Crc_SegmentType Crc_Segments[],
+                           uint32_t Crc_SegmentCount,
+                           uint8_t Crc_StartValue8,
+                           bool Crc_IsFirstCall);
+
+/**
+ * Calculates Crc_CalculateCRC8H2F over Crc_SegmentCount segments in order.
+ *
+ * @param Crc_Segments          Segments of the data block to be calculated.
+ * @param Crc_SegmentCount      Number of segments.
+ * @param Crc_StartValue8H2F    Start value when the algorithm starts, see Crc_CalculateCRC8H2F.
+ * @param Crc_IsFirstCall       First call in a sequence, see Crc_CalculateCRC8H2F.
+ * @return uint8_t
+ */
+uint8_t Crc_CalculateCRC8H2FV(const Crc_SegmentType Crc_Segments[],
+                              uint32_t Crc_SegmentCount,
+                              uint8_t Crc_StartValue8H2F,
+                              bool Crc_IsFirstCall);
+
+/**
+ * Calculates Crc_CalculateCRC16 over Crc_SegmentCount segments in order.
+ *
+ * @param Crc_Segments        Segments of the data block to be calculated.
+ * @param Crc_SegmentCount    Number of segments.
+ * @param Crc_StartValue16    Start value when the algorithm starts, see Crc_CalculateCRC16.
+ * @param Crc_IsFirstCall     First call in a sequence, see Crc_CalculateCRC16.
+ * @return uint16_t
+ */
+uint16_t Crc_CalculateCRC16V(const Crc_SegmentType Crc_Segments[],
+                             uint32_t Crc_SegmentCount,
+                             uint16_t Crc_StartValue16,
+                             bool Crc_IsFirstCall);
+
+/**
+ * Calculates Crc_CalculateCRC16ARC over Crc_SegmentCount segments in order.
+ *
+ * @param Crc_Segments        Segments of the data block to be calculated.
+ * @param Crc_SegmentCount    Number of segments.
+ * @param Crc_StartValue16    Start value when the algorithm starts, see Crc_CalculateCRC16ARC.
+ * @param Crc_IsFirstCall     First call in a sequence, see Crc_CalculateCRC16ARC.
+ * @return uint16_t
+ */
+uint16_t Crc_CalculateCRC16ARCV(const Crc_SegmentType Crc_Segments[],
+                                uint32_t Crc_SegmentCount,
+                                uint16_t Crc_StartValue16,
+                                bool Crc_IsFirstCall);
+
+/**
+ * Calculates Crc_CalculateCRC32 over Crc_SegmentCount segments in order.
+ *
+ * @param Crc_Segments        Segments of the data block to be calculated.
+ * @param Crc_SegmentCount    Number of segments.
+ * @param Crc_StartValue32    Start value when the algorithm starts, see Crc_CalculateCRC32.
+ * @param Crc_IsFirstCall     First call in a sequence, see Crc_CalculateCRC32.
+ * @return uint32_t
+ */
+uint32_t Crc_CalculateCRC32V(const Crc_SegmentType Crc_Segments[],
+                             uint32_t Crc_SegmentCount,
+                             uint32_t Crc_StartValue32,
+                             bool Crc_IsFirstCall);
+
+/**
+ * Calculates Crc_CalculateCRC32P4 over Crc_SegmentCount segments in order.
+ *
+ * @param Crc_Segments        Segments of the data block to be calculated.
+ * @param Crc_SegmentCount    Number of segments.
+ * @param Crc_StartValue32    Start value when the algorithm starts, see Crc_CalculateCRC32P4.
+ * @param Crc_IsFirstCall     First call in a sequence, see Crc_CalculateCRC32P4.
+ * @return uint32_t
+ */
+uint32_t Crc_CalculateCRC32P4V(const Crc_SegmentType Crc_Segments[],
+                               uint32_t Crc_SegmentCount,
+                               uint32_t Crc_StartValue32,
+                               bool Crc_IsFirstCall);
+
+/**
+ * Calculates Crc_CalculateCRC64 over Crc_SegmentCount segments in order.
+ *
+ * @param Crc_Segments        Segments of the data block to be calculated.
+ * @param Crc_SegmentCount    Number of segments.
+ * @param Crc_StartValue64    Start value when the algorithm starts, see Crc_CalculateCRC64.
+ * @param Crc_IsFirstCall     First call in a sequence, see Crc_CalculateCRC64.
+ * @return uint64_t
+ */
+uint64_t Crc_CalculateCRC64V(const Crc_SegmentType Crc_Segments[],
+                             uint32_t Crc_SegmentCount,
+                             uint64_t Crc_StartValue64,
+                             bool Crc_IsFirstCall);
+
 #endif  // CRC_H__
@@ -0,0 +1,217 @@
+#ifndef CRC_ENGINE_HPP__
+#define CRC_ENGINE_HPP__
+
+/**
+ * @file CrcEngine.hpp
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * Header-only C++14 CRC engine. A CRC is described by its Rocksoft
+ * parameters (width, polynomial, initial value, input and output
+ * reflection and XOR value) and the lookup table is generated from them
+ * at compile time. Every function is constexpr, so the CRC of constant
+ * data, e.g. the DataID bytes of an E2E profile, can be evaluated by the
+ * compiler:
+ *
+ *   static_assert(crc::Crc32Engine::calculate(data, sizeof(data), 0, true) == 0xCBF43926, "");
+ *
+ * At runtime the engine is the byte-wise table algorithm of crc_fast,
+ * which is what the crc_engine library instantiates for the functions in
+ * Crc.h.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace crc {
+
+namespace detail {
+
+template <typename T>
+struct Table {
+    T entries[256];
+};
+
+template <typename T>
+constexpr T reflect(T Value, unsigned Bits) {
+    T reflection = 0;
+
+    for (unsigned bit = 0; bit < Bits; ++bit) {
+        reflection = static_cast<T>((reflection << 1) | (Value & 1U));
+        Value = static_cast<T>(Value >> 1);
+    }
+
+    return reflection;
+}
+
+template <typename T, unsigned Width, T Polynomial, bool ReflectIn>
+constexpr Table<T> makeTable() {
+    Table<T> result{};
+    const T mask = static_cast<T>(static_cast<T>(~T(0)) >> ((8 * sizeof(T)) - Width));
+    const T topbit = static_cast<T>(T(1) << (Width - 1));
+    const T reflectedPolynomial = reflect(Polynomial, Width);
+
+    for (unsigned byte = 0; byte < 256; ++byte) {
+        T remainder = 0;
+
+        if (ReflectIn) {
+            remainder = static_cast<T>(byte);
+            for (unsigned bit = 0; bit < 8; ++bit) {
+                if (remainder & 1U) {
+                    remainder = static_cast<T>((remainder >> 1) ^ reflectedPolynomial);
+                } else {
+                    remainder = static_cast<T>(remainder >> 1);
+                }
+            }
+        } else {
+            remainder = static_cast<T>(static_cast<T>(byte) << (Width - 8));
+            for (unsigned bit = 0; bit < 8; ++bit) {
+                if (remainder & topbit) {
+                    remainder = static_cast<T>(((remainder << 1) ^ Polynomial) & mask);
+                } else {
+                    remainder = static_cast<T>((remainder << 1) & mask);
+                }
+            }
+        }
+
+        result.entries[byte] = remainder;
+    }
+
+    return result;
+}
+
+}  // namespace detail
+
+/**
+ * CRC calculation for one set of parameters.
+ *
+ * @tparam T            Unsigned type holding the CRC, at least Width bits wide.
+ * @tparam Width        CRC result width in bits, 8 to 64.
+ * @tparam Polynomial   Polynomial without the x^Width term, in normal (MSB first) bit order.
+ * @tparam Initial      Initial value, in normal bit order.
+ * @tparam ReflectIn    Input data reflected.
+ * @tparam ReflectOut   Result data reflected.
+ * @tparam XorValue     XOR value applied to the result.
+ */
+template <typename T, unsigned Width, T Polynomial, T Initial, bool ReflectIn, bool ReflectOut, T XorValue>
+class Engine {
+    static_assert(std::is_unsigned<T>::value, "T must be an unsigned integer type");
+    static_assert((Width >= 8) && (Width <= (8 * sizeof(T))), "Width must be 8 bits to the width of T");
+
+public:
+    using ValueType = T;
+
+    /**
+     * All Width bits set
+     */
+    static constexpr T mask = static_cast<T>(static_cast<T>(~T(0)) >> ((8 * sizeof(T)) - Width));
+
+    using Table = detail::Table<T>;
+
+    /**
+     * Remainder of every byte value, in the bit order of the CRC register
+     */
+    static constexpr Table table = detail::makeTable<T, Width, Polynomial, ReflectIn>();
+
+    /**
+     * Calculates the CRC of Length bytes with the semantics of Crc_CalculateCRCxx in Crc.h.
+     *
+     * @param Data          Start address of the data.
+     * @param Length        Length of the data in bytes.
+     * @param StartValue    Result of the previous call in a sequence, ignored when IsFirstCall
+     *                      is true.
+     * @param IsFirstCall   First call in a sequence or individual CRC calculation.
+     * @return T
+     */
+    static constexpr T calculate(const uint8_t* Data, size_t Length, T StartValue, bool IsFirstCall) {
+        return finish(update(start(StartValue, IsFirstCall), Data, Length));
+    }
+
+    /**
+     * Returns the CRC register to continue from, in the bit order of the input data.
+     */
+    static constexpr T start(T StartValue, bool IsFirstCall) {
+        T remainder = 0;
+
+        if (IsFirstCall) {
+            // SWS_Crc_00014
+            remainder = ReflectIn ? detail::reflect(Initial, Width) : Initial;
+        } else {
+            // SWS_Crc_00041
+            remainder = static_cast<T>(StartValue ^ XorValue);
+            if (ReflectIn != ReflectOut) {
+                remainder = detail::reflect(remainder, Width);
+            }
+        }
+
+        return remainder;
+    }
+
+    /**
+     * Divides Length bytes by the polynomial, a byte at a time.
+     */
+    static constexpr T update(T Remainder, const uint8_t* Data, size_t Length) {
+        for (size_t byte = 0; byte < Length; ++byte) {
+            if (ReflectIn) {
+                const uint8_t index = static_cast<uint8_t>(Data[byte] ^ Remainder);
+                Remainder = static_cast<T>(table.entries[index] ^ shiftRight8(Remainder));
+            } else {
+                const uint8_t index = static_cast<uint8_t>(Data[byte] ^ (Remainder >> (Width - 8)));
+                Remainder = static_cast<T>((table.entries[index] ^ shiftLeft8(Remainder)) & mask);
+            }
+        }
+
+        return Remainder;
+    }
+
+    /**
+     * Returns the CRC result of a CRC register.
+     */
+    static constexpr T finish(T Remainder) {
+        if (ReflectIn != ReflectOut) {
+            Remainder = detail::reflect(Remainder, Width);
+        }
+
+        return static_cast<T>(Remainder ^ XorValue);
+    }
+
+private:
+    /*
+     * Shifts by 8 bits, which is all of T for 8-bit CRCs.
+     */
+    static constexpr T shiftRight8(T Value) {
+        return (sizeof(T) > 1) ? static_cast<T>(Value >> 8) : T(0);
+    }
+
+    static constexpr T shiftLeft8(T Value) {
+        return (sizeof(T) > 1) ? static_cast<T>(Value << 8) : T(0);
+    }
+};
+
+template <typename T, unsigned Width, T Polynomial, T Initial, bool ReflectIn, bool ReflectOut, T XorValue>
+constexpr T Engine<T, Width, Polynomial, Initial, ReflectIn, ReflectOut, XorValue>::mask;
+
+template <typename T, unsigned Width, T Polynomial, T Initial, bool ReflectIn, bool ReflectOut, T XorValue>
+constexpr typename Engine<T, Width, Polynomial, Initial, ReflectIn, ReflectOut, XorValue>::Table
+    Engine<T, Width, Polynomial, Initial, ReflectIn, ReflectOut, XorValue>::table;
+
+/*
+ * The algorithms of Crc.h
+ */
+using Crc8Engine = Engine<uint8_t, 8, 0x1D, 0xFF, false, false, 0xFF>;
+using Crc8H2FEngine = Engine<uint8_t, 8, 0x2F, 0xFF, false, false, 0xFF>;
+using Crc16Engine = Engine<uint16_t, 16, 0x1021, 0xFFFF, false, false, 0x0000>;
+using Crc16ARCEngine = Engine<uint16_t, 16, 0x8005, 0x0000, true, true, 0x0000>;
+using Crc32Engine = Engine<uint32_t, 32, 0x04C11DB7, 0xFFFFFFFF, true, true, 0xFFFFFFFF>;
+using Crc32P4Engine = Engine<uint32_t, 32, 0xF4ACFB13, 0xFFFFFFFF, true, true, 0xFFFFFFFF>;
+using Crc64Engine = Engine<uint64_t, 64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, true, true, 0xFFFFFFFFFFFFFFFF>;
+
+}  // namespace crc
+
+#endif  // CRC_ENGINE_HPP__
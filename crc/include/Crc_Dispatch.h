@@ -0,0 +1,83 @@
+#ifndef CRC_DISPATCH_H__
+#define CRC_DISPATCH_H__
+
+/**
+ * @file Crc_Dispatch.h
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief Runtime selection of the CRC implementation in the crc_dispatch library
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2021
+ *
+ * The crc_dispatch library contains every CRC implementation and binds the
+ * Crc_CalculateCRCxx functions in Crc.h to one of them when the program is loaded.
+ * By default the fastest tier the CPU supports is used. The CRC_DISPATCH_TIER
+ * environment variable forces a tier by name ("bitwise", "table", "slice8", "pclmul"
+ * or "avx512"), which is how the tests and benchmarks cover every tier on one machine.
+ * A forced tier the CPU does not support is ignored.
+ *
+ * These functions are only implemented by crc_dispatch.
+ *
+ */
+
+#include "Std_Types.h"
+
+/**
+ * CRC implementation tiers, from slowest to fastest
+ */
+typedef enum {
+    /**
+     * Bit by bit division, as in crc_small
+     */
+    CRC_DISPATCH_TIER_BITWISE = 0x00,
+
+    /**
+     * One 256-entry lookup table per byte, as in crc_fast
+     */
+    CRC_DISPATCH_TIER_TABLE = 0x01,
+
+    /**
+     * Eight lookup tables per eight bytes, as in crc_slice8
+     */
+    CRC_DISPATCH_TIER_SLICE8 = 0x02,
+
+    /**
+     * 128-bit PCLMULQDQ folding and PSHUFB nibble maps, as in crc_clmul on a CPU
+     * without AVX-512. Requires PCLMULQDQ and SSSE3.
+     */
+    CRC_DISPATCH_TIER_PCLMUL = 0x03,
+
+    /**
+     * As CRC_DISPATCH_TIER_PCLMUL, with 512-bit VPCLMULQDQ folding of long messages.
+     * Requires AVX-512F and VPCLMULQDQ in addition.
+     */
+    CRC_DISPATCH_TIER_AVX512 = 0x04
+} Crc_DispatchTierType;
+
+/**
+ * Tells whether a tier can be used on this CPU.
+ *
+ * @param Tier      The tier
+ * @return true if the tier is supported
+ */
+bool Crc_DispatchIsTierAvailable(Crc_DispatchTierType Tier);
+
+/**
+ * Binds the Crc_CalculateCRCxx functions to a tier. Must not be called while another
+ * thread calculates a CRC.
+ *
+ * @param Tier              The tier to use
+ * @return Std_ReturnType   E_OK if the tier was selected, E_NOT_OK if it is unknown or
+ *                          not supported by the CPU, the selected tier is then unchanged
+ */
+Std_ReturnType Crc_DispatchSelectTier(Crc_DispatchTierType Tier);
+
+/**
+ * Returns the tier the Crc_CalculateCRCxx functions are bound to.
+ *
+ * @return Crc_DispatchTierType     The selected tier
+ */
+Crc_DispatchTierType Crc_DispatchGetTier(void);
+
+#endif  // CRC_DISPATCH_H__
@@ -0,0 +1,201 @@
+#ifndef CRC_GENERIC_H__
+#define CRC_GENERIC_H__
+
+/**
+ * @file Crc_Generic.h
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief Runtime parameterized CRC calculation in the crc_generic library
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2021
+ *
+ * A CRC is described by its Rocksoft model parameters. Crc_InitDescriptor builds the
+ * slicing-by-8 lookup tables and the carry-less multiplication folding constants for
+ * the parameters once, after which Crc_CalculateGeneric uses the same kernels as
+ * crc_slice8 and crc_clmul. A new CRC, e.g. CRC-32C, needs a parameter set and a
+ * descriptor instead of new tables:
+ *
+ *   static const Crc_ParametersType crc32C = {32, 0x1EDC6F41, 0xFFFFFFFF, true, true, 0xFFFFFFFF};
+ *   static Crc_DescriptorType descriptor;
+ *
+ *   Crc_InitDescriptor(&descriptor, &crc32C);
+ *   uint32_t crc = (uint32_t)Crc_CalculateGeneric(&descriptor, data, length, 0, true);
+ *
+ * In crc_generic the Crc_CalculateCRCxx functions in Crc.h are wrappers over
+ * descriptors that are initialized once, by the first call for the CRC. They can
+ * be called from constructors and global initializers, and the tables of a CRC
+ * that is never calculated are never written.
+ *
+ * These functions are only implemented by crc_generic.
+ *
+ */
+
+#include "Std_Types.h"
+
+/**
+ * Rocksoft model parameters of a CRC
+ */
+typedef struct {
+    /**
+     * CRC result width in bits, 1 to 64
+     */
+    uint8_t Width;
+
+    /**
+     * Polynomial without the x^Width term, in normal (MSB first) bit order
+     */
+    uint64_t Polynomial;
+
+    /**
+     * Initial value, in normal bit order
+     */
+    uint64_t Initial;
+
+    /**
+     * Input data reflected
+     */
+    bool ReflectIn;
+
+    /**
+     * Result data reflected
+     */
+    bool ReflectOut;
+
+    /**
+     * XOR value applied to the result
+     */
+    uint64_t XorValue;
+} Crc_ParametersType;
+
+/**
+ * Folding and reduction constants for one CRC polynomial P of Width bits, used by the
+ * carry-less multiplication kernels of crc_clmul and crc_generic.
+ *
+ * For reflected CRCs all constants are 64-bit reflected polynomials, i.e. bit i holds
+ * the coefficient of x^(63-i), and the "- 1" in the exponents compensates for the
+ * product of two reflected 64-bit operands being one bit short of 128 bits.
+ * For normal CRCs bit i holds the coefficient of x^i and the exponents are used as they
+ * are, without "- 1".
+ */
+typedef struct {
+    /**
+     * Folds four 512-bit lanes at a time with VPCLMULQDQ, same layout as Fold512.
+     * Only used for reflected CRCs.
+     * Reflected: x^(2048+64-1) mod P and x^(2048-1) mod P
+     */
+    uint64_t Fold2048[2];
+
+    /**
+     * Folds four 128-bit lanes at a time. The first constant multiplies the low 64 bits
+     * of a lane, the second the high 64 bits.
+     * Reflected: x^(512+64-1) mod P and x^(512-1) mod P
+     * Normal: x^512 mod P and x^(512+64) mod P
+     */
+    uint64_t Fold512[2];
+
+    /**
+     * Folds one 128-bit lane at a time, same layout as Fold512.
+     * Reflected: x^(128+64-1) mod P and x^(128-1) mod P
+     * Normal: x^128 mod P and x^(128+64) mod P
+     */
+    uint64_t Fold128[2];
+
+    /**
+     * x^(64+Width-1) mod P (reflected) or x^(64+Width) mod P (normal), reduces the last
+     * 128 bits to 64+Width bits
+     */
+    uint64_t Reduce;
+
+    /**
+     * floor(x^(64+Width) / P) without its x^0 term (reflected) or its x^64 term (normal),
+     * the Barrett constant
+     */
+    uint64_t Mu;
+
+    /**
+     * P without its x^Width term
+     */
+    uint64_t Polynomial;
+
+    /**
+     * Width of the CRC in bits, 8 to 64
+     */
+    uint8_t Width;
+} Crc_FoldConstantsType;
+
+/**
+ * A CRC prepared for calculation by Crc_InitDescriptor. The members are private to
+ * crc_generic.
+ */
+typedef struct {
+    /**
+     * The parameters the descriptor was initialized with
+     */
+    Crc_ParametersType Parameters;
+
+    /**
+     * Slicing-by-8 tables. Table[0] is the byte-at-a-time table and Table[k] is Table[0]
+     * followed by k zero bytes. Reflected CRCs keep the remainder in the low Width bits,
+     * normal CRCs in the high Width bits.
+     */
+    uint64_t Table[8][256];
+
+    /**
+     * Carry-less multiplication constants, valid if UseFold is true
+     */
+    Crc_FoldConstantsType FoldConstants;
+
+    /**
+     * true if the carry-less multiplication kernels support the parameters
+     */
+    bool UseFold;
+} Crc_DescriptorType;
+
+/**
+ * Builds the lookup tables and folding constants of a CRC.
+ *
+ * @param Crc_Descriptor    The descriptor to initialize.
+ * @param Crc_Parameters    Parameters of the CRC.
+ * @return Std_ReturnType   E_OK if the descriptor was initialized, E_NOT_OK if a pointer is
+ *                          NULL, the width is not 1 to 64 or a parameter has bits above the
+ *                          width. The descriptor is then unchanged.
+ */
+Std_ReturnType Crc_InitDescriptor(Crc_DescriptorType* Crc_Descriptor, const Crc_ParametersType* Crc_Parameters);
+
+/**
+ * Calculates a CRC with the semantics of the Crc_CalculateCRCxx functions in Crc.h.
+ *
+ * @param Crc_Descriptor    An initialized descriptor.
+ * @param Crc_DataPtr       Pointer to start address of data block to be calculated.
+ * @param Crc_Length        Length of data block to be calculated in bytes.
+ * @param Crc_StartValue    Start value when the algorithm starts.
+ * @param Crc_IsFirstCall   TRUE: First call in a sequence or individual CRC calculation; start from
+ *                          initial value, ignore Crc_StartValue. FALSE: Subsequent call in a call
+ *                          sequence; Crc_StartValue is interpreted to be the return value of the
+ *                          previous function call.
+ * @return uint64_t         The CRC in the low Width bits
+ */
+uint64_t Crc_CalculateGeneric(const Crc_DescriptorType* Crc_Descriptor,
+                              const uint8_t* Crc_DataPtr,
+                              size_t Crc_Length,
+                              uint64_t Crc_StartValue,
+                              bool Crc_IsFirstCall);
+
+/**
+ * Divides data by the polynomial of a CRC. The CRC register is the CRC before the XOR
+ * value is applied, so Crc_CalculateGeneric of a message in parts is its initial value
+ * (or start value XOR the XOR value), updated with every part, XOR the XOR value.
+ *
+ * @param Crc_Descriptor    An initialized descriptor.
+ * @param Crc_Register      The CRC register in the low Width bits.
+ * @param Crc_DataPtr       Pointer to start address of data block to be calculated.
+ * @param Crc_Length        Length of data block to be calculated in bytes.
+ * @return uint64_t         The new CRC register in the low Width bits
+ */
+uint64_t Crc_UpdateGeneric(const Crc_DescriptorType* Crc_Descriptor,
+                           uint64_t Crc_Register,
+                           const uint8_t* Crc_DataPtr,
+                           size_t Crc_Length);
+
+#endif  // CRC_GENERIC_H__
@@ -0,0 +1,185 @@
+#ifndef CRC_PARALLEL_H__
+#define CRC_PARALLEL_H__
+
+/**
+ * @file Crc_Parallel.h
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief Multi-threaded CRC calculation of large messages
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2021
+ *
+ * The Crc_CalculateCRCxxParallel functions split a message into chunks, calculate the
+ * CRC of each chunk with Crc_CalculateCRCxx on a thread pool and merge the results with
+ * Crc_CombineCRCxx. The result is identical to a single Crc_CalculateCRCxx call over the
+ * whole message. Messages too short to be worth splitting are calculated on the calling
+ * thread.
+ *
+ * The thread pool is either provided by the caller through Crc_ParallelPoolType, or
+ * threads are started for the call and joined before it returns.
+ *
+ */
+
+#include "Std_Types.h"
+
+/**
+ * Default shortest chunk, in bytes, given to a thread. Starting and joining a thread
+ * costs about as much as calculating a CRC over this many bytes with the accelerated
+ * implementations.
+ */
+#ifndef CRC_PARALLEL_MIN_CHUNK_LENGTH
+#define CRC_PARALLEL_MIN_CHUNK_LENGTH 0x100000U
+#endif
+
+/**
+ * Largest number of chunks a message is split into
+ */
+#define CRC_PARALLEL_MAX_TASKS 64U
+
+/**
+ * A task run by a thread pool, Index tells the tasks of one Run call apart
+ */
+typedef void (*Crc_ParallelTaskType)(void* Argument, size_t Index);
+
+/**
+ * Thread pool used by the Crc_CalculateCRCxxParallel functions
+ */
+typedef struct {
+    /**
+     * Runs Task(Argument, Index) for every Index below Count, possibly in parallel, and
+     * returns when all of them have returned. NULL to start a thread per task for the call.
+     */
+    void (*Run)(void* Pool, Crc_ParallelTaskType Task, void* Argument, size_t Count);
+
+    /**
+     * Passed to Run unchanged
+     */
+    void* Pool;
+
+    /**
+     * Largest number of tasks to split a message into, usually the number of threads in
+     * the pool. 0 to use the number of online CPUs.
+     */
+    size_t Concurrency;
+
+    /**
+     * Shortest chunk of the message given to a task, in bytes. 0 to use
+     * CRC_PARALLEL_MIN_CHUNK_LENGTH.
+     */
+    size_t MinChunkLength;
+} Crc_ParallelPoolType;
+
+/**
+ * Calculates Crc_CalculateCRC8 over Crc_Length bytes using several threads.
+ *
+ * @param Crc_DataPtr       Pointer to start address of data block to be calculated.
+ * @param Crc_Length        Length of data block to be calculated in bytes.
+ * @param Crc_StartValue8   Start value when the algorithm starts, see Crc_CalculateCRC8.
+ * @param Crc_IsFirstCall   First call in a sequence, see Crc_CalculateCRC8.
+ * @param Crc_Pool          Thread pool to use, NULL to start a thread per online CPU.
+ * @return uint8_t
+ */
+uint8_t Crc_CalculateCRC8Parallel(const uint8_t* Crc_DataPtr,
+                                  size_t Crc_Length,
+                                  uint8_t Crc_StartValue8,
+                                  bool Crc_IsFirstCall,
+                                  const Crc_ParallelPoolType* Crc_Pool);
+
+/**
+ * Calculates Crc_CalculateCRC8H2F over Crc_Length bytes using several threads.
+ *
+ * @param Crc_DataPtr           Pointer to start address of data block to be calculated.
+ * @param Crc_Length            Length of data block to be calculated in bytes.
+ * @param Crc_StartValue8H2F    Start value when the algorithm starts, see Crc_CalculateCRC8H2F.
+ * @param Crc_IsFirstCall       First call in a sequence, see Crc_CalculateCRC8H2F.
+ * @param Crc_Pool              Thread pool to use, NULL to start a thread per online CPU.
+ * @return uint8_t
+ */
+uint8_t Crc_CalculateCRC8H2FParallel(const uint8_t* Crc_DataPtr,
+                                     size_t Crc_Length,
+                                     uint8_t Crc_StartValue8H2F,
+                                     bool Crc_IsFirstCall,
+                                     const Crc_ParallelPoolType* Crc_Pool);
+
+/**
+ * Calculates Crc_CalculateCRC16 over Crc_Length bytes using several threads.
+ *
+ * @param Crc_DataPtr       Pointer to start address of data block to be calculated.
+ * @param Crc_Length        Length of data block to be calculated in bytes.
+ * @param Crc_StartValue16  Start value when the algorithm starts, see Crc_CalculateCRC16.
+ * @param Crc_IsFirstCall   First call in a sequence, see Crc_CalculateCRC16.
+ * @param Crc_Pool          Thread pool to use, NULL to start a thread per online CPU.
+ * @return uint16_t
+ */
+uint16_t Crc_CalculateCRC16Parallel(const uint8_t* Crc_DataPtr,
+                                    size_t Crc_Length,
+                                    uint16_t Crc_StartValue16,
+                                    bool Crc_IsFirstCall,
+                                    const Crc_ParallelPoolType* Crc_Pool);
+
+/**
+ * Calculates Crc_CalculateCRC16ARC over Crc_Length bytes using several threads.
+ *
+ * @param Crc_DataPtr       Pointer to start address of data block to be calculated.
+ * @param Crc_Length        Length of data block to be calculated in bytes.
+ * @param Crc_StartValue16  Start value when the algorithm starts, see Crc_CalculateCRC16ARC.
+ * @param Crc_IsFirstCall   First call in a sequence, see Crc_CalculateCRC16ARC.
+ * @param Crc_Pool          Thread pool to use, NULL to start a thread per online CPU.
+ * @return uint16_t
+ */
+uint16_t Crc_CalculateCRC16ARCParallel(const uint8_t* Crc_DataPtr,
+                                       size_t Crc_Length,
+                                       uint16_t Crc_StartValue16,
+                                       bool Crc_IsFirstCall,
+                                       const Crc_ParallelPoolType* Crc_Pool);
+
+/**
+ * Calculates Crc_CalculateCRC32 over Crc_Length bytes using several threads.
+ *
+ * @param Crc_DataPtr       Pointer to start address of data block to be calculated.
+ * @param Crc_Length        Length of data block to be calculated in bytes.
+ * @param Crc_StartValue32  Start value when the algorithm starts, see Crc_CalculateCRC32.
+ * @param Crc_IsFirstCall   First call in a sequence, see Crc_CalculateCRC32.
+ * @param Crc_Pool          Thread pool to use, NULL to start a thread per online CPU.
+ * @return uint32_t
+ */
+uint32_t Crc_CalculateCRC32Parallel(const uint8_t* Crc_DataPtr,
+                                    size_t Crc_Length,
+                                    uint32_t Crc_StartValue32,
+                                    bool Crc_IsFirstCall,
+                                    const Crc_ParallelPoolType* Crc_Pool);
+
+/**
+ * Calculates Crc_CalculateCRC32P4 over Crc_Length bytes using several threads.
+ *
+ * @param Crc_DataPtr       Pointer to start address of data block to be calculated.
+ * @param Crc_Length        Length of data block to be calculated in bytes.
+ * @param Crc_StartValue32  Start value when the algorithm starts, see Crc_CalculateCRC32P4.
+ * @param Crc_IsFirstCall   First call in a sequence, see Crc_CalculateCRC32P4.
+ * @param Crc_Pool          Thread pool to use, NULL to start a thread per online CPU.
+ * @return uint32_t
+ */
+uint32_t Crc_CalculateCRC32P4Parallel(const uint8_t* Crc_DataPtr,
+                                      size_t Crc_Length,
+                                      uint32_t Crc_StartValue32,
+                                      bool Crc_IsFirstCall,
+                                      const Crc_ParallelPoolType* Crc_Pool);
+
+/**
+ * Calculates Crc_CalculateCRC64 over Crc_Length bytes using several threads.
+ *
+ * @param Crc_DataPtr       Pointer to start address of data block to be calculated.
+ * @param Crc_Length        Length of data block to be calculated in bytes.
+ * @param Crc_StartValue64  Start value when the algorithm starts, see Crc_CalculateCRC64.
+ * @param Crc_IsFirstCall   First call in a sequence, see Crc_CalculateCRC64.
+ * @param Crc_Pool          Thread pool to use, NULL to start a thread per online CPU.
+ * @return uint64_t
+ */
+uint64_t Crc_CalculateCRC64Parallel(const uint8_t* Crc_DataPtr,
+                                    size_t Crc_Length,
+                                    uint64_t Crc_StartValue64,
+                                    bool Crc_IsFirstCall,
+                                    const Crc_ParallelPoolType* Crc_Pool);
+
+#endif  // CRC_PARALLEL_H__
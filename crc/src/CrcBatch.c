@@ -0,0 +1,816 @@
+/**
+ * @file CrcBatch.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * Batch calculation, see Crc.h. This file is part of every CRC library.
+ *
+ * Byte-wise CRC calculation is limited by the latency of one table lookup
+ * per byte, since each lookup depends on the previous one. Calculating
+ * several independent messages side by side hides that latency.
+ *
+ * The byte-wise table T of the algorithm is linear, T[n] = T[n & 0x0F] ^
+ * T[n & 0xF0], so two 16-entry tables are enough. With SSSE3, 16 messages
+ * are calculated at once, one per byte lane. The CRC registers are split
+ * into byte planes, plane j holding byte j of every register, and each
+ * 16-entry table is split the same way so that a lookup for all lanes is
+ * one PSHUFB per plane. The messages are read 16 bytes at a time and
+ * transposed so that one vector holds the next byte of every message.
+ * Lanes whose message has ended keep their register.
+ *
+ * Without SSSE3, or when only a few messages are left, four messages are
+ * calculated in an interleaved scalar loop with the same tables.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "Crc.h"
+
+#include <string.h>
+
+/*
+ * Messages calculated at once in SIMD lanes and in the scalar loop.
+ */
+#define CRC_BATCH_LANES 16U
+#define CRC_BATCH_SCALAR_STREAMS 4U
+
+/*
+ * Fewest messages for which the SIMD lanes are used, the scalar loop is
+ * faster for fewer.
+ */
+#define CRC_BATCH_MIN_LANE_STREAMS 4U
+
+#define CRC_BATCH_INLINE __attribute__((always_inline)) inline
+
+typedef struct {
+    /**
+     * T[n] and T[n << 4] for n below 16, T being the byte-wise lookup table
+     */
+    uint64_t Low[16];
+    uint64_t High[16];
+
+    /**
+     * Low and High split into byte planes, plane j holds byte j of every entry
+     */
+    struct {
+        uint8_t Low[8][16];
+        uint8_t High[8][16];
+    } Planes;
+
+    uint64_t Initial;
+    uint64_t XorValue;
+    uint8_t Width;
+    bool Reflected;
+} CrcBatch_ParametersType;
+
+static const CrcBatch_ParametersType crc8Parameters = {
+    .Low = {
+        0x00, 0x1D, 0x3A, 0x27, 0x74, 0x69, 0x4E, 0x53,
+        0xE8, 0xF5, 0xD2, 0xCF, 0x9C, 0x81, 0xA6, 0xBB
+    },
+    .High = {
+        0x00, 0xCD, 0x87, 0x4A, 0x13, 0xDE, 0x94, 0x59,
+        0x26, 0xEB, 0xA1, 0x6C, 0x35, 0xF8, 0xB2, 0x7F
+    },
+    .Planes = {
+        .Low = {
+            {0x00, 0x1D, 0x3A, 0x27, 0x74, 0x69, 0x4E, 0x53, 0xE8, 0xF5, 0xD2, 0xCF, 0x9C, 0x81, 0xA6, 0xBB}
+        },
+        .High = {
+            {0x00, 0xCD, 0x87, 0x4A, 0x13, 0xDE, 0x94, 0x59, 0x26, 0xEB, 0xA1, 0x6C, 0x35, 0xF8, 0xB2, 0x7F}
+        }
+    },
+    .Initial = 0xFF,
+    .XorValue = 0xFF,
+    .Width = 8,
+    .Reflected = false
+};
+
+static const CrcBatch_ParametersType crc8H2FParameters = {
+    .Low = {
+        0x00, 0x2F, 0x5E, 0x71, 0xBC, 0x93, 0xE2, 0xCD,
+        0x57, 0x78, 0x09, 0x26, 0xEB, 0xC4, 0xB5, 0x9A
+    },
+    .High = {
+        0x00, 0xAE, 0x73, 0xDD, 0xE6, 0x48, 0x95, 0x3B,
+        0xE3, 0x4D, 0x90, 0x3E, 0x05, 0xAB, 0x76, 0xD8
+    },
+    .Planes = {
+        .Low = {
+            {0x00, 0x2F, 0x5E, 0x71, 0xBC, 0x93, 0xE2, 0xCD, 0x57, 0x78, 0x09, 0x26, 0xEB, 0xC4, 0xB5, 0x9A}
+        },
+        .High = {
+            {0x00, 0xAE, 0x73, 0xDD, 0xE6, 0x48, 0x95, 0x3B, 0xE3, 0x4D, 0x90, 0x3E, 0x05, 0xAB, 0x76, 0xD8}
+        }
+    },
+    .Initial = 0xFF,
+    .XorValue = 0xFF,
+    .Width = 8,
+    .Reflected = false
+};
+
+static const CrcBatch_ParametersType crc16Parameters = {
+    .Low = {
+        0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+        0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+    },
+    .High = {
+        0x0000, 0x1231, 0x2462, 0x3653, 0x48C4, 0x5AF5, 0x6CA6, 0x7E97,
+        0x9188, 0x83B9, 0xB5EA, 0xA7DB, 0xD94C, 0xCB7D, 0xFD2E, 0xEF1F
+    },
+    .Planes = {
+        .Low = {
+            {0x00, 0x21, 0x42, 0x63, 0x84, 0xA5, 0xC6, 0xE7, 0x08, 0x29, 0x4A, 0x6B, 0x8C, 0xAD, 0xCE, 0xEF},
+            {0x00, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x81, 0x91, 0xA1, 0xB1, 0xC1, 0xD1, 0xE1, 0xF1}
+        },
+        .High = {
+            {0x00, 0x31, 0x62, 0x53, 0xC4, 0xF5, 0xA6, 0x97, 0x88, 0xB9, 0xEA, 0xDB, 0x4C, 0x7D, 0x2E, 0x1F},
+            {0x00, 0x12, 0x24, 0x36, 0x48, 0x5A, 0x6C, 0x7E, 0x91, 0x83, 0xB5, 0xA7, 0xD9, 0xCB, 0xFD, 0xEF}
+        }
+    },
+    .Initial = 0xFFFF,
+    .XorValue = 0x0,
+    .Width = 16,
+    .Reflected = false
+};
+
+static const CrcBatch_ParametersType crc16ARCParameters = {
+    .Low = {
+        0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241,
+        0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440
+    },
+    .High = {
+        0x0000, 0xCC01, 0xD801, 0x1400, 0xF001, 0x3C00, 0x2800, 0xE401,
+        0xA001, 0x6C00, 0x7800, 0xB401, 0x5000, 0x9C01, 0x8801, 0x4400
+    },
+    .Planes = {
+        .Low = {
+            {0x00, 0xC1, 0x81, 0x40, 0x01, 0xC0, 0x80, 0x41, 0x01, 0xC0, 0x80, 0x41, 0x00, 0xC1, 0x81, 0x40},
+            {0x00, 0xC0, 0xC1, 0x01, 0xC3, 0x03, 0x02, 0xC2, 0xC6, 0x06, 0x07, 0xC7, 0x05, 0xC5, 0xC4, 0x04}
+        },
+        .High = {
+            {0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00},
+            {0x00, 0xCC, 0xD8, 0x14, 0xF0, 0x3C, 0x28, 0xE4, 0xA0, 0x6C, 0x78, 0xB4, 0x50, 0x9C, 0x88, 0x44}
+        }
+    },
+    .Initial = 0x0,
+    .XorValue = 0x0,
+    .Width = 16,
+    .Reflected = true
+};
+
+static const CrcBatch_ParametersType crc32Parameters = {
+    .Low = {
+        0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
+        0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91
+    },
+    .High = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+    },
+    .Planes = {
+        .Low = {
+            {0x00, 0x96, 0x2C, 0xBA, 0x19, 0x8F, 0x35, 0xA3, 0x32, 0xA4, 0x1E, 0x88, 0x2B, 0xBD, 0x07, 0x91},
+            {0x00, 0x30, 0x61, 0x51, 0xC4, 0xF4, 0xA5, 0x95, 0x88, 0xB8, 0xE9, 0xD9, 0x4C, 0x7C, 0x2D, 0x1D},
+            {0x00, 0x07, 0x0E, 0x09, 0x6D, 0x6A, 0x63, 0x64, 0xDB, 0xDC, 0xD5, 0xD2, 0xB6, 0xB1, 0xB8, 0xBF},
+            {0x00, 0x77, 0xEE, 0x99, 0x07, 0x70, 0xE9, 0x9E, 0x0E, 0x79, 0xE0, 0x97, 0x09, 0x7E, 0xE7, 0x90}
+        },
+        .High = {
+            {0x00, 0x64, 0xC8, 0xAC, 0x90, 0xF4, 0x58, 0x3C, 0x20, 0x44, 0xE8, 0x8C, 0xB0, 0xD4, 0x78, 0x1C},
+            {0x00, 0x10, 0x20, 0x30, 0x41, 0x51, 0x61, 0x71, 0x83, 0x93, 0xA3, 0xB3, 0xC2, 0xD2, 0xE2, 0xF2},
+            {0x00, 0xB7, 0x6E, 0xD9, 0xDC, 0x6B, 0xB2, 0x05, 0xB8, 0x0F, 0xD6, 0x61, 0x64, 0xD3, 0x0A, 0xBD},
+            {0x00, 0x1D, 0x3B, 0x26, 0x76, 0x6B, 0x4D, 0x50, 0xED, 0xF0, 0xD6, 0xCB, 0x9B, 0x86, 0xA0, 0xBD}
+        }
+    },
+    .Initial = 0xFFFFFFFF,
+    .XorValue = 0xFFFFFFFF,
+    .Width = 32,
+    .Reflected = true
+};
+
+static const CrcBatch_ParametersType crc32P4Parameters = {
+    .Low = {
+        0x00000000, 0x30850FF5, 0x610A1FEA, 0x518F101F, 0xC2143FD4, 0xF2913021, 0xA31E203E, 0x939B2FCB,
+        0x159615F7, 0x25131A02, 0x749C0A1D, 0x441905E8, 0xD7822A23, 0xE70725D6, 0xB68835C9, 0x860D3A3C
+    },
+    .High = {
+        0x00000000, 0x2B2C2BEE, 0x565857DC, 0x7D747C32, 0xACB0AFB8, 0x879C8456, 0xFAE8F864, 0xD1C4D38A,
+        0xC8DF352F, 0xE3F31EC1, 0x9E8762F3, 0xB5AB491D, 0x646F9A97, 0x4F43B179, 0x3237CD4B, 0x191BE6A5
+    },
+    .Planes = {
+        .Low = {
+            {0x00, 0xF5, 0xEA, 0x1F, 0xD4, 0x21, 0x3E, 0xCB, 0xF7, 0x02, 0x1D, 0xE8, 0x23, 0xD6, 0xC9, 0x3C},
+            {0x00, 0x0F, 0x1F, 0x10, 0x3F, 0x30, 0x20, 0x2F, 0x15, 0x1A, 0x0A, 0x05, 0x2A, 0x25, 0x35, 0x3A},
+            {0x00, 0x85, 0x0A, 0x8F, 0x14, 0x91, 0x1E, 0x9B, 0x96, 0x13, 0x9C, 0x19, 0x82, 0x07, 0x88, 0x0D},
+            {0x00, 0x30, 0x61, 0x51, 0xC2, 0xF2, 0xA3, 0x93, 0x15, 0x25, 0x74, 0x44, 0xD7, 0xE7, 0xB6, 0x86}
+        },
+        .High = {
+            {0x00, 0xEE, 0xDC, 0x32, 0xB8, 0x56, 0x64, 0x8A, 0x2F, 0xC1, 0xF3, 0x1D, 0x97, 0x79, 0x4B, 0xA5},
+            {0x00, 0x2B, 0x57, 0x7C, 0xAF, 0x84, 0xF8, 0xD3, 0x35, 0x1E, 0x62, 0x49, 0x9A, 0xB1, 0xCD, 0xE6},
+            {0x00, 0x2C, 0x58, 0x74, 0xB0, 0x9C, 0xE8, 0xC4, 0xDF, 0xF3, 0x87, 0xAB, 0x6F, 0x43, 0x37, 0x1B},
+            {0x00, 0x2B, 0x56, 0x7D, 0xAC, 0x87, 0xFA, 0xD1, 0xC8, 0xE3, 0x9E, 0xB5, 0x64, 0x4F, 0x32, 0x19}
+        }
+    },
+    .Initial = 0xFFFFFFFF,
+    .XorValue = 0xFFFFFFFF,
+    .Width = 32,
+    .Reflected = true
+};
+
+static const CrcBatch_ParametersType crc64Parameters = {
+    .Low = {
+        0x0000000000000000, 0xB32E4CBE03A75F6F, 0xF4843657A840A05B, 0x47AA7AE9ABE7FF34, 0x7BD0C384FF8F5E33, 0xC8FE8F3AFC28015C, 0x8F54F5D357CFFE68, 0x3C7AB96D5468A107,
+        0xF7A18709FF1EBC66, 0x448FCBB7FCB9E309, 0x0325B15E575E1C3D, 0xB00BFDE054F94352, 0x8C71448D0091E255, 0x3F5F08330336BD3A, 0x78F572DAA8D1420E, 0xCBDB3E64AB761D61
+    },
+    .High = {
+        0x0000000000000000, 0x7D9BA13851336649, 0xFB374270A266CC92, 0x86ACE348F355AADB, 0x64B62BCAEBC387A1, 0x192D8AF2BAF0E1E8, 0x9F8169BA49A54B33, 0xE21AC88218962D7A,
+        0xC96C5795D7870F42, 0xB4F7F6AD86B4690B, 0x325B15E575E1C3D0, 0x4FC0B4DD24D2A599, 0xADDA7C5F3C4488E3, 0xD041DD676D77EEAA, 0x56ED3E2F9E224471, 0x2B769F17CF112238
+    },
+    .Planes = {
+        .Low = {
+            {0x00, 0x6F, 0x5B, 0x34, 0x33, 0x5C, 0x68, 0x07, 0x66, 0x09, 0x3D, 0x52, 0x55, 0x3A, 0x0E, 0x61},
+            {0x00, 0x5F, 0xA0, 0xFF, 0x5E, 0x01, 0xFE, 0xA1, 0xBC, 0xE3, 0x1C, 0x43, 0xE2, 0xBD, 0x42, 0x1D},
+            {0x00, 0xA7, 0x40, 0xE7, 0x8F, 0x28, 0xCF, 0x68, 0x1E, 0xB9, 0x5E, 0xF9, 0x91, 0x36, 0xD1, 0x76},
+            {0x00, 0x03, 0xA8, 0xAB, 0xFF, 0xFC, 0x57, 0x54, 0xFF, 0xFC, 0x57, 0x54, 0x00, 0x03, 0xA8, 0xAB},
+            {0x00, 0xBE, 0x57, 0xE9, 0x84, 0x3A, 0xD3, 0x6D, 0x09, 0xB7, 0x5E, 0xE0, 0x8D, 0x33, 0xDA, 0x64},
+            {0x00, 0x4C, 0x36, 0x7A, 0xC3, 0x8F, 0xF5, 0xB9, 0x87, 0xCB, 0xB1, 0xFD, 0x44, 0x08, 0x72, 0x3E},
+            {0x00, 0x2E, 0x84, 0xAA, 0xD0, 0xFE, 0x54, 0x7A, 0xA1, 0x8F, 0x25, 0x0B, 0x71, 0x5F, 0xF5, 0xDB},
+            {0x00, 0xB3, 0xF4, 0x47, 0x7B, 0xC8, 0x8F, 0x3C, 0xF7, 0x44, 0x03, 0xB0, 0x8C, 0x3F, 0x78, 0xCB}
+        },
+        .High = {
+            {0x00, 0x49, 0x92, 0xDB, 0xA1, 0xE8, 0x33, 0x7A, 0x42, 0x0B, 0xD0, 0x99, 0xE3, 0xAA, 0x71, 0x38},
+            {0x00, 0x66, 0xCC, 0xAA, 0x87, 0xE1, 0x4B, 0x2D, 0x0F, 0x69, 0xC3, 0xA5, 0x88, 0xEE, 0x44, 0x22},
+            {0x00, 0x33, 0x66, 0x55, 0xC3, 0xF0, 0xA5, 0x96, 0x87, 0xB4, 0xE1, 0xD2, 0x44, 0x77, 0x22, 0x11},
+            {0x00, 0x51, 0xA2, 0xF3, 0xEB, 0xBA, 0x49, 0x18, 0xD7, 0x86, 0x75, 0x24, 0x3C, 0x6D, 0x9E, 0xCF},
+            {0x00, 0x38, 0x70, 0x48, 0xCA, 0xF2, 0xBA, 0x82, 0x95, 0xAD, 0xE5, 0xDD, 0x5F, 0x67, 0x2F, 0x17},
+            {0x00, 0xA1, 0x42, 0xE3, 0x2B, 0x8A, 0x69, 0xC8, 0x57, 0xF6, 0x15, 0xB4, 0x7C, 0xDD, 0x3E, 0x9F},
+            {0x00, 0x9B, 0x37, 0xAC, 0xB6, 0x2D, 0x81, 0x1A, 0x6C, 0xF7, 0x5B, 0xC0, 0xDA, 0x41, 0xED, 0x76},
+            {0x00, 0x7D, 0xFB, 0x86, 0x64, 0x19, 0x9F, 0xE2, 0xC9, 0xB4, 0x32, 0x4F, 0xAD, 0xD0, 0x56, 0x2B}
+        }
+    },
+    .Initial = 0xFFFFFFFFFFFFFFFF,
+    .XorValue = 0xFFFFFFFFFFFFFFFF,
+    .Width = 64,
+    .Reflected = true
+};
+
+CRC_BATCH_INLINE
+static uint64_t step(uint64_t remainder, uint8_t data, const CrcBatch_ParametersType* parameters) {
+    if (parameters->Reflected) {
+        const uint8_t index = (uint8_t)(remainder ^ data);
+        return parameters->Low[index & 0x0F] ^ parameters->High[index >> 4] ^ (remainder >> 8);
+    }
+
+    const uint64_t widthMask = (parameters->Width < 64) ? ((1ULL << parameters->Width) - 1) : ~0ULL;
+    const uint8_t index = (uint8_t)((remainder >> (parameters->Width - 8)) ^ data);
+    return parameters->Low[index & 0x0F] ^ parameters->High[index >> 4] ^ ((remainder << 8) & widthMask);
+}
+
+/*
+ * Calculates up to CRC_BATCH_SCALAR_STREAMS messages, interleaved for as
+ * long as all of them have data.
+ */
+CRC_BATCH_INLINE
+static void calculateInterleaved(const uint8_t* const dataPtrs[],
+                                 const uint32_t lengths[],
+                                 uint64_t remainders[],
+                                 size_t count,
+                                 const CrcBatch_ParametersType* parameters) {
+    uint32_t commonLength = 0;
+
+    if (count == CRC_BATCH_SCALAR_STREAMS) {
+        commonLength = lengths[0];
+        for (size_t stream = 1; stream < count; ++stream) {
+            if (lengths[stream] < commonLength) {
+                commonLength = lengths[stream];
+            }
+        }
+
+        uint64_t remainder0 = remainders[0];
+        uint64_t remainder1 = remainders[1];
+        uint64_t remainder2 = remainders[2];
+        uint64_t remainder3 = remainders[3];
+
+        for (uint32_t byte = 0; byte < commonLength; ++byte) {
+            remainder0 = step(remainder0, dataPtrs[0][byte], parameters);
+            remainder1 = step(remainder1, dataPtrs[1][byte], parameters);
+            remainder2 = step(remainder2, dataPtrs[2][byte], parameters);
+            remainder3 = step(remainder3, dataPtrs[3][byte], parameters);
+        }
+
+        remainders[0] = remainder0;
+        remainders[1] = remainder1;
+        remainders[2] = remainder2;
+        remainders[3] = remainder3;
+    }
+
+    for (size_t stream = 0; stream < count; ++stream) {
+        for (uint32_t byte = commonLength; byte < lengths[stream]; ++byte) {
+            remainders[stream] = step(remainders[stream], dataPtrs[stream][byte], parameters);
+        }
+    }
+}
+
+#if defined(__x86_64__)
+
+#include <immintrin.h>
+
+#define CRC_BATCH_SSSE3_TARGET __attribute__((target("ssse3")))
+#define CRC_BATCH_SSSE3_INLINE __attribute__((target("ssse3"), always_inline)) inline
+
+/*
+ * &shiftMasks[16 - n] is a PSHUFB mask that moves the last n bytes of a
+ * vector to the start and clears the other bytes.
+ */
+static const int8_t shiftMasks[32] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128
+};
+
+CRC_BATCH_INLINE
+static uint64_t load64(const uint8_t* data) {
+    uint64_t value = 0;
+    memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+CRC_BATCH_INLINE
+static uint32_t load32(const uint8_t* data) {
+    uint32_t value = 0;
+    memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+/*
+ * Loads the remaining length (1 to 15) bytes of a message followed by zeros,
+ * without reading outside the message. Messages of at least 16 bytes are
+ * loaded with one vector ending at the end of the message. Shorter messages
+ * are loaded as two overlapping 8 or 4 byte halves, the first one starting
+ * at data and the second one ending at the end of the message.
+ */
+CRC_BATCH_SSSE3_INLINE
+static __m128i loadPartial(const uint8_t* data, uint32_t length, uint32_t messageLength) {
+    if (messageLength >= 16) {
+        const __m128i block = _mm_loadu_si128((const __m128i*)&data[(int32_t)length - 16]);
+        return _mm_shuffle_epi8(block, _mm_loadu_si128((const __m128i*)&shiftMasks[16 - length]));
+    }
+
+    __m128i halves;
+    uint32_t halfLength;
+    if (length >= 8) {
+        halves = _mm_set_epi64x((long long)load64(&data[length - 8]), (long long)load64(data));
+        halfLength = 8;
+    } else if (length >= 4) {
+        halves = _mm_set_epi32(0, 0, (int)load32(&data[length - 4]), (int)load32(data));
+        halfLength = 4;
+    } else {
+        halves = _mm_cvtsi32_si128((int)(data[0] | ((uint32_t)data[length / 2] << 8) | ((uint32_t)data[length - 1] << 16)));
+        halfLength = 3;
+    }
+
+    /*
+     * Byte i < length is at position i in the first half and at position
+     * i + 2 * halfLength - length in the second half.
+     */
+    const __m128i positions = _mm_set_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    const __m128i inSecondHalf = _mm_cmpgt_epi8(positions, _mm_set1_epi8((char)(halfLength - 1)));
+    const __m128i pastEnd = _mm_cmpgt_epi8(positions, _mm_set1_epi8((char)(length - 1)));
+    __m128i mask = _mm_add_epi8(positions, _mm_and_si128(inSecondHalf, _mm_set1_epi8((char)(2 * halfLength - length))));
+    mask = _mm_or_si128(mask, pastEnd);
+
+    if (halfLength == 3) {
+        /*
+         * The three bytes are data[0], data[length / 2] and data[length - 1],
+         * which are the message itself for lengths 1 to 3.
+         */
+        mask = _mm_or_si128(positions, pastEnd);
+    }
+
+    return _mm_shuffle_epi8(halves, mask);
+}
+
+/*
+ * One round of the transposition, interleaving the bytes of row i and
+ * row i + 8 into rows 2i and 2i + 1.
+ */
+CRC_BATCH_SSSE3_INLINE
+static void interleaveRows(const __m128i rows[16], __m128i interleaved[16]) {
+    interleaved[0] = _mm_unpacklo_epi8(rows[0], rows[8]);
+    interleaved[1] = _mm_unpackhi_epi8(rows[0], rows[8]);
+    interleaved[2] = _mm_unpacklo_epi8(rows[1], rows[9]);
+    interleaved[3] = _mm_unpackhi_epi8(rows[1], rows[9]);
+    interleaved[4] = _mm_unpacklo_epi8(rows[2], rows[10]);
+    interleaved[5] = _mm_unpackhi_epi8(rows[2], rows[10]);
+    interleaved[6] = _mm_unpacklo_epi8(rows[3], rows[11]);
+    interleaved[7] = _mm_unpackhi_epi8(rows[3], rows[11]);
+    interleaved[8] = _mm_unpacklo_epi8(rows[4], rows[12]);
+    interleaved[9] = _mm_unpackhi_epi8(rows[4], rows[12]);
+    interleaved[10] = _mm_unpacklo_epi8(rows[5], rows[13]);
+    interleaved[11] = _mm_unpackhi_epi8(rows[5], rows[13]);
+    interleaved[12] = _mm_unpacklo_epi8(rows[6], rows[14]);
+    interleaved[13] = _mm_unpackhi_epi8(rows[6], rows[14]);
+    interleaved[14] = _mm_unpacklo_epi8(rows[7], rows[15]);
+    interleaved[15] = _mm_unpackhi_epi8(rows[7], rows[15]);
+}
+
+/*
+ * Transposes a 16x16 byte matrix, rows[i] byte j becomes rows[j] byte i.
+ * Four interleaving rounds move every byte to its place.
+ */
+CRC_BATCH_SSSE3_INLINE
+static void transpose(__m128i rows[16]) {
+    __m128i interleaved[16];
+
+    interleaveRows(rows, interleaved);
+    interleaveRows(interleaved, rows);
+    interleaveRows(rows, interleaved);
+    interleaveRows(interleaved, rows);
+}
+
+/*
+ * Splits the registers of count lanes into planeCount byte planes. Wide
+ * registers are transposed as a byte matrix, row i of which then holds
+ * byte i of every register. Narrow registers are split byte by byte,
+ * which is cheaper than a whole transposition.
+ */
+CRC_BATCH_SSSE3_INLINE
+static void loadPlanes(const uint64_t remainders[], size_t count, __m128i planes[], size_t planeCount) {
+    if (planeCount > 2) {
+        __m128i registers[CRC_BATCH_LANES];
+
+        for (size_t stream = 0; stream < CRC_BATCH_LANES; ++stream) {
+            registers[stream] = (stream < count) ? _mm_loadl_epi64((const __m128i*)&remainders[stream])
+                                                 : _mm_setzero_si128();
+        }
+
+        transpose(registers);
+
+        for (size_t plane = 0; plane < planeCount; ++plane) {
+            planes[plane] = registers[plane];
+        }
+    } else {
+        uint8_t registerBytes[2][CRC_BATCH_LANES] = {{0}};
+
+        for (size_t stream = 0; stream < count; ++stream) {
+            for (size_t plane = 0; plane < planeCount; ++plane) {
+                registerBytes[plane][stream] = (uint8_t)(remainders[stream] >> (8 * plane));
+            }
+        }
+
+        for (size_t plane = 0; plane < planeCount; ++plane) {
+            planes[plane] = _mm_loadu_si128((const __m128i*)registerBytes[plane]);
+        }
+    }
+}
+
+/*
+ * Merges the byte planes back into the registers of count lanes, the
+ * inverse of loadPlanes.
+ */
+CRC_BATCH_SSSE3_INLINE
+static void storePlanes(const __m128i planes[], size_t planeCount, uint64_t remainders[], size_t count) {
+    if (planeCount > 2) {
+        __m128i registers[CRC_BATCH_LANES];
+
+        for (size_t plane = 0; plane < CRC_BATCH_LANES; ++plane) {
+            registers[plane] = (plane < planeCount) ? planes[plane] : _mm_setzero_si128();
+        }
+
+        transpose(registers);
+
+        for (size_t stream = 0; stream < count; ++stream) {
+            _mm_storel_epi64((__m128i*)&remainders[stream], registers[stream]);
+        }
+    } else {
+        uint8_t registerBytes[2][CRC_BATCH_LANES];
+
+        for (size_t plane = 0; plane < planeCount; ++plane) {
+            _mm_storeu_si128((__m128i*)registerBytes[plane], planes[plane]);
+        }
+
+        for (size_t stream = 0; stream < count; ++stream) {
+            uint64_t remainder = 0;
+            for (size_t plane = 0; plane < planeCount; ++plane) {
+                remainder |= (uint64_t)registerBytes[plane][stream] << (8 * plane);
+            }
+            remainders[stream] = remainder;
+        }
+    }
+}
+
+/*
+ * Calculates the next byte of every lane. The lanes not set in active keep
+ * their register.
+ */
+CRC_BATCH_SSSE3_INLINE
+static void stepLanes(__m128i planes[],
+                      __m128i data,
+                      __m128i active,
+                      const __m128i low[],
+                      const __m128i high[],
+                      size_t planeCount,
+                      bool reflected) {
+    const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+    const __m128i index = _mm_xor_si128(planes[reflected ? 0 : (planeCount - 1)], data);
+    const __m128i lowIndex = _mm_and_si128(index, nibbleMask);
+    const __m128i highIndex = _mm_and_si128(_mm_srli_epi16(index, 4), nibbleMask);
+    __m128i next[8];
+
+    /*
+     * Reflected registers move one plane down per byte, normal registers
+     * one plane up.
+     */
+    for (size_t plane = 0; plane < planeCount; ++plane) {
+        next[plane] = _mm_xor_si128(_mm_shuffle_epi8(low[plane], lowIndex), _mm_shuffle_epi8(high[plane], highIndex));
+
+        if (reflected && ((plane + 1) < planeCount)) {
+            next[plane] = _mm_xor_si128(next[plane], planes[plane + 1]);
+        } else if (!reflected && (plane > 0)) {
+            next[plane] = _mm_xor_si128(next[plane], planes[plane - 1]);
+        }
+    }
+
+    for (size_t plane = 0; plane < planeCount; ++plane) {
+        planes[plane] = _mm_or_si128(_mm_and_si128(active, next[plane]), _mm_andnot_si128(active, planes[plane]));
+    }
+}
+
+CRC_BATCH_SSSE3_INLINE
+static void calculateLanesFor(const uint8_t* const dataPtrs[],
+                              const uint32_t lengths[],
+                              uint64_t remainders[],
+                              size_t count,
+                              const CrcBatch_ParametersType* parameters,
+                              size_t planeCount,
+                              bool reflected) {
+    __m128i low[8];
+    __m128i high[8];
+    __m128i planes[8];
+    uint32_t maxLength = 0;
+
+    for (size_t stream = 0; stream < count; ++stream) {
+        if (lengths[stream] > maxLength) {
+            maxLength = lengths[stream];
+        }
+    }
+
+    loadPlanes(remainders, count, planes, planeCount);
+
+    for (size_t plane = 0; plane < planeCount; ++plane) {
+        low[plane] = _mm_loadu_si128((const __m128i*)parameters->Planes.Low[plane]);
+        high[plane] = _mm_loadu_si128((const __m128i*)parameters->Planes.High[plane]);
+    }
+
+    for (uint32_t offset = 0; offset < maxLength; offset += CRC_BATCH_LANES) {
+        __m128i rows[CRC_BATCH_LANES];
+        uint8_t remaining[CRC_BATCH_LANES];
+
+        uint32_t blockLength = 0;
+        bool complete = true;
+
+        for (size_t stream = 0; stream < CRC_BATCH_LANES; ++stream) {
+            const uint32_t length = ((stream < count) && (lengths[stream] > offset)) ? (lengths[stream] - offset) : 0;
+
+            if (length >= CRC_BATCH_LANES) {
+                rows[stream] = _mm_loadu_si128((const __m128i*)&dataPtrs[stream][offset]);
+                remaining[stream] = CRC_BATCH_LANES;
+            } else {
+                rows[stream] = (length > 0) ? loadPartial(&dataPtrs[stream][offset], length, lengths[stream])
+                                            : _mm_setzero_si128();
+                remaining[stream] = (uint8_t)length;
+                complete = false;
+            }
+
+            if (remaining[stream] > blockLength) {
+                blockLength = remaining[stream];
+            }
+        }
+
+        transpose(rows);
+
+        if (complete) {
+            const __m128i allActive = _mm_set1_epi8(-1);
+
+            for (size_t byte = 0; byte < CRC_BATCH_LANES; ++byte) {
+                stepLanes(planes, rows[byte], allActive, low, high, planeCount, reflected);
+            }
+        } else {
+            const __m128i remainingLengths = _mm_loadu_si128((const __m128i*)remaining);
+
+            for (size_t byte = 0; byte < blockLength; ++byte) {
+                const __m128i active = _mm_cmpgt_epi8(remainingLengths, _mm_set1_epi8((char)byte));
+                stepLanes(planes, rows[byte], active, low, high, planeCount, reflected);
+            }
+        }
+    }
+
+    storePlanes(planes, planeCount, remainders, count);
+}
+
+/*
+ * Calculates up to CRC_BATCH_LANES messages in SIMD lanes, with the loops
+ * over the register planes unrolled for each width.
+ */
+CRC_BATCH_SSSE3_TARGET
+static void calculateLanes(const uint8_t* const dataPtrs[],
+                           const uint32_t lengths[],
+                           uint64_t remainders[],
+                           size_t count,
+                           const CrcBatch_ParametersType* parameters) {
+    switch (parameters->Width) {
+        case 8:
+            calculateLanesFor(dataPtrs, lengths, remainders, count, parameters, 1, false);
+            break;
+        case 16:
+            if (parameters->Reflected) {
+                calculateLanesFor(dataPtrs, lengths, remainders, count, parameters, 2, true);
+            } else {
+                calculateLanesFor(dataPtrs, lengths, remainders, count, parameters, 2, false);
+            }
+            break;
+        case 32:
+            calculateLanesFor(dataPtrs, lengths, remainders, count, parameters, 4, true);
+            break;
+        default:
+            calculateLanesFor(dataPtrs, lengths, remainders, count, parameters, 8, true);
+            break;
+    }
+}
+
+static bool isLaneAvailable(void) {
+    return __builtin_cpu_supports("ssse3");
+}
+
+#else
+
+static void calculateLanes(const uint8_t* const dataPtrs[],
+                           const uint32_t lengths[],
+                           uint64_t remainders[],
+                           size_t count,
+                           const CrcBatch_ParametersType* parameters) {
+    (void)dataPtrs;
+    (void)lengths;
+    (void)remainders;
+    (void)count;
+    (void)parameters;
+}
+
+static bool isLaneAvailable(void) {
+    return false;
+}
+
+#endif
+
+/*
+ * Start values and results are arrays of the unsigned type of the CRC width.
+ */
+static uint64_t loadValue(const void* values, size_t index, uint8_t width) {
+    switch (width) {
+        case 8:
+            return ((const uint8_t*)values)[index];
+        case 16:
+            return ((const uint16_t*)values)[index];
+        case 32:
+            return ((const uint32_t*)values)[index];
+        default:
+            return ((const uint64_t*)values)[index];
+    }
+}
+
+static void storeValue(void* values, size_t index, uint8_t width, uint64_t value) {
+    switch (width) {
+        case 8:
+            ((uint8_t*)values)[index] = (uint8_t)value;
+            break;
+        case 16:
+            ((uint16_t*)values)[index] = (uint16_t)value;
+            break;
+        case 32:
+            ((uint32_t*)values)[index] = (uint32_t)value;
+            break;
+        default:
+            ((uint64_t*)values)[index] = value;
+            break;
+    }
+}
+
+CRC_BATCH_INLINE
+static void calculateBatch(const uint8_t* const dataPtrs[],
+                           const uint32_t lengths[],
+                           const void* startValues,
+                           bool isFirstCall,
+                           void* results,
+                           uint32_t count,
+                           const CrcBatch_ParametersType* parameters) {
+    const bool laneAvailable = isLaneAvailable();
+
+    for (uint32_t first = 0; first < count; first += CRC_BATCH_LANES) {
+        const size_t groupCount = ((count - first) < CRC_BATCH_LANES) ? (count - first) : CRC_BATCH_LANES;
+        uint64_t remainders[CRC_BATCH_LANES];
+
+        for (size_t stream = 0; stream < groupCount; ++stream) {
+            if (isFirstCall) {
+                // SWS_Crc_00014
+                remainders[stream] = parameters->Initial;
+            } else {
+                // SWS_Crc_00041
+                remainders[stream] = loadValue(startValues, first + stream, parameters->Width) ^ parameters->XorValue;
+            }
+        }
+
+        if (laneAvailable && (groupCount >= CRC_BATCH_MIN_LANE_STREAMS)) {
+            calculateLanes(&dataPtrs[first], &lengths[first], remainders, groupCount, parameters);
+        } else {
+            for (size_t stream = 0; stream < groupCount; stream += CRC_BATCH_SCALAR_STREAMS) {
+                const size_t streams = ((groupCount - stream) < CRC_BATCH_SCALAR_STREAMS) ? (groupCount - stream)
+                                                                                           : CRC_BATCH_SCALAR_STREAMS;
+                calculateInterleaved(&dataPtrs[first + stream], &lengths[first + stream], &remainders[stream], streams,
+                                     parameters);
+            }
+        }
+
+        for (size_t stream = 0; stream < groupCount; ++stream) {
+            storeValue(results, first + stream, parameters->Width, remainders[stream] ^ parameters->XorValue);
+        }
+    }
+}
+
+// cppcheck-suppress unusedFunction
+void Crc_CalculateCRC8Batch(const uint8_t* const Crc_DataPtrs[],
+                            const uint32_t Crc_Lengths[],
+                            const uint8_t Crc_StartValues8[],
+                            bool Crc_IsFirstCall,
+                            uint8_t Crc_Results[],
+                            uint32_t Crc_Count) {
+    calculateBatch(Crc_DataPtrs, Crc_Lengths, Crc_StartValues8, Crc_IsFirstCall, Crc_Results, Crc_Count,
+                   &crc8Parameters);
+}
+
+// cppcheck-suppress unusedFunction
+void Crc_CalculateCRC8H2FBatch(const uint8_t* const Crc_DataPtrs[],
+                               const uint32_t Crc_Lengths[],
+                               const uint8_t Crc_StartValues8H2F[],
+                               bool Crc_IsFirstCall,
+                               uint8_t Crc_Results[],
+                               uint32_t Crc_Count) {
+    calculateBatch(Crc_DataPtrs, Crc_Lengths, Crc_StartValues8H2F, Crc_IsFirstCall, Crc_Results, Crc_Count,
+                   &crc8H2FParameters);
+}
+
+// cppcheck-suppress unusedFunction
+void Crc_CalculateCRC16Batch(const uint8_t* const Crc_DataPtrs[],
+                             const uint32_t Crc_Lengths[],
+                             const uint16_t Crc_StartValues16[],
+                             bool Crc_IsFirstCall,
+                             uint16_t Crc_Results[],
+                             uint32_t Crc_Count) {
+    calculateBatch(Crc_DataPtrs, Crc_Lengths, Crc_StartValues16, Crc_IsFirstCall, Crc_Results, Crc_Count,
+                   &crc16Parameters);
+}
+
+// cppcheck-suppress unusedFunction
+void Crc_CalculateCRC16ARCBatch(const uint8_t* const Crc_DataPtrs[],
+                                const uint32_t Crc_Lengths[],
+                                const uint16_t Crc_StartValues16[],
+                                bool Crc_IsFirstCall,
+                                uint16_t Crc_Results[],
+                                uint32_t Crc_Count) {
+    calculateBatch(Crc_DataPtrs, Crc_Lengths, Crc_StartValues16, Crc_IsFirstCall, Crc_Results, Crc_Count,
+                   &crc16ARCParameters);
+}
+
+// cppcheck-suppress unusedFunction
+void Crc_CalculateCRC32Batch(const uint8_t* const Crc_DataPtrs[],
+                             const uint32_t Crc_Lengths[],
+                             const uint32_t Crc_StartValues32[],
+                             bool Crc_IsFirstCall,
+                             uint32_t Crc_Results[],
+                             uint32_t Crc_Count) {
+    calculateBatch(Crc_DataPtrs, Crc_Lengths, Crc_StartValues32, Crc_IsFirstCall, Crc_Results, Crc_Count,
+                   &crc32Parameters);
+}
+
+// cppcheck-suppress unusedFunction
+void Crc_CalculateCRC32P4Batch(const uint8_t* const Crc_DataPtrs[],
+                               const uint32_t Crc_Lengths[],
+                               const uint32_t Crc_StartValues32[],
+                               bool Crc_IsFirstCall,
+                               uint32_t Crc_Results[],
+                               uint32_t Crc_Count) {
+    calculateBatch(Crc_DataPtrs, Crc_Lengths, Crc_StartValues32, Crc_IsFirstCall, Crc_Results, Crc_Count,
+                   &crc32P4Parameters);
+}
+
+// cppcheck-suppress unusedFunction
+void Crc_CalculateCRC64Batch(const uint8_t* const Crc_DataPtrs[],
+                             const uint32_t Crc_Lengths[],
+                             const uint64_t Crc_StartValues64[],
+                             bool Crc_IsFirstCall,
+                             uint64_t Crc_Results[],
+                             uint32_t Crc_Count) {
+    calculateBatch(Crc_DataPtrs, Crc_Lengths, Crc_StartValues64, Crc_IsFirstCall, Crc_Results, Crc_Count,
+                   &crc64Parameters);
+}
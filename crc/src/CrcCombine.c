@@ -0,0 +1,344 @@
+/**
+ * @file CrcCombine.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * Combining CRCs, see Crc.h. This file is part of every CRC library.
+ *
+ * Appending n bytes to a message multiplies its CRC register by x^(8n)
+ * modulo the polynomial P before the CRC register of the new bytes is
+ * added. With the initial value I and XOR value X, the CRC of A||B is
+ * therefore
+ *
+ *   crc(A||B) = (crc(A) + X + I) * x^(8n) mod P + crc(B)
+ *
+ * where n is the length of B. x^(8n) mod P is the product of the
+ * precomputed powers x^(8*2^k) mod P for the bits k set in n, which
+ * takes at most one multiplication per bit of n. Appending n zero bytes
+ * is the same multiplication without crc(B). Reflected CRCs are
+ * reflected into normal polynomials for the multiplication.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "Crc.h"
+
+/*
+ * x^(8*2^k) mod P for k = 0 to 63, the first entry is x^8 mod P.
+ */
+static const uint64_t crc8Powers[64] = {
+    0x1D, 0x4C, 0x9D, 0x5F, 0x85, 0x02, 0x04, 0x10,
+    0x1D, 0x4C, 0x9D, 0x5F, 0x85, 0x02, 0x04, 0x10,
+    0x1D, 0x4C, 0x9D, 0x5F, 0x85, 0x02, 0x04, 0x10,
+    0x1D, 0x4C, 0x9D, 0x5F, 0x85, 0x02, 0x04, 0x10,
+    0x1D, 0x4C, 0x9D, 0x5F, 0x85, 0x02, 0x04, 0x10,
+    0x1D, 0x4C, 0x9D, 0x5F, 0x85, 0x02, 0x04, 0x10,
+    0x1D, 0x4C, 0x9D, 0x5F, 0x85, 0x02, 0x04, 0x10,
+    0x1D, 0x4C, 0x9D, 0x5F, 0x85, 0x02, 0x04, 0x10
+};
+
+static const uint64_t crc8H2FPowers[64] = {
+    0x2F, 0xE9, 0xB5, 0x64, 0x02, 0x04, 0x10, 0x2F,
+    0xE9, 0xB5, 0x64, 0x02, 0x04, 0x10, 0x2F, 0xE9,
+    0xB5, 0x64, 0x02, 0x04, 0x10, 0x2F, 0xE9, 0xB5,
+    0x64, 0x02, 0x04, 0x10, 0x2F, 0xE9, 0xB5, 0x64,
+    0x02, 0x04, 0x10, 0x2F, 0xE9, 0xB5, 0x64, 0x02,
+    0x04, 0x10, 0x2F, 0xE9, 0xB5, 0x64, 0x02, 0x04,
+    0x10, 0x2F, 0xE9, 0xB5, 0x64, 0x02, 0x04, 0x10,
+    0x2F, 0xE9, 0xB5, 0x64, 0x02, 0x04, 0x10, 0x2F
+};
+
+static const uint64_t crc16Powers[64] = {
+    0x0100, 0x1021, 0x3730, 0xB861, 0xAEFC, 0x8E29, 0x13FC, 0x36C4,
+    0xFD50, 0xAA9E, 0x881C, 0x4458, 0x0002, 0x0004, 0x0010, 0x0100,
+    0x1021, 0x3730, 0xB861, 0xAEFC, 0x8E29, 0x13FC, 0x36C4, 0xFD50,
+    0xAA9E, 0x881C, 0x4458, 0x0002, 0x0004, 0x0010, 0x0100, 0x1021,
+    0x3730, 0xB861, 0xAEFC, 0x8E29, 0x13FC, 0x36C4, 0xFD50, 0xAA9E,
+    0x881C, 0x4458, 0x0002, 0x0004, 0x0010, 0x0100, 0x1021, 0x3730,
+    0xB861, 0xAEFC, 0x8E29, 0x13FC, 0x36C4, 0xFD50, 0xAA9E, 0x881C,
+    0x4458, 0x0002, 0x0004, 0x0010, 0x0100, 0x1021, 0x3730, 0xB861
+};
+
+static const uint64_t crc16ARCPowers[64] = {
+    0x0100, 0x8005, 0x8017, 0x8113, 0x0106, 0x8011, 0x8107, 0x0016,
+    0x0114, 0x8115, 0x0112, 0x8101, 0x0002, 0x0004, 0x0010, 0x0100,
+    0x8005, 0x8017, 0x8113, 0x0106, 0x8011, 0x8107, 0x0016, 0x0114,
+    0x8115, 0x0112, 0x8101, 0x0002, 0x0004, 0x0010, 0x0100, 0x8005,
+    0x8017, 0x8113, 0x0106, 0x8011, 0x8107, 0x0016, 0x0114, 0x8115,
+    0x0112, 0x8101, 0x0002, 0x0004, 0x0010, 0x0100, 0x8005, 0x8017,
+    0x8113, 0x0106, 0x8011, 0x8107, 0x0016, 0x0114, 0x8115, 0x0112,
+    0x8101, 0x0002, 0x0004, 0x0010, 0x0100, 0x8005, 0x8017, 0x8113
+};
+
+static const uint64_t crc32Powers[64] = {
+    0x00000100, 0x00010000, 0x04C11DB7, 0x490D678D,
+    0xE8A45605, 0x75BE46B7, 0xE6228B11, 0x567FDDEB,
+    0x88FE2237, 0x0E857E71, 0x7001E426, 0x075DE2B2,
+    0xF12A7F90, 0xF0B4A1C1, 0x58F46C0C, 0xC3395ADE,
+    0x96837F8C, 0x544037F9, 0x23B7B136, 0xB2E16BA8,
+    0x725E7BFA, 0xEC709B5D, 0xF77A7274, 0x2845D572,
+    0x034E2515, 0x79695942, 0x540CB128, 0x0B65D023,
+    0x3C344723, 0x00000002, 0x00000004, 0x00000010,
+    0x00000100, 0x00010000, 0x04C11DB7, 0x490D678D,
+    0xE8A45605, 0x75BE46B7, 0xE6228B11, 0x567FDDEB,
+    0x88FE2237, 0x0E857E71, 0x7001E426, 0x075DE2B2,
+    0xF12A7F90, 0xF0B4A1C1, 0x58F46C0C, 0xC3395ADE,
+    0x96837F8C, 0x544037F9, 0x23B7B136, 0xB2E16BA8,
+    0x725E7BFA, 0xEC709B5D, 0xF77A7274, 0x2845D572,
+    0x034E2515, 0x79695942, 0x540CB128, 0x0B65D023,
+    0x3C344723, 0x00000002, 0x00000004, 0x00000010
+};
+
+static const uint64_t crc32P4Powers[64] = {
+    0x00000100, 0x00010000, 0xF4ACFB13, 0x06CD561B,
+    0x052E2A05, 0xDCC76058, 0xE1D04AE3, 0x87B10100,
+    0x42BFC0D2, 0xE316149D, 0xA6A36442, 0x2F106991,
+    0xAC6456F3, 0x00000004, 0x00000010, 0x00000100,
+    0x00010000, 0xF4ACFB13, 0x06CD561B, 0x052E2A05,
+    0xDCC76058, 0xE1D04AE3, 0x87B10100, 0x42BFC0D2,
+    0xE316149D, 0xA6A36442, 0x2F106991, 0xAC6456F3,
+    0x00000004, 0x00000010, 0x00000100, 0x00010000,
+    0xF4ACFB13, 0x06CD561B, 0x052E2A05, 0xDCC76058,
+    0xE1D04AE3, 0x87B10100, 0x42BFC0D2, 0xE316149D,
+    0xA6A36442, 0x2F106991, 0xAC6456F3, 0x00000004,
+    0x00000010, 0x00000100, 0x00010000, 0xF4ACFB13,
+    0x06CD561B, 0x052E2A05, 0xDCC76058, 0xE1D04AE3,
+    0x87B10100, 0x42BFC0D2, 0xE316149D, 0xA6A36442,
+    0x2F106991, 0xAC6456F3, 0x00000004, 0x00000010,
+    0x00000100, 0x00010000, 0xF4ACFB13, 0x06CD561B
+};
+
+static const uint64_t crc64Powers[64] = {
+    0x0000000000000100, 0x0000000000010000,
+    0x0000000100000000, 0x42F0E1EBA9EA3693,
+    0x05F5C3C7EB52FAB6, 0x571BEE0A227EF92B,
+    0x5F6843CA540DF020, 0x05CF79DEA9AC37D6,
+    0x7F52691A60DDC70D, 0x1C6FFB45E31EA184,
+    0x4F3ABB24F049DDB6, 0xAD7AB2DB3F30285E,
+    0xDEA023D37A0ECD82, 0x578353356A6D562B,
+    0xCEDF2C3F65B7D94C, 0xE9E9D0AC2B3F258A,
+    0xB975F7EC6A15F28C, 0x48AB18A8597E4F35,
+    0xE731B2511CC547FF, 0x727433067E969D12,
+    0x06246BB1ED3CE5B5, 0xDD83A731B2A2A57C,
+    0x8F57F0E365C7217A, 0x8B81BD366D92BF09,
+    0x172A4DB8307C2947, 0x852C11537B565F37,
+    0x84C77C9A4847C8AF, 0x6890208CCEA756CF,
+    0xE8E6DE1DCCCBDFC6, 0xD1D0AF4A871F06BD,
+    0xBE6A8399415273A5, 0x77AADBD30FA22BD0,
+    0xA142C80472416BBF, 0x5E4445BD76D1B573,
+    0x3ADF2BAF27E8D227, 0xA3E5380B581394D9,
+    0xAA0257F02766C2D8, 0xDE687558AA853DE4,
+    0x096A59CD8B3DEA55, 0x9DB2C485FC173FEB,
+    0x71FFC57F76192733, 0x8F82CA679B25406C,
+    0xA2868AFB45B8D44E, 0xC15B105CBBBC3F37,
+    0x67E0AC1533B69DF0, 0x010F0EB1E7F4FA48,
+    0x68A558A6ED0AF421, 0xF6C19B31182C3D90,
+    0x909B698213666C2F, 0xD336FB030CD7F6AD,
+    0x1A90CFE732076655, 0xE2A94F597E188DED,
+    0x7BA926E21FAA4C88, 0x7EEBA90C1EF98DF1,
+    0xCC8D413E33552375, 0xF314218490B6726F,
+    0x051A435A574E56C0, 0x56555ED748F7AC4A,
+    0xCA1EA6A168DEB7F4, 0xADF60662B8A91F71,
+    0x28B2C0F090831AB9, 0xDE955BF959A36F6C,
+    0x49A41619BE8AB47D, 0x8F94EAF7F1CEB3DE
+};
+
+typedef struct {
+    uint64_t Polynomial;
+    uint64_t Initial;
+    uint64_t XorValue;
+    uint8_t Width;
+    bool Reflected;
+    const uint64_t* Powers;
+} CrcCombine_ParametersType;
+
+static const CrcCombine_ParametersType crc8Parameters = {0x1D, 0xFF, 0xFF, 8, false, crc8Powers};
+static const CrcCombine_ParametersType crc8H2FParameters = {0x2F, 0xFF, 0xFF, 8, false, crc8H2FPowers};
+static const CrcCombine_ParametersType crc16Parameters = {0x1021, 0xFFFF, 0x0000, 16, false, crc16Powers};
+static const CrcCombine_ParametersType crc16ARCParameters = {0x8005, 0x0000, 0x0000, 16, true, crc16ARCPowers};
+static const CrcCombine_ParametersType crc32Parameters = {0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, 32, true, crc32Powers};
+static const CrcCombine_ParametersType crc32P4Parameters = {0xF4ACFB13, 0xFFFFFFFF, 0xFFFFFFFF, 32, true, crc32P4Powers};
+static const CrcCombine_ParametersType crc64Parameters = {
+    0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 64, true, crc64Powers
+};
+
+static uint64_t reflect(uint64_t data, uint8_t width) {
+    uint64_t reflection = 0;
+
+    for (uint8_t bit = 0; bit < width; ++bit) {
+        reflection = (reflection << 1) | (data & 1);
+        data >>= 1;
+    }
+
+    return reflection;
+}
+
+/*
+ * Computes a * b mod P, where bit i of a, b and the result is the
+ * coefficient of x^i.
+ */
+static uint64_t multiplyModulo(uint64_t a, uint64_t b, const CrcCombine_ParametersType* parameters) {
+    const uint64_t topbit = 1ULL << (parameters->Width - 1);
+    uint64_t product = 0;
+
+    /*
+     * Horner's method over the bits of b, highest first.
+     */
+    for (uint64_t bit = topbit; bit != 0; bit >>= 1) {
+        if (product & topbit) {
+            product = (product << 1) ^ parameters->Polynomial;
+        } else {
+            product <<= 1;
+        }
+
+        if (b & bit) {
+            product ^= a;
+        }
+    }
+
+    if (parameters->Width < 64) {
+        product &= (1ULL << parameters->Width) - 1;
+    }
+
+    return product;
+}
+
+/*
+ * Computes x^(8 * length) mod P.
+ */
+static uint64_t shiftModulo(size_t length, const CrcCombine_ParametersType* parameters) {
+    uint64_t result = 1;
+
+    for (uint8_t power = 0; length > 0; ++power) {
+        if (length & 1) {
+            result = multiplyModulo(result, parameters->Powers[power], parameters);
+        }
+
+        length >>= 1;
+    }
+
+    return result;
+}
+
+/*
+ * Multiplies the CRC register by x^(8 * length), in the bit order of the CRC.
+ */
+static uint64_t shiftRegister(uint64_t remainder, size_t length, const CrcCombine_ParametersType* parameters) {
+    if (parameters->Reflected) {
+        remainder = reflect(remainder, parameters->Width);
+    }
+
+    remainder = multiplyModulo(remainder, shiftModulo(length, parameters), parameters);
+
+    if (parameters->Reflected) {
+        remainder = reflect(remainder, parameters->Width);
+    }
+
+    return remainder;
+}
+
+static uint64_t combine(uint64_t crc1, uint64_t crc2, size_t length2, const CrcCombine_ParametersType* parameters) {
+    const uint64_t remainder = crc1 ^ parameters->XorValue ^ parameters->Initial;
+
+    return shiftRegister(remainder, length2, parameters) ^ crc2;
+}
+
+static uint64_t appendZeros(uint64_t crc, size_t length, const CrcCombine_ParametersType* parameters) {
+    const uint64_t remainder = crc ^ parameters->XorValue;
+
+    return shiftRegister(remainder, length, parameters) ^ parameters->XorValue;
+}
+
+// cppcheck-suppress unusedFunction
+uint8_t Crc_CombineCRC8(uint8_t Crc_Crc1,
+                        uint8_t Crc_Crc2,
+                        size_t Crc_Length2) {
+    return (uint8_t)combine(Crc_Crc1, Crc_Crc2, Crc_Length2, &crc8Parameters);
+}
+
+// cppcheck-suppress unusedFunction
+uint8_t Crc_CombineCRC8H2F(uint8_t Crc_Crc1,
+                           uint8_t Crc_Crc2,
+                           size_t Crc_Length2) {
+    return (uint8_t)combine(Crc_Crc1, Crc_Crc2, Crc_Length2, &crc8H2FParameters);
+}
+
+// cppcheck-suppress unusedFunction
+uint16_t Crc_CombineCRC16(uint16_t Crc_Crc1,
+                          uint16_t Crc_Crc2,
+                          size_t Crc_Length2) {
+    return (uint16_t)combine(Crc_Crc1, Crc_Crc2, Crc_Length2, &crc16Parameters);
+}
+
+// cppcheck-suppress unusedFunction
+uint16_t Crc_CombineCRC16ARC(uint16_t Crc_Crc1,
+                             uint16_t Crc_Crc2,
+                             size_t Crc_Length2) {
+    return (uint16_t)combine(Crc_Crc1, Crc_Crc2, Crc_Length2, &crc16ARCParameters);
+}
+
+// cppcheck-suppress unusedFunction
+uint32_t Crc_CombineCRC32(uint32_t Crc_Crc1,
+                          uint32_t Crc_Crc2,
+                          size_t Crc_Length2) {
+    return (uint32_t)combine(Crc_Crc1, Crc_Crc2, Crc_Length2, &crc32Parameters);
+}
+
+// cppcheck-suppress unusedFunction
+uint32_t Crc_CombineCRC32P4(uint32_t Crc_Crc1,
+                            uint32_t Crc_Crc2,
+                            size_t Crc_Length2) {
+    return (uint32_t)combine(Crc_Crc1, Crc_Crc2, Crc_Length2, &crc32P4Parameters);
+}
+
+// cppcheck-suppress unusedFunction
+uint64_t Crc_CombineCRC64(uint64_t Crc_Crc1,
+                          uint64_t Crc_Crc2,
+                          size_t Crc_Length2) {
+    return combine(Crc_Crc1, Crc_Crc2, Crc_Length2, &crc64Parameters);
+}
+
+// cppcheck-suppress unusedFunction
+uint8_t Crc_AppendZerosCRC8(uint8_t Crc_Crc,
+                            size_t Crc_ZeroLength) {
+    return (uint8_t)appendZeros(Crc_Crc, Crc_ZeroLength, &crc8Parameters);
+}
+
+// cppcheck-suppress unusedFunction
+uint8_t Crc_AppendZerosCRC8H2F(uint8_t Crc_Crc,
+                               size_t Crc_ZeroLength) {
+    return (uint8_t)appendZeros(Crc_Crc, Crc_ZeroLength, &crc8H2FParameters);
+}
+
+// cppcheck-suppress unusedFunction
+uint16_t Crc_AppendZerosCRC16(uint16_t Crc_Crc,
+                              size_t Crc_ZeroLength) {
+    return (uint16_t)appendZeros(Crc_Crc, Crc_ZeroLength, &crc16Parameters);
+}
+
+// cppcheck-suppress unusedFunction
+uint16_t Crc_AppendZerosCRC16ARC(uint16_t Crc_Crc,
+                                 size_t Crc_ZeroLength) {
+    return (uint16_t)appendZeros(Crc_Crc, Crc_ZeroLength, &crc16ARCParameters);
+}
+
+// cppcheck-suppress unusedFunction
+uint32_t Crc_AppendZerosCRC32(uint32_t Crc_Crc,
+                              size_t Crc_ZeroLength) {
+    return (uint32_t)appendZeros(Crc_Crc, Crc_ZeroLength, &crc32Parameters);
+}
+
+// cppcheck-suppress unusedFunction
+uint32_t Crc_AppendZerosCRC32P4(uint32_t Crc_Crc,
+                                size_t Crc_ZeroLength) {
+    return (uint32_t)appendZeros(Crc_Crc, Crc_ZeroLength, &crc32P4Parameters);
+}
+
+// cppcheck-suppress unusedFunction
+uint64_t Crc_AppendZerosCRC64(uint64_t Crc_Crc,
+                              size_t Crc_ZeroLength) {
+    return appendZeros(Crc_Crc, Crc_ZeroLength, &crc64Parameters);
+}
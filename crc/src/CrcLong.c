@@ -0,0 +1,72 @@
+/**
+ * @file CrcLong.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * The AUTOSAR Crc_CalculateCRCxx services with a uint32_t length, see
+ * Crc.h. This file is part of every CRC library, whose kernels implement
+ * the Crc_CalculateCRCxxLong functions with a size_t length.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "Crc.h"
+
+// cppcheck-suppress unusedFunction
+uint8_t Crc_CalculateCRC8(const uint8_t* Crc_DataPtr,
+                          uint32_t Crc_Length,
+                          uint8_t Crc_StartValue8,
+                          bool Crc_IsFirstCall) {
+    return Crc_CalculateCRC8Long(Crc_DataPtr, Crc_Length, Crc_StartValue8, Crc_IsFirstCall);
+}
+
+// cppcheck-suppress unusedFunction
+uint8_t Crc_CalculateCRC8H2F(const uint8_t* Crc_DataPtr,
+                             uint32_t Crc_Length,
+                             uint8_t Crc_StartValue8H2F,
+                             bool Crc_IsFirstCall) {
+    return Crc_CalculateCRC8H2FLong(Crc_DataPtr, Crc_Length, Crc_StartValue8H2F, Crc_IsFirstCall);
+}
+
+// cppcheck-suppress unusedFunction
+uint16_t Crc_CalculateCRC16(const uint8_t* Crc_DataPtr,
+                            uint32_t Crc_Length,
+                            uint16_t Crc_StartValue16,
+                            bool Crc_IsFirstCall) {
+    return Crc_CalculateCRC16Long(Crc_DataPtr, Crc_Length, Crc_StartValue16, Crc_IsFirstCall);
+}
+
+// cppcheck-suppress unusedFunction
+uint16_t Crc_CalculateCRC16ARC(const uint8_t* Crc_DataPtr,
+                               uint32_t Crc_Length,
+                               uint16_t Crc_StartValue16,
+                               bool Crc_IsFirstCall) {
+    return Crc_CalculateCRC16ARCLong(Crc_DataPtr, Crc_Length, Crc_StartValue16, Crc_IsFirstCall);
+}
+
+// cppcheck-suppress unusedFunction
+uint32_t Crc_CalculateCRC32(const uint8_t* Crc_DataPtr,
+                            uint32_t Crc_Length,
+                            uint32_t Crc_StartValue32,
+                            bool Crc_IsFirstCall) {
+    return Crc_CalculateCRC32Long(Crc_DataPtr, Crc_Length, Crc_StartValue32, Crc_IsFirstCall);
+}
+
+// cppcheck-suppress unusedFunction
+uint32_t Crc_CalculateCRC32P4(const uint8_t* Crc_DataPtr,
+                              uint32_t Crc_Length,
+                              uint32_t Crc_StartValue32,
+                              bool Crc_IsFirstCall) {
+    return Crc_CalculateCRC32P4Long(Crc_DataPtr, Crc_Length, Crc_StartValue32, Crc_IsFirstCall);
+}
+
+// cppcheck-suppress unusedFunction
+uint64_t Crc_CalculateCRC64(const uint8_t* Crc_DataPtr,
+                            uint32_t Crc_Length,
+                            uint64_t Crc_StartValue64,
+                            bool Crc_IsFirstCall) {
+    return Crc_CalculateCRC64Long(Crc_DataPtr, Crc_Length, Crc_StartValue64, Crc_IsFirstCall);
+}
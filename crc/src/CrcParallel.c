@@ -0,0 +1,245 @@
+/**
+ * @file CrcParallel.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * Multi-threaded CRC calculation, see Crc_Parallel.h. This file is part
+ * of every CRC library.
+ *
+ * The message is split into equally long chunks, the first one starting
+ * from the caller's start value and the others from the initial value.
+ * The chunk CRCs are then merged in message order with Crc_CombineCRCxx.
+ * The algorithms are handled through 64-bit wrappers of the Crc.h
+ * functions so that the splitting and merging are only written once.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "Crc.h"
+#include "Crc_Parallel.h"
+
+#include <pthread.h>
+#include <unistd.h>
+
+/*
+ * Chunks are rounded up to whole cache lines.
+ */
+#define CRC_PARALLEL_CHUNK_ALIGNMENT 64U
+
+typedef uint64_t (*CrcParallel_CalculateType)(const uint8_t*, size_t, uint64_t, bool);
+typedef uint64_t (*CrcParallel_CombineType)(uint64_t, uint64_t, size_t);
+
+typedef struct {
+    CrcParallel_CalculateType Calculate;
+    const uint8_t* DataPtr;
+    size_t Length;
+    size_t ChunkLength;
+    uint64_t StartValue;
+    bool IsFirstCall;
+    uint64_t ChunkCrcs[CRC_PARALLEL_MAX_TASKS];
+} CrcParallel_JobType;
+
+typedef struct {
+    CrcParallel_JobType* Job;
+    size_t Index;
+} CrcParallel_ThreadType;
+
+static size_t chunkLength(const CrcParallel_JobType* job, size_t index) {
+    const size_t start = index * job->ChunkLength;
+    const size_t remaining = job->Length - start;
+
+    return (remaining < job->ChunkLength) ? remaining : job->ChunkLength;
+}
+
+static void calculateChunk(void* argument, size_t index) {
+    CrcParallel_JobType* job = (CrcParallel_JobType*)argument;
+    const uint8_t* data = &job->DataPtr[index * job->ChunkLength];
+
+    if (index == 0) {
+        job->ChunkCrcs[0] = job->Calculate(data, chunkLength(job, 0), job->StartValue, job->IsFirstCall);
+    } else {
+        job->ChunkCrcs[index] = job->Calculate(data, chunkLength(job, index), 0, true);
+    }
+}
+
+static void* runThread(void* argument) {
+    const CrcParallel_ThreadType* thread = (const CrcParallel_ThreadType*)argument;
+
+    calculateChunk(thread->Job, thread->Index);
+    return NULL;
+}
+
+/*
+ * Runs the chunks on threads started for the call, the first chunk on the
+ * calling thread. Chunks whose thread cannot be started are run on the
+ * calling thread as well.
+ */
+static void runThreads(CrcParallel_JobType* job, size_t count) {
+    pthread_t threads[CRC_PARALLEL_MAX_TASKS];
+    CrcParallel_ThreadType arguments[CRC_PARALLEL_MAX_TASKS];
+    bool started[CRC_PARALLEL_MAX_TASKS] = {false};
+
+    for (size_t index = 1; index < count; ++index) {
+        arguments[index].Job = job;
+        arguments[index].Index = index;
+        started[index] = (pthread_create(&threads[index], NULL, runThread, &arguments[index]) == 0);
+    }
+
+    calculateChunk(job, 0);
+
+    for (size_t index = 1; index < count; ++index) {
+        if (started[index]) {
+            pthread_join(threads[index], NULL);
+        } else {
+            calculateChunk(job, index);
+        }
+    }
+}
+
+static size_t onlineCpus(void) {
+    const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return (cpus > 0) ? (size_t)cpus : 1;
+}
+
+static uint64_t calculateParallel(const uint8_t* data,
+                                  size_t length,
+                                  uint64_t startValue,
+                                  bool isFirstCall,
+                                  const Crc_ParallelPoolType* pool,
+                                  CrcParallel_CalculateType calculate,
+                                  CrcParallel_CombineType combine) {
+    size_t concurrency = ((pool != NULL) && (pool->Concurrency > 0)) ? pool->Concurrency : onlineCpus();
+    const size_t minChunkLength = ((pool != NULL) && (pool->MinChunkLength > 0)) ? pool->MinChunkLength
+                                                                                 : CRC_PARALLEL_MIN_CHUNK_LENGTH;
+
+    if (concurrency > CRC_PARALLEL_MAX_TASKS) {
+        concurrency = CRC_PARALLEL_MAX_TASKS;
+    }
+
+    size_t count = length / minChunkLength;
+    if (count > concurrency) {
+        count = concurrency;
+    }
+
+    if (count < 2) {
+        return calculate(data, length, startValue, isFirstCall);
+    }
+
+    CrcParallel_JobType job = {
+        .Calculate = calculate,
+        .DataPtr = data,
+        .Length = length,
+        .StartValue = startValue,
+        .IsFirstCall = isFirstCall
+    };
+
+    job.ChunkLength = (length + count - 1) / count;
+    job.ChunkLength = (job.ChunkLength + CRC_PARALLEL_CHUNK_ALIGNMENT - 1) & ~(size_t)(CRC_PARALLEL_CHUNK_ALIGNMENT - 1);
+    count = (length + job.ChunkLength - 1) / job.ChunkLength;
+
+    if ((pool != NULL) && (pool->Run != NULL)) {
+        pool->Run(pool->Pool, calculateChunk, &job, count);
+    } else {
+        runThreads(&job, count);
+    }
+
+    uint64_t crc = job.ChunkCrcs[0];
+    for (size_t index = 1; index < count; ++index) {
+        crc = combine(crc, job.ChunkCrcs[index], chunkLength(&job, index));
+    }
+
+    return crc;
+}
+
+/*
+ * 64-bit wrappers of the Crc.h functions for one algorithm.
+ */
+#define CRC_PARALLEL_WRAPPERS(NAME, TYPE) \
+    static uint64_t calculate##NAME(const uint8_t* data, size_t length, uint64_t startValue, bool isFirstCall) { \
+        return Crc_Calculate##NAME##Long(data, length, (TYPE)startValue, isFirstCall); \
+    } \
+    static uint64_t combine##NAME(uint64_t crc1, uint64_t crc2, size_t length2) { \
+        return Crc_Combine##NAME((TYPE)crc1, (TYPE)crc2, length2); \
+    }
+
+CRC_PARALLEL_WRAPPERS(CRC8, uint8_t)
+CRC_PARALLEL_WRAPPERS(CRC8H2F, uint8_t)
+CRC_PARALLEL_WRAPPERS(CRC16, uint16_t)
+CRC_PARALLEL_WRAPPERS(CRC16ARC, uint16_t)
+CRC_PARALLEL_WRAPPERS(CRC32, uint32_t)
+CRC_PARALLEL_WRAPPERS(CRC32P4, uint32_t)
+CRC_PARALLEL_WRAPPERS(CRC64, uint64_t)
+
+// cppcheck-suppress unusedFunction
+uint8_t Crc_CalculateCRC8Parallel(const uint8_t* Crc_DataPtr,
+                                  size_t Crc_Length,
+                                  uint8_t Crc_StartValue8,
+                                  bool Crc_IsFirstCall,
+                                  const Crc_ParallelPoolType* Crc_Pool) {
+    return (uint8_t)calculateParallel(Crc_DataPtr, Crc_Length, Crc_StartValue8, Crc_IsFirstCall, Crc_Pool,
+                                      calculateCRC8, combineCRC8);
+}
+
+// cppcheck-suppress unusedFunction
+uint8_t Crc_CalculateCRC8H2FParallel(const uint8_t* Crc_DataPtr,
+                                     size_t Crc_Length,
+                                     uint8_t Crc_StartValue8H2F,
+                                     bool Crc_IsFirstCall,
+                                     const Crc_ParallelPoolType* Crc_Pool) {
+    return (uint8_t)calculateParallel(Crc_DataPtr, Crc_Length, Crc_StartValue8H2F, Crc_IsFirstCall, Crc_Pool,
+                                      calculateCRC8H2F, combineCRC8H2F);
+}
+
+// cppcheck-suppress unusedFunction
+uint16_t Crc_CalculateCRC16Parallel(const uint8_t* Crc_DataPtr,
+                                    size_t Crc_Length,
+                                    uint16_t Crc_StartValue16,
+                                    bool Crc_IsFirstCall,
+                                    const Crc_ParallelPoolType* Crc_Pool) {
+    return (uint16_t)calculateParallel(Crc_DataPtr, Crc_Length, Crc_StartValue16, Crc_IsFirstCall, Crc_Pool,
+                                       calculateCRC16, combineCRC16);
+}
+
+// cppcheck-suppress unusedFunction
+uint16_t Crc_CalculateCRC16ARCParallel(const uint8_t* Crc_DataPtr,
+                                       size_t Crc_Length,
+                                       uint16_t Crc_StartValue16,
+                                       bool Crc_IsFirstCall,
+                                       const Crc_ParallelPoolType* Crc_Pool) {
+    return (uint16_t)calculateParallel(Crc_DataPtr, Crc_Length, Crc_StartValue16, Crc_IsFirstCall, Crc_Pool,
+                                       calculateCRC16ARC, combineCRC16ARC);
+}
+
+// cppcheck-suppress unusedFunction
+uint32_t Crc_CalculateCRC32Parallel(const uint8_t* Crc_DataPtr,
+                                    size_t Crc_Length,
+                                    uint32_t Crc_StartValue32,
+                                    bool Crc_IsFirstCall,
+                                    const Crc_ParallelPoolType* Crc_Pool) {
+    return (uint32_t)calculateParallel(Crc_DataPtr, Crc_Length, Crc_StartValue32, Crc_IsFirstCall, Crc_Pool,
+                                       calculateCRC32, combineCRC32);
+}
+
+// cppcheck-suppress unusedFunction
+uint32_t Crc_CalculateCRC32P4Parallel(const uint8_t* Crc_DataPtr,
+                                      size_t Crc_Length,
+                                      uint32_t Crc_StartValue32,
+                                      bool Crc_IsFirstCall,
+                                      const Crc_ParallelPoolType* Crc_Pool) {
+    return (uint32_t)calculateParallel(Crc_DataPtr, Crc_Length, Crc_StartValue32, Crc_IsFirstCall, Crc_Pool,
+                                       calculateCRC32P4, combineCRC32P4);
+}
+
+// cppcheck-suppress unusedFunction
+uint64_t Crc_CalculateCRC64Parallel(const uint8_t* Crc_DataPtr,
+                                    size_t Crc_Length,
+                                    uint64_t Crc_StartValue64,
+                                    bool Crc_IsFirstCall,
+                                    const Crc_ParallelPoolType* Crc_Pool) {
+    return calculateParallel(Crc_DataPtr, Crc_Length, Crc_StartValue64, Crc_IsFirstCall, Crc_Pool,
+                             calculateCRC64, combineCRC64);
+}
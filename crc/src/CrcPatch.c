@@ -0,0 +1,155 @@
+/**
+ * @file CrcPatch.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * Sparse updates, see Crc.h. This file is part of every CRC library.
+ *
+ * With the XOR value removed, a CRC is linear in the message, so the CRC
+ * register of the patched buffer is the old register XOR the register of
+ * a buffer of equal length that is zero except for old XOR new bytes at
+ * the patched range. Leading zeros do not change a zero register, so the
+ * latter is the register of the XORed bytes from zero, followed by the
+ * bytes up to the end of the buffer, which Crc_AppendZerosCRCxx skips in
+ * logarithmic time.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "Crc.h"
+
+/*
+ * Old XOR new bytes are calculated in blocks of this many bytes.
+ */
+#define CRC_PATCH_BLOCK_LENGTH 64U
+
+typedef uint64_t (*CrcPatch_CalculateType)(const uint8_t*, size_t, uint64_t, bool);
+typedef uint64_t (*CrcPatch_AppendZerosType)(uint64_t, size_t);
+
+/*
+ * Register of old XOR new bytes of a patch calculated from zero, i.e.
+ * start values with the XOR value removed.
+ */
+static uint64_t differenceRegister(const Crc_PatchType* patch, uint64_t xorValue, CrcPatch_CalculateType calculate) {
+    uint8_t difference[CRC_PATCH_BLOCK_LENGTH];
+    uint64_t remainder = 0;
+
+    for (size_t done = 0; done < patch->Length; done += CRC_PATCH_BLOCK_LENGTH) {
+        const size_t remaining = patch->Length - done;
+        const size_t blockLength = (remaining < CRC_PATCH_BLOCK_LENGTH) ? remaining : CRC_PATCH_BLOCK_LENGTH;
+
+        for (size_t byte = 0; byte < blockLength; ++byte) {
+            difference[byte] = patch->OldDataPtr[done + byte] ^ patch->NewDataPtr[done + byte];
+        }
+
+        remainder = calculate(difference, blockLength, remainder ^ xorValue, false) ^ xorValue;
+    }
+
+    return remainder;
+}
+
+static uint64_t patchCrc(uint64_t crc,
+                         size_t length,
+                         const Crc_PatchType patches[],
+                         uint32_t patchCount,
+                         uint64_t xorValue,
+                         CrcPatch_CalculateType calculate,
+                         CrcPatch_AppendZerosType appendZeros) {
+    for (uint32_t index = 0; index < patchCount; ++index) {
+        const Crc_PatchType* patch = &patches[index];
+        const uint64_t remainder = differenceRegister(patch, xorValue, calculate);
+
+        if (remainder != 0) {
+            const size_t trailingLength = length - patch->Offset - patch->Length;
+
+            crc ^= appendZeros(remainder ^ xorValue, trailingLength) ^ xorValue;
+        }
+    }
+
+    return crc;
+}
+
+/*
+ * 64-bit wrappers of the Crc.h functions for one algorithm.
+ */
+#define CRC_PATCH_WRAPPERS(NAME, TYPE) \
+    static uint64_t calculate##NAME(const uint8_t* data, size_t length, uint64_t startValue, bool isFirstCall) { \
+        return Crc_Calculate##NAME##Long(data, length, (TYPE)startValue, isFirstCall); \
+    } \
+    static uint64_t appendZeros##NAME(uint64_t crc, size_t zeroLength) { \
+        return Crc_AppendZeros##NAME((TYPE)crc, zeroLength); \
+    }
+
+CRC_PATCH_WRAPPERS(CRC8, uint8_t)
+CRC_PATCH_WRAPPERS(CRC8H2F, uint8_t)
+CRC_PATCH_WRAPPERS(CRC16, uint16_t)
+CRC_PATCH_WRAPPERS(CRC16ARC, uint16_t)
+CRC_PATCH_WRAPPERS(CRC32, uint32_t)
+CRC_PATCH_WRAPPERS(CRC32P4, uint32_t)
+CRC_PATCH_WRAPPERS(CRC64, uint64_t)
+
+// cppcheck-suppress unusedFunction
+uint8_t Crc_PatchCRC8(uint8_t Crc_Crc,
+                      size_t Crc_Length,
+                      const Crc_PatchType Crc_Patches[],
+                      uint32_t Crc_PatchCount) {
+    return (uint8_t)patchCrc(Crc_Crc, Crc_Length, Crc_Patches, Crc_PatchCount,
+                             0xFF, calculateCRC8, appendZerosCRC8);
+}
+
+// cppcheck-suppress unusedFunction
+uint8_t Crc_PatchCRC8H2F(uint8_t Crc_Crc,
+                         size_t Crc_Length,
+                         const Crc_PatchType Crc_Patches[],
+                         uint32_t Crc_PatchCount) {
+    return (uint8_t)patchCrc(Crc_Crc, Crc_Length, Crc_Patches, Crc_PatchCount,
+                             0xFF, calculateCRC8H2F, appendZerosCRC8H2F);
+}
+
+// cppcheck-suppress unusedFunction
+uint16_t Crc_PatchCRC16(uint16_t Crc_Crc,
+                        size_t Crc_Length,
+                        const Crc_PatchType Crc_Patches[],
+                        uint32_t Crc_PatchCount) {
+    return (uint16_t)patchCrc(Crc_Crc, Crc_Length, Crc_Patches, Crc_PatchCount,
+                              0x0000, calculateCRC16, appendZerosCRC16);
+}
+
+// cppcheck-suppress unusedFunction
+uint16_t Crc_PatchCRC16ARC(uint16_t Crc_Crc,
+                           size_t Crc_Length,
+                           const Crc_PatchType Crc_Patches[],
+                           uint32_t Crc_PatchCount) {
+    return (uint16_t)patchCrc(Crc_Crc, Crc_Length, Crc_Patches, Crc_PatchCount,
+                              0x0000, calculateCRC16ARC, appendZerosCRC16ARC);
+}
+
+// cppcheck-suppress unusedFunction
+uint32_t Crc_PatchCRC32(uint32_t Crc_Crc,
+                        size_t Crc_Length,
+                        const Crc_PatchType Crc_Patches[],
+                        uint32_t Crc_PatchCount) {
+    return (uint32_t)patchCrc(Crc_Crc, Crc_Length, Crc_Patches, Crc_PatchCount,
+                              0xFFFFFFFF, calculateCRC32, appendZerosCRC32);
+}
+
+// cppcheck-suppress unusedFunction
+uint32_t Crc_PatchCRC32P4(uint32_t Crc_Crc,
+                          size_t Crc_Length,
+                          const Crc_PatchType Crc_Patches[],
+                          uint32_t Crc_PatchCount) {
+    return (uint32_t)patchCrc(Crc_Crc, Crc_Length, Crc_Patches, Crc_PatchCount,
+                              0xFFFFFFFF, calculateCRC32P4, appendZerosCRC32P4);
+}
+
+// cppcheck-suppress unusedFunction
+uint64_t Crc_PatchCRC64(uint64_t Crc_Crc,
+                        size_t Crc_Length,
+                        const Crc_PatchType Crc_Patches[],
+                        uint32_t Crc_PatchCount) {
+    return patchCrc(Crc_Crc, Crc_Length, Crc_Patches, Crc_PatchCount,
+                    0xFFFFFFFFFFFFFFFF, calculateCRC64, appendZerosCRC64);
+}
@@ -0,0 +1,42 @@
+#ifndef CRC_REGISTER_H__
+#define CRC_REGISTER_H__
+
+/**
+ * @file CrcRegister.h
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief Raw CRC register update of every CRC library
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2021
+ *
+ * The CRC register is the CRC before the XOR value is applied, which is the
+ * Register of a Crc_ContextCRCxxType. Crc_UpdateCRCxxRegister divides the data
+ * by the polynomial and returns the new register, without the start value
+ * handling of SWS_Crc_00014 and SWS_Crc_00041 and without the XOR value, so
+ * a message in many parts costs one kernel call per part and nothing else.
+ *
+ * Every library implements these functions next to its Crc_CalculateCRCxxLong,
+ * which is Crc_UpdateCRCxxRegister between the start value and the XOR value.
+ * They are renamed with the Long functions where a library is compiled more
+ * than once, see crc/CMakeLists.txt.
+ *
+ */
+
+#include "Std_Types.h"
+
+uint8_t Crc_UpdateCRC8Register(uint8_t Crc_Register, const uint8_t* Crc_DataPtr, size_t Crc_Length);
+
+uint8_t Crc_UpdateCRC8H2FRegister(uint8_t Crc_Register, const uint8_t* Crc_DataPtr, size_t Crc_Length);
+
+uint16_t Crc_UpdateCRC16Register(uint16_t Crc_Register, const uint8_t* Crc_DataPtr, size_t Crc_Length);
+
+uint16_t Crc_UpdateCRC16ARCRegister(uint16_t Crc_Register, const uint8_t* Crc_DataPtr, size_t Crc_Length);
+
+uint32_t Crc_UpdateCRC32Register(uint32_t Crc_Register, const uint8_t* Crc_DataPtr, size_t Crc_Length);
+
+uint32_t Crc_UpdateCRC32P4Register(uint32_t Crc_Register, const uint8_t* Crc_DataPtr, size_t Crc_Length);
+
+uint64_t Crc_UpdateCRC64Register(uint64_t Crc_Register, const uint8_t* Crc_DataPtr, size_t Crc_Length);
+
+#endif  // CRC_REGISTER_H__
@@ -0,0 +1,197 @@
+/**
+ * @file CrcSegments.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * Scatter-gather calculation, see Crc.h. This file is part of every CRC
+ * library.
+ *
+ * The CRC register is carried from one segment to the next with the
+ * register update of the library, see CrcRegister.h. The start value and
+ * the XOR value are applied once, not per segment. Each segment is a
+ * separate kernel call, so crc_clmul folds a segment only if it is at
+ * least CRC_CLMUL_MIN_LENGTH bytes long.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "Crc.h"
+#include "CrcRegister.h"
+
+// cppcheck-suppress unusedFunction
+uint8_t Crc_CalculateCRC8V(const Crc_SegmentType Crc_Segments[],
+                           uint32_t Crc_SegmentCount,
+                           uint8_t Crc_StartValue8,
+                           bool Crc_IsFirstCall) {
+    uint8_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = 0xFF;
+    } else {
+        // SWS_Crc_00041
+        remainder = (uint8_t)(Crc_StartValue8 ^ 0xFF);
+    }
+
+    for (uint32_t segment = 0; segment < Crc_SegmentCount; ++segment) {
+        remainder = Crc_UpdateCRC8Register(remainder, Crc_Segments[segment].DataPtr, Crc_Segments[segment].Length);
+    }
+
+    /*
+     * The final remainder is the CRC result.
+     */
+    return (uint8_t)(remainder ^ 0xFF);
+}
+
+// cppcheck-suppress unusedFunction
+uint8_t Crc_CalculateCRC8H2FV(const Crc_SegmentType Crc_Segments[],
+                              uint32_t Crc_SegmentCount,
+                              uint8_t Crc_StartValue8H2F,
+                              bool Crc_IsFirstCall) {
+    uint8_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = 0xFF;
+    } else {
+        // SWS_Crc_00041
+        remainder = (uint8_t)(Crc_StartValue8H2F ^ 0xFF);
+    }
+
+    for (uint32_t segment = 0; segment < Crc_SegmentCount; ++segment) {
+        remainder = Crc_UpdateCRC8H2FRegister(remainder, Crc_Segments[segment].DataPtr, Crc_Segments[segment].Length);
+    }
+
+    /*
+     * The final remainder is the CRC result.
+     */
+    return (uint8_t)(remainder ^ 0xFF);
+}
+
+// cppcheck-suppress unusedFunction
+uint16_t Crc_CalculateCRC16V(const Crc_SegmentType Crc_Segments[],
+                             uint32_t Crc_SegmentCount,
+                             uint16_t Crc_StartValue16,
+                             bool Crc_IsFirstCall) {
+    uint16_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = 0xFFFF;
+    } else {
+        // SWS_Crc_00041
+        remainder = Crc_StartValue16;
+    }
+
+    for (uint32_t segment = 0; segment < Crc_SegmentCount; ++segment) {
+        remainder = Crc_UpdateCRC16Register(remainder, Crc_Segments[segment].DataPtr, Crc_Segments[segment].Length);
+    }
+
+    /*
+     * The final remainder is the CRC result.
+     */
+    return remainder ^ 0x0000;
+}
+
+// cppcheck-suppress unusedFunction
+uint16_t Crc_CalculateCRC16ARCV(const Crc_SegmentType Crc_Segments[],
+                                uint32_t Crc_SegmentCount,
+                                uint16_t Crc_StartValue16,
+                                bool Crc_IsFirstCall) {
+    uint16_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = 0x0000;
+    } else {
+        // SWS_Crc_00041
+        remainder = Crc_StartValue16;
+    }
+
+    for (uint32_t segment = 0; segment < Crc_SegmentCount; ++segment) {
+        remainder = Crc_UpdateCRC16ARCRegister(remainder, Crc_Segments[segment].DataPtr, Crc_Segments[segment].Length);
+    }
+
+    /*
+     * The final remainder is the CRC result.
+     */
+    return remainder ^ 0x0000;
+}
+
+// cppcheck-suppress unusedFunction
+uint32_t Crc_CalculateCRC32V(const Crc_SegmentType Crc_Segments[],
+                             uint32_t Crc_SegmentCount,
+                             uint32_t Crc_StartValue32,
+                             bool Crc_IsFirstCall) {
+    uint32_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = 0xFFFFFFFF;
+    } else {
+        // SWS_Crc_00041
+        remainder = Crc_StartValue32 ^ 0xFFFFFFFF;
+    }
+
+    for (uint32_t segment = 0; segment < Crc_SegmentCount; ++segment) {
+        remainder = Crc_UpdateCRC32Register(remainder, Crc_Segments[segment].DataPtr, Crc_Segments[segment].Length);
+    }
+
+    /*
+     * The final remainder is the CRC result.
+     */
+    return remainder ^ 0xFFFFFFFF;
+}
+
+// cppcheck-suppress unusedFunction
+uint32_t Crc_CalculateCRC32P4V(const Crc_SegmentType Crc_Segments[],
+                               uint32_t Crc_SegmentCount,
+                               uint32_t Crc_StartValue32,
+                               bool Crc_IsFirstCall) {
+    uint32_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = 0xFFFFFFFF;
+    } else {
+        // SWS_Crc_00041
+        remainder = Crc_StartValue32 ^ 0xFFFFFFFF;
+    }
+
+    for (uint32_t segment = 0; segment < Crc_SegmentCount; ++segment) {
+        remainder = Crc_UpdateCRC32P4Register(remainder, Crc_Segments[segment].DataPtr, Crc_Segments[segment].Length);
+    }
+
+    /*
+     * The final remainder is the CRC result.
+     */
+    return remainder ^ 0xFFFFFFFF;
+}
+
+// cppcheck-suppress unusedFunction
+uint64_t Crc_CalculateCRC64V(const Crc_SegmentType Crc_Segments[],
+                             uint32_t Crc_SegmentCount,
+                             uint64_t Crc_StartValue64,
+                             bool Crc_IsFirstCall) {
+    uint64_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = 0xFFFFFFFFFFFFFFFF;
+    } else {
+        // SWS_Crc_00041
+        remainder = Crc_StartValue64 ^ 0xFFFFFFFFFFFFFFFF;
+    }
+
+    for (uint32_t segment = 0; segment < Crc_SegmentCount; ++segment) {
+        remainder = Crc_UpdateCRC64Register(remainder, Crc_Segments[segment].DataPtr, Crc_Segments[segment].Length);
+    }
+
+    /*
+     * The final remainder is the CRC result.
+     */
+    return remainder ^ 0xFFFFFFFFFFFFFFFF;
+}
@@ -0,0 +1,147 @@
+/**
+ * @file CrcStream.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * Streaming calculation, see Crc.h. This file is part of every CRC
+ * library.
+ *
+ * The context holds the CRC register, the CRC before the XOR value is
+ * applied. Each update passes it to the register update of the library,
+ * see CrcRegister.h, so the parts are calculated by the implementation of
+ * the library without restarting it.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "Crc.h"
+#include "CrcRegister.h"
+
+// cppcheck-suppress unusedFunction
+void Crc_InitCRC8(Crc_ContextCRC8Type* Crc_Context) {
+    // SWS_Crc_00014
+    Crc_Context->Register = 0xFF;
+}
+
+// cppcheck-suppress unusedFunction
+void Crc_UpdateCRC8(Crc_ContextCRC8Type* Crc_Context,
+                    const uint8_t* Crc_DataPtr,
+                    size_t Crc_Length) {
+    Crc_Context->Register = Crc_UpdateCRC8Register(Crc_Context->Register, Crc_DataPtr, Crc_Length);
+}
+
+// cppcheck-suppress unusedFunction
+uint8_t Crc_FinalCRC8(const Crc_ContextCRC8Type* Crc_Context) {
+    return (uint8_t)(Crc_Context->Register ^ 0xFF);
+}
+
+// cppcheck-suppress unusedFunction
+void Crc_InitCRC8H2F(Crc_ContextCRC8H2FType* Crc_Context) {
+    // SWS_Crc_00014
+    Crc_Context->Register = 0xFF;
+}
+
+// cppcheck-suppress unusedFunction
+void Crc_UpdateCRC8H2F(Crc_ContextCRC8H2FType* Crc_Context,
+                       const uint8_t* Crc_DataPtr,
+                       size_t Crc_Length) {
+    Crc_Context->Register = Crc_UpdateCRC8H2FRegister(Crc_Context->Register, Crc_DataPtr, Crc_Length);
+}
+
+// cppcheck-suppress unusedFunction
+uint8_t Crc_FinalCRC8H2F(const Crc_ContextCRC8H2FType* Crc_Context) {
+    return (uint8_t)(Crc_Context->Register ^ 0xFF);
+}
+
+// cppcheck-suppress unusedFunction
+void Crc_InitCRC16(Crc_ContextCRC16Type* Crc_Context) {
+    // SWS_Crc_00014
+    Crc_Context->Register = 0xFFFF;
+}
+
+// cppcheck-suppress unusedFunction
+void Crc_UpdateCRC16(Crc_ContextCRC16Type* Crc_Context,
+                     const uint8_t* Crc_DataPtr,
+                     size_t Crc_Length) {
+    Crc_Context->Register = Crc_UpdateCRC16Register(Crc_Context->Register, Crc_DataPtr, Crc_Length);
+}
+
+// cppcheck-suppress unusedFunction
+uint16_t Crc_FinalCRC16(const Crc_ContextCRC16Type* Crc_Context) {
+    return (uint16_t)(Crc_Context->Register ^ 0x0000);
+}
+
+// cppcheck-suppress unusedFunction
+void Crc_InitCRC16ARC(Crc_ContextCRC16ARCType* Crc_Context) {
+    // SWS_Crc_00014
+    Crc_Context->Register = 0x0000;
+}
+
+// cppcheck-suppress unusedFunction
+void Crc_UpdateCRC16ARC(Crc_ContextCRC16ARCType* Crc_Context,
+                        const uint8_t* Crc_DataPtr,
+                        size_t Crc_Length) {
+    Crc_Context->Register = Crc_UpdateCRC16ARCRegister(Crc_Context->Register, Crc_DataPtr, Crc_Length);
+}
+
+// cppcheck-suppress unusedFunction
+uint16_t Crc_FinalCRC16ARC(const Crc_ContextCRC16ARCType* Crc_Context) {
+    return (uint16_t)(Crc_Context->Register ^ 0x0000);
+}
+
+// cppcheck-suppress unusedFunction
+void Crc_InitCRC32(Crc_ContextCRC32Type* Crc_Context) {
+    // SWS_Crc_00014
+    Crc_Context->Register = 0xFFFFFFFF;
+}
+
+// cppcheck-suppress unusedFunction
+void Crc_UpdateCRC32(Crc_ContextCRC32Type* Crc_Context,
+                     const uint8_t* Crc_DataPtr,
+                     size_t Crc_Length) {
+    Crc_Context->Register = Crc_UpdateCRC32Register(Crc_Context->Register, Crc_DataPtr, Crc_Length);
+}
+
+// cppcheck-suppress unusedFunction
+uint32_t Crc_FinalCRC32(const Crc_ContextCRC32Type* Crc_Context) {
+    return (uint32_t)(Crc_Context->Register ^ 0xFFFFFFFF);
+}
+
+// cppcheck-suppress unusedFunction
+void Crc_InitCRC32P4(Crc_ContextCRC32P4Type* Crc_Context) {
+    // SWS_Crc_00014
+    Crc_Context->Register = 0xFFFFFFFF;
+}
+
+// cppcheck-suppress unusedFunction
+void Crc_UpdateCRC32P4(Crc_ContextCRC32P4Type* Crc_Context,
+                       const uint8_t* Crc_DataPtr,
+                       size_t Crc_Length) {
+    Crc_Context->Register = Crc_UpdateCRC32P4Register(Crc_Context->Register, Crc_DataPtr, Crc_Length);
+}
+
+// cppcheck-suppress unusedFunction
+uint32_t Crc_FinalCRC32P4(const Crc_ContextCRC32P4Type* Crc_Context) {
+    return (uint32_t)(Crc_Context->Register ^ 0xFFFFFFFF);
+}
+
+// cppcheck-suppress unusedFunction
+void Crc_InitCRC64(Crc_ContextCRC64Type* Crc_Context) {
+    // SWS_Crc_00014
+    Crc_Context->Register = 0xFFFFFFFFFFFFFFFF;
+}
+
+// cppcheck-suppress unusedFunction
+void Crc_UpdateCRC64(Crc_ContextCRC64Type* Crc_Context,
+                     const uint8_t* Crc_DataPtr,
+                     size_t Crc_Length) {
+    Crc_Context->Register = Crc_UpdateCRC64Register(Crc_Context->Register, Crc_DataPtr, Crc_Length);
+}
+
+// cppcheck-suppress unusedFunction
+uint64_t Crc_FinalCRC64(const Crc_ContextCRC64Type* Crc_Context) {
+    return (Crc_Context->Register ^ 0xFFFFFFFFFFFFFFFF);
+}
@@ -0,0 +1,74 @@
+/**
+ * @file Crc8.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * The Crc_CalculateCRC8 function uses the PSHUFB nibble map kernel in
+ * CrcShuffle.h instead of a 256-entry lookup table. Fold<k> is the map
+ * v * x^(8k) mod P for the polynomial 0x1D.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "Crc.h"
+#include "CrcRegister.h"
+#include "CrcShuffle.h"
+
+static const CrcShuffle_ConstantsType shuffleConstants = {
+    .Fold32 = {
+        .Low = {0x00, 0x02, 0x04, 0x06, 0x08, 0x0A, 0x0C, 0x0E, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1A, 0x1C, 0x1E},
+        .High = {0x00, 0x20, 0x40, 0x60, 0x80, 0xA0, 0xC0, 0xE0, 0x1D, 0x3D, 0x5D, 0x7D, 0x9D, 0xBD, 0xDD, 0xFD}
+    },
+    .Fold16 = {
+        .Low = {0x00, 0x85, 0x17, 0x92, 0x2E, 0xAB, 0x39, 0xBC, 0x5C, 0xD9, 0x4B, 0xCE, 0x72, 0xF7, 0x65, 0xE0},
+        .High = {0x00, 0xB8, 0x6D, 0xD5, 0xDA, 0x62, 0xB7, 0x0F, 0xA9, 0x11, 0xC4, 0x7C, 0x73, 0xCB, 0x1E, 0xA6}
+    },
+    .Fold8 = {
+        .Low = {0x00, 0x5F, 0xBE, 0xE1, 0x61, 0x3E, 0xDF, 0x80, 0xC2, 0x9D, 0x7C, 0x23, 0xA3, 0xFC, 0x1D, 0x42},
+        .High = {0x00, 0x99, 0x2F, 0xB6, 0x5E, 0xC7, 0x71, 0xE8, 0xBC, 0x25, 0x93, 0x0A, 0xE2, 0x7B, 0xCD, 0x54}
+    },
+    .Fold4 = {
+        .Low = {0x00, 0x9D, 0x27, 0xBA, 0x4E, 0xD3, 0x69, 0xF4, 0x9C, 0x01, 0xBB, 0x26, 0xD2, 0x4F, 0xF5, 0x68},
+        .High = {0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB1, 0xDE, 0xFB, 0x35, 0x10, 0x7F, 0x5A, 0xA1, 0x84, 0xEB, 0xCE}
+    },
+    .Fold2 = {
+        .Low = {0x00, 0x4C, 0x98, 0xD4, 0x2D, 0x61, 0xB5, 0xF9, 0x5A, 0x16, 0xC2, 0x8E, 0x77, 0x3B, 0xEF, 0xA3},
+        .High = {0x00, 0xB4, 0x75, 0xC1, 0xEA, 0x5E, 0x9F, 0x2B, 0xC9, 0x7D, 0xBC, 0x08, 0x23, 0x97, 0x56, 0xE2}
+    },
+    .Fold1 = {
+        .Low = {0x00, 0x1D, 0x3A, 0x27, 0x74, 0x69, 0x4E, 0x53, 0xE8, 0xF5, 0xD2, 0xCF, 0x9C, 0x81, 0xA6, 0xBB},
+        .High = {0x00, 0xCD, 0x87, 0x4A, 0x13, 0xDE, 0x94, 0x59, 0x26, 0xEB, 0xA1, 0x6C, 0x35, 0xF8, 0xB2, 0x7F}
+    }
+};
+
+uint8_t Crc_UpdateCRC8Register(uint8_t Crc_Register,
+                               const uint8_t* Crc_DataPtr,
+                               size_t Crc_Length) {
+    return CrcShuffle_Crc8(Crc_Register, Crc_DataPtr, Crc_Length, &shuffleConstants);
+}
+
+// cppcheck-suppress unusedFunction
+uint8_t Crc_CalculateCRC8Long(const uint8_t* Crc_DataPtr,
+                              size_t Crc_Length,
+                              uint8_t Crc_StartValue8,
+                              bool Crc_IsFirstCall) {
+    uint8_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = 0xFF;
+    } else {
+        // SWS_Crc_00041
+        remainder = (Crc_StartValue8 ^ 0xFF);
+    }
+
+    remainder = Crc_UpdateCRC8Register(remainder, Crc_DataPtr, Crc_Length);
+
+    /*
+     * The final remainder is the CRC result.
+     */
+    return remainder ^ 0xFF;
+}
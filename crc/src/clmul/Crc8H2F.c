@@ -0,0 +1,74 @@
+/**
+ * @file Crc8H2F.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * The Crc_CalculateCRC8H2F function uses the PSHUFB nibble map kernel in
+ * CrcShuffle.h instead of a 256-entry lookup table. Fold<k> is the map
+ * v * x^(8k) mod P for the polynomial 0x2F.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "Crc.h"
+#include "CrcRegister.h"
+#include "CrcShuffle.h"
+
+static const CrcShuffle_ConstantsType shuffleConstants = {
+    .Fold32 = {
+        .Low = {0x00, 0x04, 0x08, 0x0C, 0x10, 0x14, 0x18, 0x1C, 0x20, 0x24, 0x28, 0x2C, 0x30, 0x34, 0x38, 0x3C},
+        .High = {0x00, 0x40, 0x80, 0xC0, 0x2F, 0x6F, 0xAF, 0xEF, 0x5E, 0x1E, 0xDE, 0x9E, 0x71, 0x31, 0xF1, 0xB1}
+    },
+    .Fold16 = {
+        .Low = {0x00, 0x02, 0x04, 0x06, 0x08, 0x0A, 0x0C, 0x0E, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1A, 0x1C, 0x1E},
+        .High = {0x00, 0x20, 0x40, 0x60, 0x80, 0xA0, 0xC0, 0xE0, 0x2F, 0x0F, 0x6F, 0x4F, 0xAF, 0x8F, 0xEF, 0xCF}
+    },
+    .Fold8 = {
+        .Low = {0x00, 0x64, 0xC8, 0xAC, 0xBF, 0xDB, 0x77, 0x13, 0x51, 0x35, 0x99, 0xFD, 0xEE, 0x8A, 0x26, 0x42},
+        .High = {0x00, 0xA2, 0x6B, 0xC9, 0xD6, 0x74, 0xBD, 0x1F, 0x83, 0x21, 0xE8, 0x4A, 0x55, 0xF7, 0x3E, 0x9C}
+    },
+    .Fold4 = {
+        .Low = {0x00, 0xB5, 0x45, 0xF0, 0x8A, 0x3F, 0xCF, 0x7A, 0x3B, 0x8E, 0x7E, 0xCB, 0xB1, 0x04, 0xF4, 0x41},
+        .High = {0x00, 0x76, 0xEC, 0x9A, 0xF7, 0x81, 0x1B, 0x6D, 0xC1, 0xB7, 0x2D, 0x5B, 0x36, 0x40, 0xDA, 0xAC}
+    },
+    .Fold2 = {
+        .Low = {0x00, 0xE9, 0xFD, 0x14, 0xD5, 0x3C, 0x28, 0xC1, 0x85, 0x6C, 0x78, 0x91, 0x50, 0xB9, 0xAD, 0x44},
+        .High = {0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB1, 0xDE, 0xFB, 0x07, 0x22, 0x4D, 0x68, 0x93, 0xB6, 0xD9, 0xFC}
+    },
+    .Fold1 = {
+        .Low = {0x00, 0x2F, 0x5E, 0x71, 0xBC, 0x93, 0xE2, 0xCD, 0x57, 0x78, 0x09, 0x26, 0xEB, 0xC4, 0xB5, 0x9A},
+        .High = {0x00, 0xAE, 0x73, 0xDD, 0xE6, 0x48, 0x95, 0x3B, 0xE3, 0x4D, 0x90, 0x3E, 0x05, 0xAB, 0x76, 0xD8}
+    }
+};
+
+uint8_t Crc_UpdateCRC8H2FRegister(uint8_t Crc_Register,
+                                  const uint8_t* Crc_DataPtr,
+                                  size_t Crc_Length) {
+    return CrcShuffle_Crc8(Crc_Register, Crc_DataPtr, Crc_Length, &shuffleConstants);
+}
+
+// cppcheck-suppress unusedFunction
+uint8_t Crc_CalculateCRC8H2FLong(const uint8_t* Crc_DataPtr,
+                                 size_t Crc_Length,
+                                 uint8_t Crc_StartValue8H2F,
+                                 bool Crc_IsFirstCall) {
+    uint8_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = 0xFF;
+    } else {
+        // SWS_Crc_00041
+        remainder = (Crc_StartValue8H2F ^ 0xFF);
+    }
+
+    remainder = Crc_UpdateCRC8H2FRegister(remainder, Crc_DataPtr, Crc_Length);
+
+    /*
+     * The final remainder is the CRC result.
+     */
+    return remainder ^ 0xFF;
+}
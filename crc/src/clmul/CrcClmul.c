@@ -0,0 +1,335 @@
+/**
+ * @file CrcClmul.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * Carry-less multiplication folding, see CrcClmul.h.
+ *
+ * A 128-bit lane holds the next 16 message bytes. In the reflected domain
+ * the first byte is in the low bits, which are the highest powers of x.
+ * In the normal domain the bytes are reversed when loaded, so that the first
+ * byte ends up in the high bits. The two 64-bit halves of a lane are moved
+ * D bits further down the message by multiplying them with x^D and
+ * x^(D+64) mod P, which is two carry-less multiplications by precomputed
+ * constants. After the last lane the remaining 128 bits are reduced to the
+ * CRC width with a Barrett reduction.
+ *
+ * The wide kernel does the same with four 512-bit registers, each holding
+ * four consecutive 128-bit lanes, and merges them back into a single
+ * 128-bit lane before the reduction.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "CrcClmul.h"
+
+#include <stdatomic.h>
+
+/*
+ * Written by the crc_dispatch tier selection while the worker threads of
+ * Crc_CalculateCRCxxParallel may be folding. Relaxed accesses suffice,
+ * either kernel computes the same CRC.
+ */
+static atomic_bool wideEnabled = true;
+
+void CrcClmul_SetWideEnabled(bool Enabled) {
+    atomic_store_explicit(&wideEnabled, Enabled, memory_order_relaxed);
+}
+
+#if defined(__x86_64__)
+
+#include <immintrin.h>
+
+#define CRC_CLMUL_TARGET __attribute__((target("pclmul,ssse3")))
+#define CRC_CLMUL_INLINE __attribute__((target("pclmul,ssse3"), always_inline)) inline
+#define CRC_CLMUL_WIDE_TARGET __attribute__((target("pclmul,ssse3,avx512f,vpclmulqdq")))
+#define CRC_CLMUL_WIDE_INLINE __attribute__((target("pclmul,ssse3,avx512f,vpclmulqdq"), always_inline)) inline
+
+CRC_CLMUL_INLINE
+static __m128i load128(const uint8_t* data, bool reverse) {
+    const __m128i lane = _mm_loadu_si128((const __m128i*)data);
+
+    if (reverse) {
+        return _mm_shuffle_epi8(lane, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+    }
+
+    return lane;
+}
+
+CRC_CLMUL_INLINE
+static uint64_t low64(__m128i value) {
+    return (uint64_t)_mm_cvtsi128_si64(value);
+}
+
+CRC_CLMUL_INLINE
+static uint64_t high64(__m128i value) {
+    return (uint64_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(value, value));
+}
+
+CRC_CLMUL_INLINE
+static __m128i multiply(uint64_t a, uint64_t b) {
+    return _mm_clmulepi64_si128(_mm_cvtsi64_si128((long long)a), _mm_cvtsi64_si128((long long)b), 0x00);
+}
+
+CRC_CLMUL_INLINE
+static __m128i fold(__m128i lane, __m128i constants) {
+    return _mm_xor_si128(_mm_clmulepi64_si128(lane, constants, 0x00),
+                         _mm_clmulepi64_si128(lane, constants, 0x11));
+}
+
+/*
+ * Folds all lanes of the message into a single lane. The first lane, with
+ * the remainder already added, is passed in x0.
+ */
+CRC_CLMUL_INLINE
+static __m128i foldLanes(__m128i x0,
+                         const uint8_t* data,
+                         size_t length,
+                         const CrcClmul_ConstantsType* constants,
+                         bool reverse) {
+    const __m128i fold128 = _mm_set_epi64x((long long)constants->Fold128[1], (long long)constants->Fold128[0]);
+
+    if (length >= 64) {
+        /*
+         * Fold four independent lanes at a time to hide the multiplication latency.
+         */
+        const __m128i fold512 = _mm_set_epi64x((long long)constants->Fold512[1], (long long)constants->Fold512[0]);
+        __m128i x1 = load128(&data[16], reverse);
+        __m128i x2 = load128(&data[32], reverse);
+        __m128i x3 = load128(&data[48], reverse);
+        data += 64;
+        length -= 64;
+
+        while (length >= 64) {
+            x0 = _mm_xor_si128(fold(x0, fold512), load128(&data[0], reverse));
+            x1 = _mm_xor_si128(fold(x1, fold512), load128(&data[16], reverse));
+            x2 = _mm_xor_si128(fold(x2, fold512), load128(&data[32], reverse));
+            x3 = _mm_xor_si128(fold(x3, fold512), load128(&data[48], reverse));
+            data += 64;
+            length -= 64;
+        }
+
+        x1 = _mm_xor_si128(fold(x0, fold128), x1);
+        x2 = _mm_xor_si128(fold(x1, fold128), x2);
+        x0 = _mm_xor_si128(fold(x2, fold128), x3);
+    } else {
+        data += 16;
+        length -= 16;
+    }
+
+    while (length >= 16) {
+        x0 = _mm_xor_si128(fold(x0, fold128), load128(data, reverse));
+        data += 16;
+        length -= 16;
+    }
+
+    return x0;
+}
+
+/*
+ * Computes (lane * x^Width) mod P for a reflected lane.
+ */
+CRC_CLMUL_INLINE
+static uint64_t reduceReflected(__m128i lane, const CrcClmul_ConstantsType* constants) {
+    const unsigned width = constants->Width;
+    const uint64_t widthMask = (width < 64) ? ((1ULL << width) - 1) : ~0ULL;
+
+    /*
+     * S = L * x^(64+Width) + H * x^Width, which is at most 64+Width bits.
+     * Reflected, H * x^Width is H moved (64-Width) bits towards the low end.
+     */
+    const uint64_t high = high64(lane);
+    const __m128i product = multiply(low64(lane), constants->Reduce);
+    const uint64_t sLow = low64(product) ^ (high << (64 - width));
+    const uint64_t sHigh = high64(product) ^ ((width < 64) ? (high >> width) : 0);
+
+    /*
+     * Barrett reduction: the quotient q = floor(S / x^Width * Mu / x^64) and
+     * S mod P = (S mod x^Width) + (q * P mod x^Width).
+     */
+    const uint64_t sQuotient = (width < 64) ? ((sLow >> (64 - width)) | (sHigh << width)) : sLow;
+    const uint64_t quotient = low64(multiply(sQuotient, constants->Mu));
+    const __m128i qp = multiply(quotient, constants->Polynomial);
+
+    uint64_t remainder = sHigh >> (64 - width);
+    if (width < 64) {
+        remainder ^= (high64(qp) >> (63 - width)) & widthMask;
+    } else {
+        remainder ^= (high64(qp) << 1) | (low64(qp) >> 63);
+    }
+
+    return remainder;
+}
+
+/*
+ * Computes (lane * x^Width) mod P for a normal (byte reversed) lane.
+ */
+CRC_CLMUL_INLINE
+static uint64_t reduceNormal(__m128i lane, const CrcClmul_ConstantsType* constants) {
+    const unsigned width = constants->Width;
+    const uint64_t widthMask = (1ULL << width) - 1;
+
+    /*
+     * S = H * x^(64+Width) + L * x^Width, which is at most 64+Width bits.
+     */
+    const uint64_t low = low64(lane);
+    const __m128i product = multiply(high64(lane), constants->Reduce);
+    const uint64_t sLow = low64(product) ^ (low << width);
+    const uint64_t sHigh = high64(product) ^ (low >> (64 - width));
+
+    /*
+     * Barrett reduction: the quotient q = floor(S / x^Width * (x^64 + Mu) / x^64) and
+     * S mod P = (S mod x^Width) + (q * P mod x^Width).
+     */
+    const uint64_t sQuotient = (sLow >> width) | (sHigh << (64 - width));
+    const uint64_t quotient = sQuotient ^ high64(multiply(sQuotient, constants->Mu));
+
+    return (sLow ^ low64(multiply(quotient, constants->Polynomial))) & widthMask;
+}
+
+CRC_CLMUL_WIDE_INLINE
+static __m512i broadcast512(const uint64_t constants[2]) {
+    return _mm512_broadcast_i32x4(_mm_set_epi64x((long long)constants[1], (long long)constants[0]));
+}
+
+/*
+ * Folds the four 128-bit lanes of a 512-bit register and adds the next lanes.
+ */
+CRC_CLMUL_WIDE_INLINE
+static __m512i foldWide(__m512i lanes, __m512i constants, __m512i next) {
+    return _mm512_ternarylogic_epi64(_mm512_clmulepi64_epi128(lanes, constants, 0x00),
+                                     _mm512_clmulepi64_epi128(lanes, constants, 0x11),
+                                     next,
+                                     0x96);
+}
+
+/*
+ * Folds a reflected message of at least 256 bytes into a single lane with
+ * VPCLMULQDQ. The length must be a multiple of 16.
+ */
+CRC_CLMUL_WIDE_TARGET
+static __m128i foldLanesWide(uint64_t remainder,
+                             const uint8_t* data,
+                             size_t length,
+                             const CrcClmul_ConstantsType* constants) {
+    const __m512i fold2048 = broadcast512(constants->Fold2048);
+    const __m512i fold512 = broadcast512(constants->Fold512);
+    const __m128i fold128 = _mm_set_epi64x((long long)constants->Fold128[1], (long long)constants->Fold128[0]);
+
+    __m512i z0 = _mm512_xor_si512(_mm512_loadu_si512(&data[0]),
+                                  _mm512_zextsi128_si512(_mm_cvtsi64_si128((long long)remainder)));
+    __m512i z1 = _mm512_loadu_si512(&data[64]);
+    __m512i z2 = _mm512_loadu_si512(&data[128]);
+    __m512i z3 = _mm512_loadu_si512(&data[192]);
+    data += 256;
+    length -= 256;
+
+    while (length >= 256) {
+        z0 = foldWide(z0, fold2048, _mm512_loadu_si512(&data[0]));
+        z1 = foldWide(z1, fold2048, _mm512_loadu_si512(&data[64]));
+        z2 = foldWide(z2, fold2048, _mm512_loadu_si512(&data[128]));
+        z3 = foldWide(z3, fold2048, _mm512_loadu_si512(&data[192]));
+        data += 256;
+        length -= 256;
+    }
+
+    z1 = foldWide(z0, fold512, z1);
+    z2 = foldWide(z1, fold512, z2);
+    z0 = foldWide(z2, fold512, z3);
+
+    while (length >= 64) {
+        z0 = foldWide(z0, fold512, _mm512_loadu_si512(data));
+        data += 64;
+        length -= 64;
+    }
+
+    __m128i x0 = _mm512_extracti32x4_epi32(z0, 0);
+    x0 = _mm_xor_si128(fold(x0, fold128), _mm512_extracti32x4_epi32(z0, 1));
+    x0 = _mm_xor_si128(fold(x0, fold128), _mm512_extracti32x4_epi32(z0, 2));
+    x0 = _mm_xor_si128(fold(x0, fold128), _mm512_extracti32x4_epi32(z0, 3));
+
+    while (length >= 16) {
+        x0 = _mm_xor_si128(fold(x0, fold128), load128(data, false));
+        data += 16;
+        length -= 16;
+    }
+
+    return x0;
+}
+
+bool CrcClmul_IsAvailable(void) {
+    return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3");
+}
+
+bool CrcClmul_IsWideAvailable(void) {
+    return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("vpclmulqdq");
+}
+
+CRC_CLMUL_TARGET
+uint64_t CrcClmul_FoldReflected(uint64_t Remainder,
+                                const uint8_t* DataPtr,
+                                size_t Length,
+                                const CrcClmul_ConstantsType* Constants) {
+    const bool wide = atomic_load_explicit(&wideEnabled, memory_order_relaxed);
+
+    if ((Length >= CRC_CLMUL_WIDE_MIN_LENGTH) && wide && CrcClmul_IsWideAvailable()) {
+        return reduceReflected(foldLanesWide(Remainder, DataPtr, Length, Constants), Constants);
+    }
+
+    /*
+     * The remainder is added to the first message bytes.
+     */
+    const __m128i x0 = _mm_xor_si128(load128(DataPtr, false), _mm_cvtsi64_si128((long long)Remainder));
+
+    return reduceReflected(foldLanes(x0, DataPtr, Length, Constants, false), Constants);
+}
+
+CRC_CLMUL_TARGET
+uint64_t CrcClmul_FoldNormal(uint64_t Remainder,
+                             const uint8_t* DataPtr,
+                             size_t Length,
+                             const CrcClmul_ConstantsType* Constants) {
+    /*
+     * The remainder is added to the first message bytes, which are the high
+     * bits of the reversed lane.
+     */
+    const uint64_t alignedRemainder = Remainder << (64 - Constants->Width);
+    const __m128i x0 = _mm_xor_si128(load128(DataPtr, true), _mm_set_epi64x((long long)alignedRemainder, 0));
+
+    return reduceNormal(foldLanes(x0, DataPtr, Length, Constants, true), Constants);
+}
+
+#else
+
+bool CrcClmul_IsAvailable(void) {
+    return false;
+}
+
+bool CrcClmul_IsWideAvailable(void) {
+    return false;
+}
+
+uint64_t CrcClmul_FoldReflected(uint64_t Remainder,
+                                const uint8_t* DataPtr,
+                                size_t Length,
+                                const CrcClmul_ConstantsType* Constants) {
+    (void)DataPtr;
+    (void)Length;
+    (void)Constants;
+    return Remainder;
+}
+
+uint64_t CrcClmul_FoldNormal(uint64_t Remainder,
+                             const uint8_t* DataPtr,
+                             size_t Length,
+                             const CrcClmul_ConstantsType* Constants) {
+    (void)DataPtr;
+    (void)Length;
+    (void)Constants;
+    return Remainder;
+}
+
+#endif
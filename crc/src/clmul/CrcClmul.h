@@ -0,0 +1,116 @@
+#ifndef CRC_CLMUL_H__
+#define CRC_CLMUL_H__
+
+/**
+ * @file CrcClmul.h
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief Carry-less multiplication kernels for the accelerated CRC library
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2021
+ *
+ * The kernels fold the message 128 bits at a time with PCLMULQDQ and reduce the
+ * last 128 bits with a Barrett reduction, as described in:
+ *
+ * [1] V. Gopal et al., "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ
+ *     Instruction", Intel, 2009
+ *
+ * On CPUs with AVX-512F and VPCLMULQDQ, reflected messages of at least
+ * CRC_CLMUL_WIDE_MIN_LENGTH bytes are folded four 512-bit lanes at a time instead.
+ *
+ * The kernels work on the CRC remainder directly, initial value and XOR value are
+ * handled by the Crc_CalculateCRCxx functions. They are only compiled for x86-64,
+ * CrcClmul_IsAvailable() returns false on other targets and on CPUs without PCLMULQDQ
+ * and SSSE3.
+ *
+ */
+
+#include "Std_Types.h"
+#include "Crc_Generic.h"
+
+/**
+ * Shortest message, in bytes, for which the carry-less multiplication kernels are used.
+ * Shorter messages are faster with the lookup table. Can be set with the
+ * CRC_CLMUL_MIN_LENGTH CMake cache variable, must be at least 16.
+ */
+#ifndef CRC_CLMUL_MIN_LENGTH
+#define CRC_CLMUL_MIN_LENGTH 16U
+#endif
+
+#if CRC_CLMUL_MIN_LENGTH < 16
+#error "CRC_CLMUL_MIN_LENGTH must be at least 16, the kernels fold whole 16-byte lanes"
+#endif
+
+/**
+ * Shortest message, in bytes, for which CrcClmul_FoldReflected uses 512-bit VPCLMULQDQ
+ * folding when the CPU supports it. Below this the startup and lane merging cost more
+ * than the wider loop saves. Can be set with the CRC_CLMUL_WIDE_MIN_LENGTH CMake cache
+ * variable, must be at least 256.
+ */
+#ifndef CRC_CLMUL_WIDE_MIN_LENGTH
+#define CRC_CLMUL_WIDE_MIN_LENGTH 512U
+#endif
+
+#if CRC_CLMUL_WIDE_MIN_LENGTH < 256
+#error "CRC_CLMUL_WIDE_MIN_LENGTH must be at least 256, the wide kernel folds whole 256-byte blocks"
+#endif
+
+/**
+ * Folding and reduction constants for one CRC polynomial, see Crc_Generic.h
+ */
+typedef Crc_FoldConstantsType CrcClmul_ConstantsType;
+
+/**
+ * Tells whether the carry-less multiplication kernels can be used on this CPU.
+ *
+ * @return true if the CPU supports PCLMULQDQ and SSSE3
+ */
+bool CrcClmul_IsAvailable(void);
+
+/**
+ * Tells whether the AVX-512 kernel of CrcClmul_FoldReflected can be used on this CPU.
+ *
+ * @return true if the CPU supports AVX-512F and VPCLMULQDQ
+ */
+bool CrcClmul_IsWideAvailable(void);
+
+/**
+ * Allows or prevents the AVX-512 kernel in CrcClmul_FoldReflected. It is allowed by
+ * default, crc_dispatch prevents it to select the 128-bit kernel on CPUs that have both.
+ *
+ * @param Enabled   true to use the AVX-512 kernel when the CPU supports it
+ */
+void CrcClmul_SetWideEnabled(bool Enabled);
+
+/**
+ * Divides a message by a reflected CRC polynomial using carry-less multiplication.
+ * Must only be called if CrcClmul_IsAvailable() returns true.
+ *
+ * @param Remainder     The reflected CRC remainder before the message
+ * @param DataPtr       Pointer to the message
+ * @param Length        Length of the message in bytes, a non-zero multiple of 16
+ * @param Constants     Folding and reduction constants of the polynomial
+ * @return uint64_t     The reflected CRC remainder after the message
+ */
+uint64_t CrcClmul_FoldReflected(uint64_t Remainder,
+                                const uint8_t* DataPtr,
+                                size_t Length,
+                                const CrcClmul_ConstantsType* Constants);
+
+/**
+ * Divides a message by a non-reflected CRC polynomial using carry-less multiplication.
+ * Must only be called if CrcClmul_IsAvailable() returns true.
+ *
+ * @param Remainder     The CRC remainder before the message
+ * @param DataPtr       Pointer to the message
+ * @param Length        Length of the message in bytes, a non-zero multiple of 16
+ * @param Constants     Folding and reduction constants of the polynomial, Width below 64
+ * @return uint64_t     The CRC remainder after the message
+ */
+uint64_t CrcClmul_FoldNormal(uint64_t Remainder,
+                             const uint8_t* DataPtr,
+                             size_t Length,
+                             const CrcClmul_ConstantsType* Constants);
+
+#endif  // CRC_CLMUL_H__
@@ -0,0 +1,173 @@
+/**
+ * @file CrcShuffle.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * Table-free 8-bit CRC with PSHUFB nibble maps, see CrcShuffle.h.
+ *
+ * The message is processed as a short head followed by complete blocks.
+ * The head is moved to the end of a block and the rest of the block is
+ * cleared, which does not change the CRC since leading zero bytes with a
+ * zero remainder contribute nothing. The incoming remainder is added to
+ * the first head byte.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "CrcShuffle.h"
+
+static uint8_t applyMap(const CrcShuffle_MapType* map, uint8_t value) {
+    return map->Low[value & 0x0F] ^ map->High[value >> 4];
+}
+
+static uint8_t crcScalar(uint8_t remainder,
+                         const uint8_t* data,
+                         size_t length,
+                         const CrcShuffle_ConstantsType* constants) {
+    for (size_t byte = 0; byte < length; ++byte)
+    {
+        remainder = applyMap(&constants->Fold1, remainder ^ data[byte]);
+    }
+
+    return remainder;
+}
+
+#if defined(__x86_64__)
+
+#include <immintrin.h>
+
+#define CRC_SSSE3_INLINE __attribute__((target("ssse3"), always_inline)) inline
+#define CRC_AVX2_INLINE __attribute__((target("avx2"), always_inline)) inline
+
+/*
+ * &shiftMasks[n] is a PSHUFB mask that moves the first n bytes of a lane to
+ * the end of the lane and clears the other bytes.
+ */
+static const int8_t shiftMasks[32] = {
+    -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
+};
+
+CRC_SSSE3_INLINE
+static __m128i applyMap128(__m128i lanes, const CrcShuffle_MapType* map) {
+    const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+    const __m128i low = _mm_and_si128(lanes, nibbleMask);
+    const __m128i high = _mm_and_si128(_mm_srli_epi16(lanes, 4), nibbleMask);
+
+    return _mm_xor_si128(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)map->Low), low),
+                         _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)map->High), high));
+}
+
+CRC_AVX2_INLINE
+static __m256i applyMap256(__m256i lanes, const CrcShuffle_MapType* map) {
+    const __m256i nibbleMask = _mm256_set1_epi8(0x0F);
+    const __m256i low = _mm256_and_si256(lanes, nibbleMask);
+    const __m256i high = _mm256_and_si256(_mm256_srli_epi16(lanes, 4), nibbleMask);
+    const __m256i lowMap = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)map->Low));
+    const __m256i highMap = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)map->High));
+
+    return _mm256_xor_si256(_mm256_shuffle_epi8(lowMap, low), _mm256_shuffle_epi8(highMap, high));
+}
+
+/*
+ * Loads the first headLength (1 to 16) bytes of the message, with the
+ * remainder added, at the end of a lane. The message must be at least 16
+ * bytes long.
+ */
+CRC_SSSE3_INLINE
+static __m128i loadHead(uint8_t remainder, const uint8_t* data, size_t headLength) {
+    const __m128i mask = _mm_loadu_si128((const __m128i*)&shiftMasks[headLength]);
+    const __m128i block = _mm_xor_si128(_mm_loadu_si128((const __m128i*)data), _mm_cvtsi32_si128(remainder));
+
+    return _mm_shuffle_epi8(block, mask);
+}
+
+/*
+ * Combines the 16 lane remainders into the CRC remainder, lane i still has
+ * to be moved over (16 - i) bytes.
+ */
+CRC_SSSE3_INLINE
+static uint8_t reduce128(__m128i lanes, const CrcShuffle_ConstantsType* constants) {
+    lanes = _mm_xor_si128(applyMap128(lanes, &constants->Fold8), _mm_srli_si128(lanes, 8));
+    lanes = _mm_xor_si128(applyMap128(lanes, &constants->Fold4), _mm_srli_si128(lanes, 4));
+    lanes = _mm_xor_si128(applyMap128(lanes, &constants->Fold2), _mm_srli_si128(lanes, 2));
+    lanes = _mm_xor_si128(applyMap128(lanes, &constants->Fold1), _mm_srli_si128(lanes, 1));
+
+    return (uint8_t)_mm_cvtsi128_si32(applyMap128(lanes, &constants->Fold1));
+}
+
+__attribute__((target("ssse3")))
+static uint8_t crcSsse3(uint8_t remainder,
+                        const uint8_t* data,
+                        size_t length,
+                        const CrcShuffle_ConstantsType* constants) {
+    const size_t headLength = ((length - 1) % 16) + 1;
+    __m128i lanes = loadHead(remainder, data, headLength);
+    data += headLength;
+    length -= headLength;
+
+    while (length >= 16) {
+        lanes = _mm_xor_si128(applyMap128(lanes, &constants->Fold16), _mm_loadu_si128((const __m128i*)data));
+        data += 16;
+        length -= 16;
+    }
+
+    return reduce128(lanes, constants);
+}
+
+__attribute__((target("avx2")))
+static uint8_t crcAvx2(uint8_t remainder,
+                       const uint8_t* data,
+                       size_t length,
+                       const CrcShuffle_ConstantsType* constants) {
+    const size_t headLength = ((length - 1) % 16) + 1;
+    __m128i head = loadHead(remainder, data, headLength);
+    data += headLength;
+    length -= headLength;
+
+    if ((length % 32) != 0) {
+        head = _mm_xor_si128(applyMap128(head, &constants->Fold16), _mm_loadu_si128((const __m128i*)data));
+        data += 16;
+        length -= 16;
+    }
+
+    /*
+     * The head is the second half of a block that starts with 16 zero bytes.
+     */
+    __m256i lanes = _mm256_inserti128_si256(_mm256_setzero_si256(), head, 1);
+    while (length >= 32) {
+        lanes = _mm256_xor_si256(applyMap256(lanes, &constants->Fold32), _mm256_loadu_si256((const __m256i*)data));
+        data += 32;
+        length -= 32;
+    }
+
+    /*
+     * The low 16 lanes are 16 bytes further from the end than the high 16 lanes.
+     */
+    const __m128i lanes128 = _mm_xor_si128(applyMap128(_mm256_castsi256_si128(lanes), &constants->Fold16),
+                                           _mm256_extracti128_si256(lanes, 1));
+
+    return reduce128(lanes128, constants);
+}
+
+#endif
+
+uint8_t CrcShuffle_Crc8(uint8_t Remainder,
+                        const uint8_t* DataPtr,
+                        size_t Length,
+                        const CrcShuffle_ConstantsType* Constants) {
+#if defined(__x86_64__)
+    if ((Length >= 64) && __builtin_cpu_supports("avx2")) {
+        return crcAvx2(Remainder, DataPtr, Length, Constants);
+    }
+
+    if ((Length >= 16) && __builtin_cpu_supports("ssse3")) {
+        return crcSsse3(Remainder, DataPtr, Length, Constants);
+    }
+#endif
+
+    return crcScalar(Remainder, DataPtr, Length, Constants);
+}
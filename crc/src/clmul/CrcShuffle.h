@@ -0,0 +1,70 @@
+#ifndef CRC_SHUFFLE_H__
+#define CRC_SHUFFLE_H__
+
+/**
+ * @file CrcShuffle.h
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief Table-free 8-bit CRC kernel for the accelerated CRC library
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2021
+ *
+ * For an 8-bit CRC, moving a byte v over k message bytes is a linear map
+ * M^k(v) = v * x^(8k) mod P. Each linear map on bytes is fully described by its
+ * result for the 16 low nibbles and the 16 high nibbles, which fit in two SSE
+ * registers and can be applied to 16 (SSSE3) or 32 (AVX2) bytes at once with PSHUFB.
+ *
+ * The kernel keeps one partial remainder per byte lane. For every new block the lanes
+ * are moved a block further with M^16 (or M^32) and the block is added, and after the
+ * last block the lanes are combined pairwise with M^8, M^4, M^2 and M^1. The kernel
+ * therefore never reads a 256-entry lookup table, only the 32-byte nibble maps.
+ * Messages shorter than 16 bytes, and all messages on CPUs without SSSE3, use the
+ * M^1 nibble maps one byte at a time, which is a single cache line instead of four.
+ *
+ */
+
+#include "Std_Types.h"
+
+/**
+ * The linear map M^k of an 8-bit CRC as two nibble tables
+ */
+typedef struct {
+    /**
+     * M^k(n) for n = 0..15
+     */
+    uint8_t Low[16];
+
+    /**
+     * M^k(n << 4) for n = 0..15
+     */
+    uint8_t High[16];
+} CrcShuffle_MapType;
+
+/**
+ * The nibble maps of one 8-bit CRC polynomial
+ */
+typedef struct {
+    CrcShuffle_MapType Fold32;
+    CrcShuffle_MapType Fold16;
+    CrcShuffle_MapType Fold8;
+    CrcShuffle_MapType Fold4;
+    CrcShuffle_MapType Fold2;
+    CrcShuffle_MapType Fold1;
+} CrcShuffle_ConstantsType;
+
+/**
+ * Divides a message by a non-reflected 8-bit CRC polynomial.
+ *
+ * @param Remainder     The CRC remainder before the message
+ * @param DataPtr       Pointer to the message
+ * @param Length        Length of the message in bytes
+ * @param Constants     The nibble maps of the polynomial
+ * @return uint8_t      The CRC remainder after the message
+ */
+uint8_t CrcShuffle_Crc8(uint8_t Remainder,
+                        const uint8_t* DataPtr,
+                        size_t Length,
+                        const CrcShuffle_ConstantsType* Constants);
+
+#endif  // CRC_SHUFFLE_H__
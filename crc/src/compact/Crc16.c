@@ -0,0 +1,64 @@
+/**
+ * @file Crc16.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * The Crc_CalculateCRC16 function divides the message a nibble at a time
+ * with a 16-entry lookup table, which is a sixteenth of the crc_fast table
+ * for two lookups per byte instead of one.
+ *
+ * The high nibble of a byte is divided first.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "Crc.h"
+#include "CrcRegister.h"
+
+static const uint16_t crcTable[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+uint16_t Crc_UpdateCRC16Register(uint16_t Crc_Register,
+                                 const uint8_t* Crc_DataPtr,
+                                 size_t Crc_Length) {
+    uint16_t remainder = Crc_Register;
+
+    /*
+     * Divide the message by the polynomial, a nibble at a time.
+     */
+    for (size_t byte = 0; byte < Crc_Length; ++byte)
+    {
+        remainder = crcTable[((remainder >> 12) ^ (Crc_DataPtr[byte] >> 4)) & 0x0F] ^ (remainder << 4);
+        remainder = crcTable[((remainder >> 12) ^ Crc_DataPtr[byte]) & 0x0F] ^ (remainder << 4);
+    }
+
+    return remainder;
+}
+
+// cppcheck-suppress unusedFunction
+uint16_t Crc_CalculateCRC16Long(const uint8_t* Crc_DataPtr,
+                                size_t Crc_Length,
+                                uint16_t Crc_StartValue16,
+                                bool Crc_IsFirstCall) {
+    uint16_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = 0xFFFF;
+    } else {
+        // SWS_Crc_00041
+        remainder = (Crc_StartValue16 ^ 0x0000);
+    }
+
+    remainder = Crc_UpdateCRC16Register(remainder, Crc_DataPtr, Crc_Length);
+
+    /*
+     * The final remainder is the CRC result.
+     */
+    return remainder ^ 0x0000;
+}
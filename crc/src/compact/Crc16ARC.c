@@ -0,0 +1,66 @@
+/**
+ * @file Crc16ARC.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * The Crc_CalculateCRC16ARC function divides the message a nibble at a time
+ * with a 16-entry lookup table, which is a sixteenth of the crc_fast table
+ * for two lookups per byte instead of one.
+ *
+ * The table is in the reflected (LSB first) domain, so the input bytes and
+ * the remainder are processed as they are. The low nibble of a byte is
+ * divided first.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "Crc.h"
+#include "CrcRegister.h"
+
+static const uint16_t crcTable[16] = {
+    0x0000, 0xCC01, 0xD801, 0x1400, 0xF001, 0x3C00, 0x2800, 0xE401,
+    0xA001, 0x6C00, 0x7800, 0xB401, 0x5000, 0x9C01, 0x8801, 0x4400
+};
+
+uint16_t Crc_UpdateCRC16ARCRegister(uint16_t Crc_Register,
+                                    const uint8_t* Crc_DataPtr,
+                                    size_t Crc_Length) {
+    uint16_t remainder = Crc_Register;
+
+    /*
+     * Divide the message by the polynomial, a nibble at a time.
+     */
+    for (size_t byte = 0; byte < Crc_Length; ++byte)
+    {
+        remainder = crcTable[(remainder ^ Crc_DataPtr[byte]) & 0x0F] ^ (remainder >> 4);
+        remainder = crcTable[(remainder ^ (Crc_DataPtr[byte] >> 4)) & 0x0F] ^ (remainder >> 4);
+    }
+
+    return remainder;
+}
+
+// cppcheck-suppress unusedFunction
+uint16_t Crc_CalculateCRC16ARCLong(const uint8_t* Crc_DataPtr,
+                                   size_t Crc_Length,
+                                   uint16_t Crc_StartValue16,
+                                   bool Crc_IsFirstCall) {
+    uint16_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = 0x0000;
+    } else {
+        // SWS_Crc_00041
+        remainder = (Crc_StartValue16 ^ 0x0000);
+    }
+
+    remainder = Crc_UpdateCRC16ARCRegister(remainder, Crc_DataPtr, Crc_Length);
+
+    /*
+     * The final remainder is the CRC result.
+     */
+    return remainder ^ 0x0000;
+}
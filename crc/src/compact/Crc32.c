@@ -0,0 +1,68 @@
+/**
+ * @file Crc32.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * The Crc_CalculateCRC32 function divides the message a nibble at a time
+ * with a 16-entry lookup table, which is a sixteenth of the crc_fast table
+ * for two lookups per byte instead of one.
+ *
+ * The table is in the reflected (LSB first) domain, so the input bytes and
+ * the remainder are processed as they are. The low nibble of a byte is
+ * divided first.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "Crc.h"
+#include "CrcRegister.h"
+
+static const uint32_t crcTable[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+    0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+uint32_t Crc_UpdateCRC32Register(uint32_t Crc_Register,
+                                 const uint8_t* Crc_DataPtr,
+                                 size_t Crc_Length) {
+    uint32_t remainder = Crc_Register;
+
+    /*
+     * Divide the message by the polynomial, a nibble at a time.
+     */
+    for (size_t byte = 0; byte < Crc_Length; ++byte)
+    {
+        remainder = crcTable[(remainder ^ Crc_DataPtr[byte]) & 0x0F] ^ (remainder >> 4);
+        remainder = crcTable[(remainder ^ (Crc_DataPtr[byte] >> 4)) & 0x0F] ^ (remainder >> 4);
+    }
+
+    return remainder;
+}
+
+// cppcheck-suppress unusedFunction
+uint32_t Crc_CalculateCRC32Long(const uint8_t* Crc_DataPtr,
+                                size_t Crc_Length,
+                                uint32_t Crc_StartValue32,
+                                bool Crc_IsFirstCall) {
+    uint32_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = 0xFFFFFFFF;
+    } else {
+        // SWS_Crc_00041
+        remainder = (Crc_StartValue32 ^ 0xFFFFFFFF);
+    }
+
+    remainder = Crc_UpdateCRC32Register(remainder, Crc_DataPtr, Crc_Length);
+
+    /*
+     * The final remainder is the CRC result.
+     */
+    return remainder ^ 0xFFFFFFFF;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file Crc64.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * The Crc_CalculateCRC64 function divides the message a nibble at a time
+ * with a 16-entry lookup table, which is a sixteenth of the crc_fast table
+ * for two lookups per byte instead of one.
+ *
+ * The table is in the reflected (LSB first) domain, so the input bytes and
+ * the remainder are processed as they are. The low nibble of a byte is
+ * divided first.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "Crc.h"
+#include "CrcRegister.h"
+
+static const uint64_t crcTable[16] = {
+    0x0000000000000000, 0x7D9BA13851336649,
+    0xFB374270A266CC92, 0x86ACE348F355AADB,
+    0x64B62BCAEBC387A1, 0x192D8AF2BAF0E1E8,
+    0x9F8169BA49A54B33, 0xE21AC88218962D7A,
+    0xC96C5795D7870F42, 0xB4F7F6AD86B4690B,
+    0x325B15E575E1C3D0, 0x4FC0B4DD24D2A599,
+    0xADDA7C5F3C4488E3, 0xD041DD676D77EEAA,
+    0x56ED3E2F9E224471, 0x2B769F17CF112238
+};
+
+uint64_t Crc_UpdateCRC64Register(uint64_t Crc_Register,
+                                 const uint8_t* Crc_DataPtr,
+                                 size_t Crc_Length) {
+    uint64_t remainder = Crc_Register;
+
+    /*
+     * Divide the message by the polynomial, a nibble at a time.
+     */
+    for (size_t byte = 0; byte < Crc_Length; ++byte)
+    {
+        remainder = crcTable[(remainder ^ Crc_DataPtr[byte]) & 0x0F] ^ (remainder >> 4);
+        remainder = crcTable[(remainder ^ (Crc_DataPtr[byte] >> 4)) & 0x0F] ^ (remainder >> 4);
+    }
+
+    return remainder;
+}
+
+// cppcheck-suppress unusedFunction
+uint64_t Crc_CalculateCRC64Long(const uint8_t* Crc_DataPtr,
+                                size_t Crc_Length,
+                                uint64_t Crc_StartValue64,
+                                bool Crc_IsFirstCall) {
+    uint64_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = 0xFFFFFFFFFFFFFFFF;
+    } else {
+        // SWS_Crc_00041
+        remainder = (Crc_StartValue64 ^ 0xFFFFFFFFFFFFFFFF);
+    }
+
+    remainder = Crc_UpdateCRC64Register(remainder, Crc_DataPtr, Crc_Length);
+
+    /*
+     * The final remainder is the CRC result.
+     */
+    return remainder ^ 0xFFFFFFFFFFFFFFFF;
+}
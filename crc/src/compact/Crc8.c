@@ -0,0 +1,64 @@
+/**
+ * @file Crc8.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * The Crc_CalculateCRC8 function divides the message a nibble at a time
+ * with a 16-entry lookup table, which is a sixteenth of the crc_fast table
+ * for two lookups per byte instead of one.
+ *
+ * The high nibble of a byte is divided first.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "Crc.h"
+#include "CrcRegister.h"
+
+static const uint8_t crcTable[16] = {
+    0x00, 0x1D, 0x3A, 0x27, 0x74, 0x69, 0x4E, 0x53,
+    0xE8, 0xF5, 0xD2, 0xCF, 0x9C, 0x81, 0xA6, 0xBB
+};
+
+uint8_t Crc_UpdateCRC8Register(uint8_t Crc_Register,
+                               const uint8_t* Crc_DataPtr,
+                               size_t Crc_Length) {
+    uint8_t remainder = Crc_Register;
+
+    /*
+     * Divide the message by the polynomial, a nibble at a time.
+     */
+    for (size_t byte = 0; byte < Crc_Length; ++byte)
+    {
+        remainder = crcTable[(remainder ^ Crc_DataPtr[byte]) >> 4] ^ (uint8_t)(remainder << 4);
+        remainder = crcTable[((remainder >> 4) ^ Crc_DataPtr[byte]) & 0x0F] ^ (uint8_t)(remainder << 4);
+    }
+
+    return remainder;
+}
+
+// cppcheck-suppress unusedFunction
+uint8_t Crc_CalculateCRC8Long(const uint8_t* Crc_DataPtr,
+                              size_t Crc_Length,
+                              uint8_t Crc_StartValue8,
+                              bool Crc_IsFirstCall) {
+    uint8_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = 0xFF;
+    } else {
+        // SWS_Crc_00041
+        remainder = (Crc_StartValue8 ^ 0xFF);
+    }
+
+    remainder = Crc_UpdateCRC8Register(remainder, Crc_DataPtr, Crc_Length);
+
+    /*
+     * The final remainder is the CRC result.
+     */
+    return remainder ^ 0xFF;
+}
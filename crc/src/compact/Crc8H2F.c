@@ -0,0 +1,64 @@
+/**
+ * @file Crc8H2F.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * The Crc_CalculateCRC8H2F function divides the message a nibble at a time
+ * with a 16-entry lookup table, which is a sixteenth of the crc_fast table
+ * for two lookups per byte instead of one.
+ *
+ * The high nibble of a byte is divided first.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "Crc.h"
+#include "CrcRegister.h"
+
+static const uint8_t crcTable[16] = {
+    0x00, 0x2F, 0x5E, 0x71, 0xBC, 0x93, 0xE2, 0xCD,
+    0x57, 0x78, 0x09, 0x26, 0xEB, 0xC4, 0xB5, 0x9A
+};
+
+uint8_t Crc_UpdateCRC8H2FRegister(uint8_t Crc_Register,
+                                  const uint8_t* Crc_DataPtr,
+                                  size_t Crc_Length) {
+    uint8_t remainder = Crc_Register;
+
+    /*
+     * Divide the message by the polynomial, a nibble at a time.
+     */
+    for (size_t byte = 0; byte < Crc_Length; ++byte)
+    {
+        remainder = crcTable[(remainder ^ Crc_DataPtr[byte]) >> 4] ^ (uint8_t)(remainder << 4);
+        remainder = crcTable[((remainder >> 4) ^ Crc_DataPtr[byte]) & 0x0F] ^ (uint8_t)(remainder << 4);
+    }
+
+    return remainder;
+}
+
+// cppcheck-suppress unusedFunction
+uint8_t Crc_CalculateCRC8H2FLong(const uint8_t* Crc_DataPtr,
+                                 size_t Crc_Length,
+                                 uint8_t Crc_StartValue8H2F,
+                                 bool Crc_IsFirstCall) {
+    uint8_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = 0xFF;
+    } else {
+        // SWS_Crc_00041
+        remainder = (Crc_StartValue8H2F ^ 0xFF);
+    }
+
+    remainder = Crc_UpdateCRC8H2FRegister(remainder, Crc_DataPtr, Crc_Length);
+
+    /*
+     * The final remainder is the CRC result.
+     */
+    return remainder ^ 0xFF;
+}
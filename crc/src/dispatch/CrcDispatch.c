@@ -0,0 +1,272 @@
+/**
+ * @file CrcDispatch.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * Runtime selection of the CRC implementation, see Crc_Dispatch.h.
+ *
+ * Every tier is compiled from the sources of its own library with the
+ * Crc_CalculateCRCxxLong and Crc_UpdateCRCxxRegister functions renamed to
+ * <Prefix>_CalculateCRCxxLong and <Prefix>_UpdateCRCxxRegister, see
+ * crc/CMakeLists.txt. The pclmul and avx512 tiers share the crc_clmul
+ * sources and differ only in whether the AVX-512 kernel is enabled.
+ * The Crc_CalculateCRCxxLong and Crc_UpdateCRCxxRegister functions in this
+ * file call the selected tier through a table of function pointers, so
+ * selecting a tier is a single pointer assignment. All tiers keep the CRC
+ * register in the same form, so a tier may be selected between two
+ * register updates of one message.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "Crc.h"
+#include "Crc_Dispatch.h"
+#include "CrcRegister.h"
+#include "CrcClmul.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define CRC_DISPATCH_DECLARE_TIER(PREFIX) \
+    uint8_t PREFIX##_CalculateCRC8Long(const uint8_t*, size_t, uint8_t, bool); \
+    uint8_t PREFIX##_CalculateCRC8H2FLong(const uint8_t*, size_t, uint8_t, bool); \
+    uint16_t PREFIX##_CalculateCRC16Long(const uint8_t*, size_t, uint16_t, bool); \
+    uint16_t PREFIX##_CalculateCRC16ARCLong(const uint8_t*, size_t, uint16_t, bool); \
+    uint32_t PREFIX##_CalculateCRC32Long(const uint8_t*, size_t, uint32_t, bool); \
+    uint32_t PREFIX##_CalculateCRC32P4Long(const uint8_t*, size_t, uint32_t, bool); \
+    uint64_t PREFIX##_CalculateCRC64Long(const uint8_t*, size_t, uint64_t, bool); \
+    uint8_t PREFIX##_UpdateCRC8Register(uint8_t, const uint8_t*, size_t); \
+    uint8_t PREFIX##_UpdateCRC8H2FRegister(uint8_t, const uint8_t*, size_t); \
+    uint16_t PREFIX##_UpdateCRC16Register(uint16_t, const uint8_t*, size_t); \
+    uint16_t PREFIX##_UpdateCRC16ARCRegister(uint16_t, const uint8_t*, size_t); \
+    uint32_t PREFIX##_UpdateCRC32Register(uint32_t, const uint8_t*, size_t); \
+    uint32_t PREFIX##_UpdateCRC32P4Register(uint32_t, const uint8_t*, size_t); \
+    uint64_t PREFIX##_UpdateCRC64Register(uint64_t, const uint8_t*, size_t);
+
+#define CRC_DISPATCH_TIER_FUNCTIONS(PREFIX) { \
+    PREFIX##_CalculateCRC8Long, \
+    PREFIX##_CalculateCRC8H2FLong, \
+    PREFIX##_CalculateCRC16Long, \
+    PREFIX##_CalculateCRC16ARCLong, \
+    PREFIX##_CalculateCRC32Long, \
+    PREFIX##_CalculateCRC32P4Long, \
+    PREFIX##_CalculateCRC64Long, \
+    PREFIX##_UpdateCRC8Register, \
+    PREFIX##_UpdateCRC8H2FRegister, \
+    PREFIX##_UpdateCRC16Register, \
+    PREFIX##_UpdateCRC16ARCRegister, \
+    PREFIX##_UpdateCRC32Register, \
+    PREFIX##_UpdateCRC32P4Register, \
+    PREFIX##_UpdateCRC64Register \
+}
+
+CRC_DISPATCH_DECLARE_TIER(CrcBitwise)
+CRC_DISPATCH_DECLARE_TIER(CrcTable)
+CRC_DISPATCH_DECLARE_TIER(CrcSlice8)
+CRC_DISPATCH_DECLARE_TIER(CrcAccel)
+
+typedef struct {
+    uint8_t (*Crc8)(const uint8_t*, size_t, uint8_t, bool);
+    uint8_t (*Crc8H2F)(const uint8_t*, size_t, uint8_t, bool);
+    uint16_t (*Crc16)(const uint8_t*, size_t, uint16_t, bool);
+    uint16_t (*Crc16ARC)(const uint8_t*, size_t, uint16_t, bool);
+    uint32_t (*Crc32)(const uint8_t*, size_t, uint32_t, bool);
+    uint32_t (*Crc32P4)(const uint8_t*, size_t, uint32_t, bool);
+    uint64_t (*Crc64)(const uint8_t*, size_t, uint64_t, bool);
+    uint8_t (*Crc8Register)(uint8_t, const uint8_t*, size_t);
+    uint8_t (*Crc8H2FRegister)(uint8_t, const uint8_t*, size_t);
+    uint16_t (*Crc16Register)(uint16_t, const uint8_t*, size_t);
+    uint16_t (*Crc16ARCRegister)(uint16_t, const uint8_t*, size_t);
+    uint32_t (*Crc32Register)(uint32_t, const uint8_t*, size_t);
+    uint32_t (*Crc32P4Register)(uint32_t, const uint8_t*, size_t);
+    uint64_t (*Crc64Register)(uint64_t, const uint8_t*, size_t);
+} CrcDispatch_FunctionsType;
+
+typedef struct {
+    /**
+     * Name of the tier in the CRC_DISPATCH_TIER environment variable
+     */
+    const char* Name;
+
+    CrcDispatch_FunctionsType Functions;
+} CrcDispatch_TierType;
+
+static const CrcDispatch_TierType tiers[] = {
+    [CRC_DISPATCH_TIER_BITWISE] = {"bitwise", CRC_DISPATCH_TIER_FUNCTIONS(CrcBitwise)},
+    [CRC_DISPATCH_TIER_TABLE] = {"table", CRC_DISPATCH_TIER_FUNCTIONS(CrcTable)},
+    [CRC_DISPATCH_TIER_SLICE8] = {"slice8", CRC_DISPATCH_TIER_FUNCTIONS(CrcSlice8)},
+    [CRC_DISPATCH_TIER_PCLMUL] = {"pclmul", CRC_DISPATCH_TIER_FUNCTIONS(CrcAccel)},
+    [CRC_DISPATCH_TIER_AVX512] = {"avx512", CRC_DISPATCH_TIER_FUNCTIONS(CrcAccel)}
+};
+
+#define CRC_DISPATCH_TIER_COUNT (sizeof(tiers) / sizeof(tiers[0]))
+
+/*
+ * The table tier runs on every CPU, it is used until the tier is selected
+ * when the program is loaded.
+ */
+static Crc_DispatchTierType selectedTier = CRC_DISPATCH_TIER_TABLE;
+static const CrcDispatch_FunctionsType* selected = &tiers[CRC_DISPATCH_TIER_TABLE].Functions;
+
+bool Crc_DispatchIsTierAvailable(Crc_DispatchTierType Tier) {
+    switch (Tier) {
+        case CRC_DISPATCH_TIER_BITWISE:
+        case CRC_DISPATCH_TIER_TABLE:
+        case CRC_DISPATCH_TIER_SLICE8:
+            return true;
+        case CRC_DISPATCH_TIER_PCLMUL:
+            return CrcClmul_IsAvailable();
+        case CRC_DISPATCH_TIER_AVX512:
+            return CrcClmul_IsAvailable() && CrcClmul_IsWideAvailable();
+        default:
+            return false;
+    }
+}
+
+Std_ReturnType Crc_DispatchSelectTier(Crc_DispatchTierType Tier) {
+    if (!Crc_DispatchIsTierAvailable(Tier)) {
+        return E_NOT_OK;
+    }
+
+    CrcClmul_SetWideEnabled(Tier == CRC_DISPATCH_TIER_AVX512);
+    selectedTier = Tier;
+    selected = &tiers[Tier].Functions;
+
+    return E_OK;
+}
+
+Crc_DispatchTierType Crc_DispatchGetTier(void) {
+    return selectedTier;
+}
+
+/*
+ * Selects the tier forced by the CRC_DISPATCH_TIER environment variable,
+ * or the fastest tier the CPU supports, when the program is loaded.
+ */
+__attribute__((constructor))
+static void selectInitialTier(void) {
+#if defined(__x86_64__)
+    /*
+     * The CPU features used by __builtin_cpu_supports may not be
+     * initialized yet when constructors run.
+     */
+    __builtin_cpu_init();
+#endif
+
+    const char* forced = getenv("CRC_DISPATCH_TIER");
+    if (forced != NULL) {
+        for (size_t tier = 0; tier < CRC_DISPATCH_TIER_COUNT; ++tier) {
+            if ((strcmp(forced, tiers[tier].Name) == 0) &&
+                (Crc_DispatchSelectTier((Crc_DispatchTierType)tier) == E_OK)) {
+                return;
+            }
+        }
+    }
+
+    for (size_t tier = CRC_DISPATCH_TIER_COUNT; tier > 0; --tier) {
+        if (Crc_DispatchSelectTier((Crc_DispatchTierType)(tier - 1)) == E_OK) {
+            return;
+        }
+    }
+}
+
+// cppcheck-suppress unusedFunction
+uint8_t Crc_CalculateCRC8Long(const uint8_t* Crc_DataPtr,
+                              size_t Crc_Length,
+                              uint8_t Crc_StartValue8,
+                              bool Crc_IsFirstCall) {
+    return selected->Crc8(Crc_DataPtr, Crc_Length, Crc_StartValue8, Crc_IsFirstCall);
+}
+
+// cppcheck-suppress unusedFunction
+uint8_t Crc_CalculateCRC8H2FLong(const uint8_t* Crc_DataPtr,
+                                 size_t Crc_Length,
+                                 uint8_t Crc_StartValue8H2F,
+                                 bool Crc_IsFirstCall) {
+    return selected->Crc8H2F(Crc_DataPtr, Crc_Length, Crc_StartValue8H2F, Crc_IsFirstCall);
+}
+
+// cppcheck-suppress unusedFunction
+uint16_t Crc_CalculateCRC16Long(const uint8_t* Crc_DataPtr,
+                                size_t Crc_Length,
+                                uint16_t Crc_StartValue16,
+                                bool Crc_IsFirstCall) {
+    return selected->Crc16(Crc_DataPtr, Crc_Length, Crc_StartValue16, Crc_IsFirstCall);
+}
+
+// cppcheck-suppress unusedFunction
+uint16_t Crc_CalculateCRC16ARCLong(const uint8_t* Crc_DataPtr,
+                                   size_t Crc_Length,
+                                   uint16_t Crc_StartValue16,
+                                   bool Crc_IsFirstCall) {
+    return selected->Crc16ARC(Crc_DataPtr, Crc_Length, Crc_StartValue16, Crc_IsFirstCall);
+}
+
+// cppcheck-suppress unusedFunction
+uint32_t Crc_CalculateCRC32Long(const uint8_t* Crc_DataPtr,
+                                size_t Crc_Length,
+                                uint32_t Crc_StartValue32,
+                                bool Crc_IsFirstCall) {
+    return selected->Crc32(Crc_DataPtr, Crc_Length, Crc_StartValue32, Crc_IsFirstCall);
+}
+
+// cppcheck-suppress unusedFunction
+uint32_t Crc_CalculateCRC32P4Long(const uint8_t* Crc_DataPtr,
+                                  size_t Crc_Length,
+                                  uint32_t Crc_StartValue32,
+                                  bool Crc_IsFirstCall) {
+    return selected->Crc32P4(Crc_DataPtr, Crc_Length, Crc_StartValue32, Crc_IsFirstCall);
+}
+
+// cppcheck-suppress unusedFunction
+uint64_t Crc_CalculateCRC64Long(const uint8_t* Crc_DataPtr,
+                                size_t Crc_Length,
+                                uint64_t Crc_StartValue64,
+                                bool Crc_IsFirstCall) {
+    return selected->Crc64(Crc_DataPtr, Crc_Length, Crc_StartValue64, Crc_IsFirstCall);
+}
+
+uint8_t Crc_UpdateCRC8Register(uint8_t Crc_Register,
+                               const uint8_t* Crc_DataPtr,
+                               size_t Crc_Length) {
+    return selected->Crc8Register(Crc_Register, Crc_DataPtr, Crc_Length);
+}
+
+uint8_t Crc_UpdateCRC8H2FRegister(uint8_t Crc_Register,
+                                  const uint8_t* Crc_DataPtr,
+                                  size_t Crc_Length) {
+    return selected->Crc8H2FRegister(Crc_Register, Crc_DataPtr, Crc_Length);
+}
+
+uint16_t Crc_UpdateCRC16Register(uint16_t Crc_Register,
+                                 const uint8_t* Crc_DataPtr,
+                                 size_t Crc_Length) {
+    return selected->Crc16Register(Crc_Register, Crc_DataPtr, Crc_Length);
+}
+
+uint16_t Crc_UpdateCRC16ARCRegister(uint16_t Crc_Register,
+                                    const uint8_t* Crc_DataPtr,
+                                    size_t Crc_Length) {
+    return selected->Crc16ARCRegister(Crc_Register, Crc_DataPtr, Crc_Length);
+}
+
+uint32_t Crc_UpdateCRC32Register(uint32_t Crc_Register,
+                                 const uint8_t* Crc_DataPtr,
+                                 size_t Crc_Length) {
+    return selected->Crc32Register(Crc_Register, Crc_DataPtr, Crc_Length);
+}
+
+uint32_t Crc_UpdateCRC32P4Register(uint32_t Crc_Register,
+                                   const uint8_t* Crc_DataPtr,
+                                   size_t Crc_Length) {
+    return selected->Crc32P4Register(Crc_Register, Crc_DataPtr, Crc_Length);
+}
+
+uint64_t Crc_UpdateCRC64Register(uint64_t Crc_Register,
+                                 const uint8_t* Crc_DataPtr,
+                                 size_t Crc_Length) {
+    return selected->Crc64Register(Crc_Register, Crc_DataPtr, Crc_Length);
+}
@@ -0,0 +1,113 @@
+/**
+ * @file CrcEngine.cpp
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * The Crc_CalculateCRCxx functions of Crc.h and the register updates of
+ * CrcRegister.h instantiated from the compile-time engine in CrcEngine.hpp.
+ * The engine keeps the register in the bit order of the input data, which
+ * is the bit order of the result for all of these CRCs.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+extern "C" {
+    #include "Crc.h"
+    #include "CrcRegister.h"
+}
+
+#include "CrcEngine.hpp"
+
+extern "C" uint8_t Crc_CalculateCRC8Long(const uint8_t* Crc_DataPtr,
+                                         size_t Crc_Length,
+                                         uint8_t Crc_StartValue8,
+                                         bool Crc_IsFirstCall) {
+    return crc::Crc8Engine::calculate(Crc_DataPtr, Crc_Length, Crc_StartValue8, Crc_IsFirstCall);
+}
+
+extern "C" uint8_t Crc_CalculateCRC8H2FLong(const uint8_t* Crc_DataPtr,
+                                            size_t Crc_Length,
+                                            uint8_t Crc_StartValue8H2F,
+                                            bool Crc_IsFirstCall) {
+    return crc::Crc8H2FEngine::calculate(Crc_DataPtr, Crc_Length, Crc_StartValue8H2F, Crc_IsFirstCall);
+}
+
+extern "C" uint16_t Crc_CalculateCRC16Long(const uint8_t* Crc_DataPtr,
+                                           size_t Crc_Length,
+                                           uint16_t Crc_StartValue16,
+                                           bool Crc_IsFirstCall) {
+    return crc::Crc16Engine::calculate(Crc_DataPtr, Crc_Length, Crc_StartValue16, Crc_IsFirstCall);
+}
+
+extern "C" uint16_t Crc_CalculateCRC16ARCLong(const uint8_t* Crc_DataPtr,
+                                              size_t Crc_Length,
+                                              uint16_t Crc_StartValue16,
+                                              bool Crc_IsFirstCall) {
+    return crc::Crc16ARCEngine::calculate(Crc_DataPtr, Crc_Length, Crc_StartValue16, Crc_IsFirstCall);
+}
+
+extern "C" uint32_t Crc_CalculateCRC32Long(const uint8_t* Crc_DataPtr,
+                                           size_t Crc_Length,
+                                           uint32_t Crc_StartValue32,
+                                           bool Crc_IsFirstCall) {
+    return crc::Crc32Engine::calculate(Crc_DataPtr, Crc_Length, Crc_StartValue32, Crc_IsFirstCall);
+}
+
+extern "C" uint32_t Crc_CalculateCRC32P4Long(const uint8_t* Crc_DataPtr,
+                                             size_t Crc_Length,
+                                             uint32_t Crc_StartValue32,
+                                             bool Crc_IsFirstCall) {
+    return crc::Crc32P4Engine::calculate(Crc_DataPtr, Crc_Length, Crc_StartValue32, Crc_IsFirstCall);
+}
+
+extern "C" uint64_t Crc_CalculateCRC64Long(const uint8_t* Crc_DataPtr,
+                                           size_t Crc_Length,
+                                           uint64_t Crc_StartValue64,
+                                           bool Crc_IsFirstCall) {
+    return crc::Crc64Engine::calculate(Crc_DataPtr, Crc_Length, Crc_StartValue64, Crc_IsFirstCall);
+}
+
+extern "C" uint8_t Crc_UpdateCRC8Register(uint8_t Crc_Register,
+                                          const uint8_t* Crc_DataPtr,
+                                          size_t Crc_Length) {
+    return crc::Crc8Engine::update(Crc_Register, Crc_DataPtr, Crc_Length);
+}
+
+extern "C" uint8_t Crc_UpdateCRC8H2FRegister(uint8_t Crc_Register,
+                                             const uint8_t* Crc_DataPtr,
+                                             size_t Crc_Length) {
+    return crc::Crc8H2FEngine::update(Crc_Register, Crc_DataPtr, Crc_Length);
+}
+
+extern "C" uint16_t Crc_UpdateCRC16Register(uint16_t Crc_Register,
+                                            const uint8_t* Crc_DataPtr,
+                                            size_t Crc_Length) {
+    return crc::Crc16Engine::update(Crc_Register, Crc_DataPtr, Crc_Length);
+}
+
+extern "C" uint16_t Crc_UpdateCRC16ARCRegister(uint16_t Crc_Register,
+                                               const uint8_t* Crc_DataPtr,
+                                               size_t Crc_Length) {
+    return crc::Crc16ARCEngine::update(Crc_Register, Crc_DataPtr, Crc_Length);
+}
+
+extern "C" uint32_t Crc_UpdateCRC32Register(uint32_t Crc_Register,
+                                            const uint8_t* Crc_DataPtr,
+                                            size_t Crc_Length) {
+    return crc::Crc32Engine::update(Crc_Register, Crc_DataPtr, Crc_Length);
+}
+
+extern "C" uint32_t Crc_UpdateCRC32P4Register(uint32_t Crc_Register,
+                                              const uint8_t* Crc_DataPtr,
+                                              size_t Crc_Length) {
+    return crc::Crc32P4Engine::update(Crc_Register, Crc_DataPtr, Crc_Length);
+}
+
+extern "C" uint64_t Crc_UpdateCRC64Register(uint64_t Crc_Register,
+                                            const uint8_t* Crc_DataPtr,
+                                            size_t Crc_Length) {
+    return crc::Crc64Engine::update(Crc_Register, Crc_DataPtr, Crc_Length);
+}
@@ -0,0 +1,47 @@
+/**
+ * @file Crc16ARC.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * Crc_CalculateCRC16ARC over a descriptor of the generic engine, see
+ * Crc_Generic.h. The descriptor is initialized by the first call.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "Crc.h"
+#include "Crc_Generic.h"
+#include "CrcRegister.h"
+
+#include <pthread.h>
+
+static const Crc_ParametersType parameters = {16, 0x8005, 0x0000, true, true, 0x0000};
+
+static Crc_DescriptorType descriptor;
+static pthread_once_t descriptorOnce = PTHREAD_ONCE_INIT;
+
+static void initDescriptor(void) {
+    (void)Crc_InitDescriptor(&descriptor, &parameters);
+}
+
+static const Crc_DescriptorType* getDescriptor(void) {
+    (void)pthread_once(&descriptorOnce, initDescriptor);
+    return &descriptor;
+}
+
+uint16_t Crc_UpdateCRC16ARCRegister(uint16_t Crc_Register,
+                                    const uint8_t* Crc_DataPtr,
+                                    size_t Crc_Length) {
+    return (uint16_t)Crc_UpdateGeneric(getDescriptor(), Crc_Register, Crc_DataPtr, Crc_Length);
+}
+
+// cppcheck-suppress unusedFunction
+uint16_t Crc_CalculateCRC16ARCLong(const uint8_t* Crc_DataPtr,
+                                   size_t Crc_Length,
+                                   uint16_t Crc_StartValue16,
+                                   bool Crc_IsFirstCall) {
+    return (uint16_t)Crc_CalculateGeneric(getDescriptor(), Crc_DataPtr, Crc_Length, Crc_StartValue16, Crc_IsFirstCall);
+}
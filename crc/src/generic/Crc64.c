@@ -0,0 +1,49 @@
+/**
+ * @file Crc64.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * Crc_CalculateCRC64 over a descriptor of the generic engine, see
+ * Crc_Generic.h. The descriptor is initialized by the first call.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "Crc.h"
+#include "Crc_Generic.h"
+#include "CrcRegister.h"
+
+#include <pthread.h>
+
+static const Crc_ParametersType parameters = {
+    64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, true, true, 0xFFFFFFFFFFFFFFFF
+};
+
+static Crc_DescriptorType descriptor;
+static pthread_once_t descriptorOnce = PTHREAD_ONCE_INIT;
+
+static void initDescriptor(void) {
+    (void)Crc_InitDescriptor(&descriptor, &parameters);
+}
+
+static const Crc_DescriptorType* getDescriptor(void) {
+    (void)pthread_once(&descriptorOnce, initDescriptor);
+    return &descriptor;
+}
+
+uint64_t Crc_UpdateCRC64Register(uint64_t Crc_Register,
+                                 const uint8_t* Crc_DataPtr,
+                                 size_t Crc_Length) {
+    return Crc_UpdateGeneric(getDescriptor(), Crc_Register, Crc_DataPtr, Crc_Length);
+}
+
+// cppcheck-suppress unusedFunction
+uint64_t Crc_CalculateCRC64Long(const uint8_t* Crc_DataPtr,
+                                size_t Crc_Length,
+                                uint64_t Crc_StartValue64,
+                                bool Crc_IsFirstCall) {
+    return Crc_CalculateGeneric(getDescriptor(), Crc_DataPtr, Crc_Length, Crc_StartValue64, Crc_IsFirstCall);
+}
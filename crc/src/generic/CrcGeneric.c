@@ -0,0 +1,353 @@
+/**
+ * @file CrcGeneric.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * Runtime parameterized CRC calculation, see Crc_Generic.h.
+ *
+ * The remainder is kept in the bit order of the input data. Reflected
+ * CRCs keep it in the low Width bits, as crc_slice8 does for the
+ * reflected algorithms. Normal CRCs keep it in the high Width bits of a
+ * 64-bit word, so that one set of slicing-by-8 tables works for every
+ * width and the next message byte is always added to the top 8 bits.
+ *
+ * Messages of at least CRC_CLMUL_MIN_LENGTH bytes are folded with the
+ * carry-less multiplication kernels of crc_clmul on CPUs that support
+ * them. The folding constants are computed from the polynomial as
+ * described in CrcClmul.h.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "Crc_Generic.h"
+#include "CrcClmul.h"
+
+#include <string.h>
+
+static uint64_t widthMask(uint8_t width) {
+    return (width < 64) ? ((1ULL << width) - 1) : ~0ULL;
+}
+
+static uint64_t reflect(uint64_t data, uint8_t width) {
+    uint64_t reflection = 0;
+
+    for (uint8_t bit = 0; bit < width; ++bit) {
+        reflection = (reflection << 1) | (data & 1);
+        data >>= 1;
+    }
+
+    return reflection;
+}
+
+static uint64_t load64LittleEndian(const uint8_t* data) {
+    uint64_t value;
+    memcpy(&value, data, sizeof(value));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    value = __builtin_bswap64(value);
+#endif
+    return value;
+}
+
+static uint64_t load64BigEndian(const uint8_t* data) {
+    uint64_t value;
+    memcpy(&value, data, sizeof(value));
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    value = __builtin_bswap64(value);
+#endif
+    return value;
+}
+
+static void buildTables(Crc_DescriptorType* descriptor) {
+    const Crc_ParametersType* parameters = &descriptor->Parameters;
+
+    if (parameters->ReflectIn) {
+        const uint64_t polynomial = reflect(parameters->Polynomial, parameters->Width);
+
+        for (uint32_t byte = 0; byte < 256; ++byte) {
+            uint64_t remainder = byte;
+            for (uint8_t bit = 0; bit < 8; ++bit) {
+                remainder = (remainder & 1) ? ((remainder >> 1) ^ polynomial) : (remainder >> 1);
+            }
+            descriptor->Table[0][byte] = remainder;
+        }
+
+        for (uint8_t slice = 1; slice < 8; ++slice) {
+            for (uint32_t byte = 0; byte < 256; ++byte) {
+                const uint64_t previous = descriptor->Table[slice - 1][byte];
+                descriptor->Table[slice][byte] = (previous >> 8) ^ descriptor->Table[0][previous & 0xFF];
+            }
+        }
+    } else {
+        const uint64_t polynomial = parameters->Polynomial << (64 - parameters->Width);
+
+        for (uint32_t byte = 0; byte < 256; ++byte) {
+            uint64_t remainder = (uint64_t)byte << 56;
+            for (uint8_t bit = 0; bit < 8; ++bit) {
+                remainder = (remainder >> 63) ? ((remainder << 1) ^ polynomial) : (remainder << 1);
+            }
+            descriptor->Table[0][byte] = remainder;
+        }
+
+        for (uint8_t slice = 1; slice < 8; ++slice) {
+            for (uint32_t byte = 0; byte < 256; ++byte) {
+                const uint64_t previous = descriptor->Table[slice - 1][byte];
+                descriptor->Table[slice][byte] = (previous << 8) ^ descriptor->Table[0][previous >> 56];
+            }
+        }
+    }
+}
+
+/*
+ * Computes x^exponent mod P, bit i of the result is the coefficient of x^i.
+ */
+static uint64_t powerModulo(uint32_t exponent, const Crc_ParametersType* parameters) {
+    const uint64_t topbit = 1ULL << (parameters->Width - 1);
+    const uint64_t mask = widthMask(parameters->Width);
+    uint64_t remainder = 1;
+
+    for (uint32_t power = 0; power < exponent; ++power) {
+        if (remainder & topbit) {
+            remainder = ((remainder << 1) ^ parameters->Polynomial) & mask;
+        } else {
+            remainder = (remainder << 1) & mask;
+        }
+    }
+
+    return remainder;
+}
+
+/*
+ * Computes floor(x^(64+Width) / P) without its x^64 term.
+ *
+ * x^Width = 1 * P + Polynomial, and each further power of x shifts the
+ * quotient up and adds 1 whenever the remainder reaches degree Width.
+ */
+static uint64_t barrettQuotient(const Crc_ParametersType* parameters) {
+    const uint64_t topbit = 1ULL << (parameters->Width - 1);
+    const uint64_t mask = widthMask(parameters->Width);
+    uint64_t remainder = parameters->Polynomial;
+    uint64_t quotient = 1;
+
+    for (uint8_t power = 0; power < 64; ++power) {
+        if (remainder & topbit) {
+            quotient = (quotient << 1) | 1;
+            remainder = ((remainder << 1) ^ parameters->Polynomial) & mask;
+        } else {
+            quotient <<= 1;
+            remainder = (remainder << 1) & mask;
+        }
+    }
+
+    return quotient;
+}
+
+static void buildFoldConstants(Crc_DescriptorType* descriptor) {
+    const Crc_ParametersType* parameters = &descriptor->Parameters;
+    Crc_FoldConstantsType* constants = &descriptor->FoldConstants;
+    const uint8_t width = parameters->Width;
+    const uint64_t quotient = barrettQuotient(parameters);
+
+    /*
+     * The kernels need at least 8 bits, and the normal kernel aligns the
+     * remainder with a shift that does not work for 64 bits.
+     */
+    descriptor->UseFold = (width >= 8) && (parameters->ReflectIn || (width < 64));
+    constants->Width = width;
+
+    if (parameters->ReflectIn) {
+        constants->Fold2048[0] = reflect(powerModulo(2048 + 64 - 1, parameters), 64);
+        constants->Fold2048[1] = reflect(powerModulo(2048 - 1, parameters), 64);
+        constants->Fold512[0] = reflect(powerModulo(512 + 64 - 1, parameters), 64);
+        constants->Fold512[1] = reflect(powerModulo(512 - 1, parameters), 64);
+        constants->Fold128[0] = reflect(powerModulo(128 + 64 - 1, parameters), 64);
+        constants->Fold128[1] = reflect(powerModulo(128 - 1, parameters), 64);
+        constants->Reduce = reflect(powerModulo(64U + width - 1U, parameters), 64);
+        constants->Mu = reflect((quotient >> 1) | (1ULL << 63), 64);
+        constants->Polynomial = reflect(parameters->Polynomial, 64);
+    } else {
+        constants->Fold2048[0] = 0;
+        constants->Fold2048[1] = 0;
+        constants->Fold512[0] = powerModulo(512, parameters);
+        constants->Fold512[1] = powerModulo(512 + 64, parameters);
+        constants->Fold128[0] = powerModulo(128, parameters);
+        constants->Fold128[1] = powerModulo(128 + 64, parameters);
+        constants->Reduce = powerModulo(64U + width, parameters);
+        constants->Mu = quotient;
+        constants->Polynomial = parameters->Polynomial;
+    }
+}
+
+static uint64_t calculateReflected(const Crc_DescriptorType* descriptor,
+                                   uint64_t remainder,
+                                   const uint8_t* data,
+                                   size_t length) {
+    if (descriptor->UseFold && (length >= CRC_CLMUL_MIN_LENGTH) && CrcClmul_IsAvailable()) {
+        /*
+         * Fold all complete 16 byte blocks, the rest is left for the tables.
+         */
+        const size_t blockLength = length & ~(size_t)15;
+        remainder = CrcClmul_FoldReflected(remainder, data, blockLength, &descriptor->FoldConstants);
+
+        data += blockLength;
+        length -= blockLength;
+    }
+
+    /*
+     * Divide the message by the polynomial, eight bytes at a time.
+     */
+    while (length >= 8) {
+        const uint64_t word = load64LittleEndian(data) ^ remainder;
+
+        remainder = descriptor->Table[7][word & 0xFF] ^
+                    descriptor->Table[6][(word >> 8) & 0xFF] ^
+                    descriptor->Table[5][(word >> 16) & 0xFF] ^
+                    descriptor->Table[4][(word >> 24) & 0xFF] ^
+                    descriptor->Table[3][(word >> 32) & 0xFF] ^
+                    descriptor->Table[2][(word >> 40) & 0xFF] ^
+                    descriptor->Table[1][(word >> 48) & 0xFF] ^
+                    descriptor->Table[0][word >> 56];
+
+        data += 8;
+        length -= 8;
+    }
+
+    /*
+     * Divide the remaining bytes one at a time.
+     */
+    while (length > 0) {
+        remainder = descriptor->Table[0][(remainder ^ *data) & 0xFF] ^ (remainder >> 8);
+
+        ++data;
+        --length;
+    }
+
+    return remainder;
+}
+
+static uint64_t calculateNormal(const Crc_DescriptorType* descriptor,
+                                uint64_t remainder,
+                                const uint8_t* data,
+                                size_t length) {
+    const uint8_t alignment = 64 - descriptor->Parameters.Width;
+
+    if (descriptor->UseFold && (length >= CRC_CLMUL_MIN_LENGTH) && CrcClmul_IsAvailable()) {
+        /*
+         * Fold all complete 16 byte blocks, the rest is left for the tables.
+         * The kernel expects the remainder in the low Width bits.
+         */
+        const size_t blockLength = length & ~(size_t)15;
+        remainder = CrcClmul_FoldNormal(remainder >> alignment, data, blockLength, &descriptor->FoldConstants);
+        remainder <<= alignment;
+
+        data += blockLength;
+        length -= blockLength;
+    }
+
+    /*
+     * Divide the message by the polynomial, eight bytes at a time.
+     */
+    while (length >= 8) {
+        const uint64_t word = load64BigEndian(data) ^ remainder;
+
+        remainder = descriptor->Table[7][word >> 56] ^
+                    descriptor->Table[6][(word >> 48) & 0xFF] ^
+                    descriptor->Table[5][(word >> 40) & 0xFF] ^
+                    descriptor->Table[4][(word >> 32) & 0xFF] ^
+                    descriptor->Table[3][(word >> 24) & 0xFF] ^
+                    descriptor->Table[2][(word >> 16) & 0xFF] ^
+                    descriptor->Table[1][(word >> 8) & 0xFF] ^
+                    descriptor->Table[0][word & 0xFF];
+
+        data += 8;
+        length -= 8;
+    }
+
+    /*
+     * Divide the remaining bytes one at a time.
+     */
+    while (length > 0) {
+        remainder = descriptor->Table[0][(remainder >> 56) ^ *data] ^ (remainder << 8);
+
+        ++data;
+        --length;
+    }
+
+    return remainder;
+}
+
+Std_ReturnType Crc_InitDescriptor(Crc_DescriptorType* Crc_Descriptor, const Crc_ParametersType* Crc_Parameters) {
+    Std_ReturnType result = E_NOT_OK;
+
+    if ((Crc_Descriptor != NULL) && (Crc_Parameters != NULL) &&
+        (Crc_Parameters->Width >= 1) && (Crc_Parameters->Width <= 64)) {
+        const uint64_t mask = widthMask(Crc_Parameters->Width);
+
+        if (((Crc_Parameters->Polynomial & ~mask) == 0) &&
+            ((Crc_Parameters->Initial & ~mask) == 0) &&
+            ((Crc_Parameters->XorValue & ~mask) == 0)) {
+            Crc_Descriptor->Parameters = *Crc_Parameters;
+            buildTables(Crc_Descriptor);
+            buildFoldConstants(Crc_Descriptor);
+            result = E_OK;
+        }
+    }
+
+    return result;
+}
+
+uint64_t Crc_CalculateGeneric(const Crc_DescriptorType* Crc_Descriptor,
+                              const uint8_t* Crc_DataPtr,
+                              size_t Crc_Length,
+                              uint64_t Crc_StartValue,
+                              bool Crc_IsFirstCall) {
+    const Crc_ParametersType* parameters = &Crc_Descriptor->Parameters;
+    uint64_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = parameters->ReflectOut ? reflect(parameters->Initial, parameters->Width) : parameters->Initial;
+    } else {
+        // SWS_Crc_00041
+        remainder = (Crc_StartValue ^ parameters->XorValue) & widthMask(parameters->Width);
+    }
+
+    remainder = Crc_UpdateGeneric(Crc_Descriptor, remainder, Crc_DataPtr, Crc_Length);
+
+    /*
+     * The final remainder is the CRC result.
+     */
+    return remainder ^ parameters->XorValue;
+}
+
+uint64_t Crc_UpdateGeneric(const Crc_DescriptorType* Crc_Descriptor,
+                           uint64_t Crc_Register,
+                           const uint8_t* Crc_DataPtr,
+                           size_t Crc_Length) {
+    const Crc_ParametersType* parameters = &Crc_Descriptor->Parameters;
+    const uint8_t width = parameters->Width;
+    uint64_t remainder = Crc_Register;
+
+    /*
+     * The register is in the bit order of the result, the remainder in the
+     * bit order of the input data.
+     */
+    if (parameters->ReflectIn != parameters->ReflectOut) {
+        remainder = reflect(remainder, width);
+    }
+
+    if (parameters->ReflectIn) {
+        remainder = calculateReflected(Crc_Descriptor, remainder, Crc_DataPtr, Crc_Length);
+    } else {
+        remainder = calculateNormal(Crc_Descriptor, remainder << (64 - width), Crc_DataPtr, Crc_Length);
+        remainder >>= (64 - width);
+    }
+
+    if (parameters->ReflectIn != parameters->ReflectOut) {
+        remainder = reflect(remainder, width);
+    }
+
+    return remainder;
+}
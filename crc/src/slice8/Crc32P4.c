@@ -0,0 +1,373 @@
+/**
+ * @file Crc32P4.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * The Crc_CalculateCRC32P4 function uses the slicing-by-8 technique from
+ * Kounavis and Berry, "A Systematic Approach to Building High Performance,
+ * Software-based, CRC Generators" (ISCC 2005).
+ *
+ * The tables are in the reflected (LSB first) domain, so neither the input
+ * bytes nor the remainder have to be reflected. crcTable[0] is the regular
+ * byte-at-a-time table and crcTable[k] is crcTable[0] followed by k zero
+ * bytes, which lets eight table lookups consume one 64-bit load.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "Crc.h"
+#include "CrcRegister.h"
+
+#include <string.h>
+
+static const uint32_t crcTable[8][256] = {
+    {
+        0x00000000, 0x30850ff5, 0x610a1fea, 0x518f101f, 0xc2143fd4, 0xf2913021, 0xa31e203e, 0x939b2fcb,
+        0x159615f7, 0x25131a02, 0x749c0a1d, 0x441905e8, 0xd7822a23, 0xe70725d6, 0xb68835c9, 0x860d3a3c,
+        0x2b2c2bee, 0x1ba9241b, 0x4a263404, 0x7aa33bf1, 0xe938143a, 0xd9bd1bcf, 0x88320bd0, 0xb8b70425,
+        0x3eba3e19, 0x0e3f31ec, 0x5fb021f3, 0x6f352e06, 0xfcae01cd, 0xcc2b0e38, 0x9da41e27, 0xad2111d2,
+        0x565857dc, 0x66dd5829, 0x37524836, 0x07d747c3, 0x944c6808, 0xa4c967fd, 0xf54677e2, 0xc5c37817,
+        0x43ce422b, 0x734b4dde, 0x22c45dc1, 0x12415234, 0x81da7dff, 0xb15f720a, 0xe0d06215, 0xd0556de0,
+        0x7d747c32, 0x4df173c7, 0x1c7e63d8, 0x2cfb6c2d, 0xbf6043e6, 0x8fe54c13, 0xde6a5c0c, 0xeeef53f9,
+        0x68e269c5, 0x58676630, 0x09e8762f, 0x396d79da, 0xaaf65611, 0x9a7359e4, 0xcbfc49fb, 0xfb79460e,
+        0xacb0afb8, 0x9c35a04d, 0xcdbab052, 0xfd3fbfa7, 0x6ea4906c, 0x5e219f99, 0x0fae8f86, 0x3f2b8073,
+        0xb926ba4f, 0x89a3b5ba, 0xd82ca5a5, 0xe8a9aa50, 0x7b32859b, 0x4bb78a6e, 0x1a389a71, 0x2abd9584,
+        0x879c8456, 0xb7198ba3, 0xe6969bbc, 0xd6139449, 0x4588bb82, 0x750db477, 0x2482a468, 0x1407ab9d,
+        0x920a91a1, 0xa28f9e54, 0xf3008e4b, 0xc38581be, 0x501eae75, 0x609ba180, 0x3114b19f, 0x0191be6a,
+        0xfae8f864, 0xca6df791, 0x9be2e78e, 0xab67e87b, 0x38fcc7b0, 0x0879c845, 0x59f6d85a, 0x6973d7af,
+        0xef7eed93, 0xdffbe266, 0x8e74f279, 0xbef1fd8c, 0x2d6ad247, 0x1defddb2, 0x4c60cdad, 0x7ce5c258,
+        0xd1c4d38a, 0xe141dc7f, 0xb0cecc60, 0x804bc395, 0x13d0ec5e, 0x2355e3ab, 0x72daf3b4, 0x425ffc41,
+        0xc452c67d, 0xf4d7c988, 0xa558d997, 0x95ddd662, 0x0646f9a9, 0x36c3f65c, 0x674ce643, 0x57c9e9b6,
+        0xc8df352f, 0xf85a3ada, 0xa9d52ac5, 0x99502530, 0x0acb0afb, 0x3a4e050e, 0x6bc11511, 0x5b441ae4,
+        0xdd4920d8, 0xedcc2f2d, 0xbc433f32, 0x8cc630c7, 0x1f5d1f0c, 0x2fd810f9, 0x7e5700e6, 0x4ed20f13,
+        0xe3f31ec1, 0xd3761134, 0x82f9012b, 0xb27c0ede, 0x21e72115, 0x11622ee0, 0x40ed3eff, 0x7068310a,
+        0xf6650b36, 0xc6e004c3, 0x976f14dc, 0xa7ea1b29, 0x347134e2, 0x04f43b17, 0x557b2b08, 0x65fe24fd,
+        0x9e8762f3, 0xae026d06, 0xff8d7d19, 0xcf0872ec, 0x5c935d27, 0x6c1652d2, 0x3d9942cd, 0x0d1c4d38,
+        0x8b117704, 0xbb9478f1, 0xea1b68ee, 0xda9e671b, 0x490548d0, 0x79804725, 0x280f573a, 0x188a58cf,
+        0xb5ab491d, 0x852e46e8, 0xd4a156f7, 0xe4245902, 0x77bf76c9, 0x473a793c, 0x16b56923, 0x263066d6,
+        0xa03d5cea, 0x90b8531f, 0xc1374300, 0xf1b24cf5, 0x6229633e, 0x52ac6ccb, 0x03237cd4, 0x33a67321,
+        0x646f9a97, 0x54ea9562, 0x0565857d, 0x35e08a88, 0xa67ba543, 0x96feaab6, 0xc771baa9, 0xf7f4b55c,
+        0x71f98f60, 0x417c8095, 0x10f3908a, 0x20769f7f, 0xb3edb0b4, 0x8368bf41, 0xd2e7af5e, 0xe262a0ab,
+        0x4f43b179, 0x7fc6be8c, 0x2e49ae93, 0x1ecca166, 0x8d578ead, 0xbdd28158, 0xec5d9147, 0xdcd89eb2,
+        0x5ad5a48e, 0x6a50ab7b, 0x3bdfbb64, 0x0b5ab491, 0x98c19b5a, 0xa84494af, 0xf9cb84b0, 0xc94e8b45,
+        0x3237cd4b, 0x02b2c2be, 0x533dd2a1, 0x63b8dd54, 0xf023f29f, 0xc0a6fd6a, 0x9129ed75, 0xa1ace280,
+        0x27a1d8bc, 0x1724d749, 0x46abc756, 0x762ec8a3, 0xe5b5e768, 0xd530e89d, 0x84bff882, 0xb43af777,
+        0x191be6a5, 0x299ee950, 0x7811f94f, 0x4894f6ba, 0xdb0fd971, 0xeb8ad684, 0xba05c69b, 0x8a80c96e,
+        0x0c8df352, 0x3c08fca7, 0x6d87ecb8, 0x5d02e34d, 0xce99cc86, 0xfe1cc373, 0xaf93d36c, 0x9f16dc99
+    },
+    {
+        0x00000000, 0xebba538b, 0x46cacd49, 0xad709ec2, 0x8d959a92, 0x662fc919, 0xcb5f57db, 0x20e50450,
+        0x8a955f7b, 0x612f0cf0, 0xcc5f9232, 0x27e5c1b9, 0x0700c5e9, 0xecba9662, 0x41ca08a0, 0xaa705b2b,
+        0x8494d4a9, 0x6f2e8722, 0xc25e19e0, 0x29e44a6b, 0x09014e3b, 0xe2bb1db0, 0x4fcb8372, 0xa471d0f9,
+        0x0e018bd2, 0xe5bbd859, 0x48cb469b, 0xa3711510, 0x83941140, 0x682e42cb, 0xc55edc09, 0x2ee48f82,
+        0x9897c30d, 0x732d9086, 0xde5d0e44, 0x35e75dcf, 0x1502599f, 0xfeb80a14, 0x53c894d6, 0xb872c75d,
+        0x12029c76, 0xf9b8cffd, 0x54c8513f, 0xbf7202b4, 0x9f9706e4, 0x742d556f, 0xd95dcbad, 0x32e79826,
+        0x1c0317a4, 0xf7b9442f, 0x5ac9daed, 0xb1738966, 0x91968d36, 0x7a2cdebd, 0xd75c407f, 0x3ce613f4,
+        0x969648df, 0x7d2c1b54, 0xd05c8596, 0x3be6d61d, 0x1b03d24d, 0xf0b981c6, 0x5dc91f04, 0xb6734c8f,
+        0xa091ec45, 0x4b2bbfce, 0xe65b210c, 0x0de17287, 0x2d0476d7, 0xc6be255c, 0x6bcebb9e, 0x8074e815,
+        0x2a04b33e, 0xc1bee0b5, 0x6cce7e77, 0x87742dfc, 0xa79129ac, 0x4c2b7a27, 0xe15be4e5, 0x0ae1b76e,
+        0x240538ec, 0xcfbf6b67, 0x62cff5a5, 0x8975a62e, 0xa990a27e, 0x422af1f5, 0xef5a6f37, 0x04e03cbc,
+        0xae906797, 0x452a341c, 0xe85aaade, 0x03e0f955, 0x2305fd05, 0xc8bfae8e, 0x65cf304c, 0x8e7563c7,
+        0x38062f48, 0xd3bc7cc3, 0x7ecce201, 0x9576b18a, 0xb593b5da, 0x5e29e651, 0xf3597893, 0x18e32b18,
+        0xb2937033, 0x592923b8, 0xf459bd7a, 0x1fe3eef1, 0x3f06eaa1, 0xd4bcb92a, 0x79cc27e8, 0x92767463,
+        0xbc92fbe1, 0x5728a86a, 0xfa5836a8, 0x11e26523, 0x31076173, 0xdabd32f8, 0x77cdac3a, 0x9c77ffb1,
+        0x3607a49a, 0xddbdf711, 0x70cd69d3, 0x9b773a58, 0xbb923e08, 0x50286d83, 0xfd58f341, 0x16e2a0ca,
+        0xd09db2d5, 0x3b27e15e, 0x96577f9c, 0x7ded2c17, 0x5d082847, 0xb6b27bcc, 0x1bc2e50e, 0xf078b685,
+        0x5a08edae, 0xb1b2be25, 0x1cc220e7, 0xf778736c, 0xd79d773c, 0x3c2724b7, 0x9157ba75, 0x7aede9fe,
+        0x5409667c, 0xbfb335f7, 0x12c3ab35, 0xf979f8be, 0xd99cfcee, 0x3226af65, 0x9f5631a7, 0x74ec622c,
+        0xde9c3907, 0x35266a8c, 0x9856f44e, 0x73eca7c5, 0x5309a395, 0xb8b3f01e, 0x15c36edc, 0xfe793d57,
+        0x480a71d8, 0xa3b02253, 0x0ec0bc91, 0xe57aef1a, 0xc59feb4a, 0x2e25b8c1, 0x83552603, 0x68ef7588,
+        0xc29f2ea3, 0x29257d28, 0x8455e3ea, 0x6fefb061, 0x4f0ab431, 0xa4b0e7ba, 0x09c07978, 0xe27a2af3,
+        0xcc9ea571, 0x2724f6fa, 0x8a546838, 0x61ee3bb3, 0x410b3fe3, 0xaab16c68, 0x07c1f2aa, 0xec7ba121,
+        0x460bfa0a, 0xadb1a981, 0x00c13743, 0xeb7b64c8, 0xcb9e6098, 0x20243313, 0x8d54add1, 0x66eefe5a,
+        0x700c5e90, 0x9bb60d1b, 0x36c693d9, 0xdd7cc052, 0xfd99c402, 0x16239789, 0xbb53094b, 0x50e95ac0,
+        0xfa9901eb, 0x11235260, 0xbc53cca2, 0x57e99f29, 0x770c9b79, 0x9cb6c8f2, 0x31c65630, 0xda7c05bb,
+        0xf4988a39, 0x1f22d9b2, 0xb2524770, 0x59e814fb, 0x790d10ab, 0x92b74320, 0x3fc7dde2, 0xd47d8e69,
+        0x7e0dd542, 0x95b786c9, 0x38c7180b, 0xd37d4b80, 0xf3984fd0, 0x18221c5b, 0xb5528299, 0x5ee8d112,
+        0xe89b9d9d, 0x0321ce16, 0xae5150d4, 0x45eb035f, 0x650e070f, 0x8eb45484, 0x23c4ca46, 0xc87e99cd,
+        0x620ec2e6, 0x89b4916d, 0x24c40faf, 0xcf7e5c24, 0xef9b5874, 0x04210bff, 0xa951953d, 0x42ebc6b6,
+        0x6c0f4934, 0x87b51abf, 0x2ac5847d, 0xc17fd7f6, 0xe19ad3a6, 0x0a20802d, 0xa7501eef, 0x4cea4d64,
+        0xe69a164f, 0x0d2045c4, 0xa050db06, 0x4bea888d, 0x6b0f8cdd, 0x80b5df56, 0x2dc54194, 0xc67f121f
+    },
+    {
+        0x00000000, 0x8c2d8a94, 0x89e57f77, 0x05c8f5e3, 0x827494b1, 0x0e591e25, 0x0b91ebc6, 0x87bc6152,
+        0x9557433d, 0x197ac9a9, 0x1cb23c4a, 0x909fb6de, 0x1723d78c, 0x9b0e5d18, 0x9ec6a8fb, 0x12eb226f,
+        0xbb10ec25, 0x373d66b1, 0x32f59352, 0xbed819c6, 0x39647894, 0xb549f200, 0xb08107e3, 0x3cac8d77,
+        0x2e47af18, 0xa26a258c, 0xa7a2d06f, 0x2b8f5afb, 0xac333ba9, 0x201eb13d, 0x25d644de, 0xa9fbce4a,
+        0xe79fb215, 0x6bb23881, 0x6e7acd62, 0xe25747f6, 0x65eb26a4, 0xe9c6ac30, 0xec0e59d3, 0x6023d347,
+        0x72c8f128, 0xfee57bbc, 0xfb2d8e5f, 0x770004cb, 0xf0bc6599, 0x7c91ef0d, 0x79591aee, 0xf574907a,
+        0x5c8f5e30, 0xd0a2d4a4, 0xd56a2147, 0x5947abd3, 0xdefbca81, 0x52d64015, 0x571eb5f6, 0xdb333f62,
+        0xc9d81d0d, 0x45f59799, 0x403d627a, 0xcc10e8ee, 0x4bac89bc, 0xc7810328, 0xc249f6cb, 0x4e647c5f,
+        0x5e810e75, 0xd2ac84e1, 0xd7647102, 0x5b49fb96, 0xdcf59ac4, 0x50d81050, 0x5510e5b3, 0xd93d6f27,
+        0xcbd64d48, 0x47fbc7dc, 0x4233323f, 0xce1eb8ab, 0x49a2d9f9, 0xc58f536d, 0xc047a68e, 0x4c6a2c1a,
+        0xe591e250, 0x69bc68c4, 0x6c749d27, 0xe05917b3, 0x67e576e1, 0xebc8fc75, 0xee000996, 0x622d8302,
+        0x70c6a16d, 0xfceb2bf9, 0xf923de1a, 0x750e548e, 0xf2b235dc, 0x7e9fbf48, 0x7b574aab, 0xf77ac03f,
+        0xb91ebc60, 0x353336f4, 0x30fbc317, 0xbcd64983, 0x3b6a28d1, 0xb747a245, 0xb28f57a6, 0x3ea2dd32,
+        0x2c49ff5d, 0xa06475c9, 0xa5ac802a, 0x29810abe, 0xae3d6bec, 0x2210e178, 0x27d8149b, 0xabf59e0f,
+        0x020e5045, 0x8e23dad1, 0x8beb2f32, 0x07c6a5a6, 0x807ac4f4, 0x0c574e60, 0x099fbb83, 0x85b23117,
+        0x97591378, 0x1b7499ec, 0x1ebc6c0f, 0x9291e69b, 0x152d87c9, 0x99000d5d, 0x9cc8f8be, 0x10e5722a,
+        0xbd021cea, 0x312f967e, 0x34e7639d, 0xb8cae909, 0x3f76885b, 0xb35b02cf, 0xb693f72c, 0x3abe7db8,
+        0x28555fd7, 0xa478d543, 0xa1b020a0, 0x2d9daa34, 0xaa21cb66, 0x260c41f2, 0x23c4b411, 0xafe93e85,
+        0x0612f0cf, 0x8a3f7a5b, 0x8ff78fb8, 0x03da052c, 0x8466647e, 0x084beeea, 0x0d831b09, 0x81ae919d,
+        0x9345b3f2, 0x1f683966, 0x1aa0cc85, 0x968d4611, 0x11312743, 0x9d1cadd7, 0x98d45834, 0x14f9d2a0,
+        0x5a9daeff, 0xd6b0246b, 0xd378d188, 0x5f555b1c, 0xd8e93a4e, 0x54c4b0da, 0x510c4539, 0xdd21cfad,
+        0xcfcaedc2, 0x43e76756, 0x462f92b5, 0xca021821, 0x4dbe7973, 0xc193f3e7, 0xc45b0604, 0x48768c90,
+        0xe18d42da, 0x6da0c84e, 0x68683dad, 0xe445b739, 0x63f9d66b, 0xefd45cff, 0xea1ca91c, 0x66312388,
+        0x74da01e7, 0xf8f78b73, 0xfd3f7e90, 0x7112f404, 0xf6ae9556, 0x7a831fc2, 0x7f4bea21, 0xf36660b5,
+        0xe383129f, 0x6fae980b, 0x6a666de8, 0xe64be77c, 0x61f7862e, 0xedda0cba, 0xe812f959, 0x643f73cd,
+        0x76d451a2, 0xfaf9db36, 0xff312ed5, 0x731ca441, 0xf4a0c513, 0x788d4f87, 0x7d45ba64, 0xf16830f0,
+        0x5893feba, 0xd4be742e, 0xd17681cd, 0x5d5b0b59, 0xdae76a0b, 0x56cae09f, 0x5302157c, 0xdf2f9fe8,
+        0xcdc4bd87, 0x41e93713, 0x4421c2f0, 0xc80c4864, 0x4fb02936, 0xc39da3a2, 0xc6555641, 0x4a78dcd5,
+        0x041ca08a, 0x88312a1e, 0x8df9dffd, 0x01d45569, 0x8668343b, 0x0a45beaf, 0x0f8d4b4c, 0x83a0c1d8,
+        0x914be3b7, 0x1d666923, 0x18ae9cc0, 0x94831654, 0x133f7706, 0x9f12fd92, 0x9ada0871, 0x16f782e5,
+        0xbf0c4caf, 0x3321c63b, 0x36e933d8, 0xbac4b94c, 0x3d78d81e, 0xb155528a, 0xb49da769, 0x38b02dfd,
+        0x2a5b0f92, 0xa6768506, 0xa3be70e5, 0x2f93fa71, 0xa82f9b23, 0x240211b7, 0x21cae454, 0xade76ec0
+    },
+    {
+        0x00000000, 0x216b0c9f, 0x42d6193e, 0x63bd15a1, 0x85ac327c, 0xa4c73ee3, 0xc77a2b42, 0xe61127dd,
+        0x9ae60ea7, 0xbb8d0238, 0xd8301799, 0xf95b1b06, 0x1f4a3cdb, 0x3e213044, 0x5d9c25e5, 0x7cf7297a,
+        0xa4727711, 0x85197b8e, 0xe6a46e2f, 0xc7cf62b0, 0x21de456d, 0x00b549f2, 0x63085c53, 0x426350cc,
+        0x3e9479b6, 0x1fff7529, 0x7c426088, 0x5d296c17, 0xbb384bca, 0x9a534755, 0xf9ee52f4, 0xd8855e6b,
+        0xd95a847d, 0xf83188e2, 0x9b8c9d43, 0xbae791dc, 0x5cf6b601, 0x7d9dba9e, 0x1e20af3f, 0x3f4ba3a0,
+        0x43bc8ada, 0x62d78645, 0x016a93e4, 0x20019f7b, 0xc610b8a6, 0xe77bb439, 0x84c6a198, 0xa5adad07,
+        0x7d28f36c, 0x5c43fff3, 0x3ffeea52, 0x1e95e6cd, 0xf884c110, 0xd9efcd8f, 0xba52d82e, 0x9b39d4b1,
+        0xe7cefdcb, 0xc6a5f154, 0xa518e4f5, 0x8473e86a, 0x6262cfb7, 0x4309c328, 0x20b4d689, 0x01dfda16,
+        0x230b62a5, 0x02606e3a, 0x61dd7b9b, 0x40b67704, 0xa6a750d9, 0x87cc5c46, 0xe47149e7, 0xc51a4578,
+        0xb9ed6c02, 0x9886609d, 0xfb3b753c, 0xda5079a3, 0x3c415e7e, 0x1d2a52e1, 0x7e974740, 0x5ffc4bdf,
+        0x877915b4, 0xa612192b, 0xc5af0c8a, 0xe4c40015, 0x02d527c8, 0x23be2b57, 0x40033ef6, 0x61683269,
+        0x1d9f1b13, 0x3cf4178c, 0x5f49022d, 0x7e220eb2, 0x9833296f, 0xb95825f0, 0xdae53051, 0xfb8e3cce,
+        0xfa51e6d8, 0xdb3aea47, 0xb887ffe6, 0x99ecf379, 0x7ffdd4a4, 0x5e96d83b, 0x3d2bcd9a, 0x1c40c105,
+        0x60b7e87f, 0x41dce4e0, 0x2261f141, 0x030afdde, 0xe51bda03, 0xc470d69c, 0xa7cdc33d, 0x86a6cfa2,
+        0x5e2391c9, 0x7f489d56, 0x1cf588f7, 0x3d9e8468, 0xdb8fa3b5, 0xfae4af2a, 0x9959ba8b, 0xb832b614,
+        0xc4c59f6e, 0xe5ae93f1, 0x86138650, 0xa7788acf, 0x4169ad12, 0x6002a18d, 0x03bfb42c, 0x22d4b8b3,
+        0x4616c54a, 0x677dc9d5, 0x04c0dc74, 0x25abd0eb, 0xc3baf736, 0xe2d1fba9, 0x816cee08, 0xa007e297,
+        0xdcf0cbed, 0xfd9bc772, 0x9e26d2d3, 0xbf4dde4c, 0x595cf991, 0x7837f50e, 0x1b8ae0af, 0x3ae1ec30,
+        0xe264b25b, 0xc30fbec4, 0xa0b2ab65, 0x81d9a7fa, 0x67c88027, 0x46a38cb8, 0x251e9919, 0x04759586,
+        0x7882bcfc, 0x59e9b063, 0x3a54a5c2, 0x1b3fa95d, 0xfd2e8e80, 0xdc45821f, 0xbff897be, 0x9e939b21,
+        0x9f4c4137, 0xbe274da8, 0xdd9a5809, 0xfcf15496, 0x1ae0734b, 0x3b8b7fd4, 0x58366a75, 0x795d66ea,
+        0x05aa4f90, 0x24c1430f, 0x477c56ae, 0x66175a31, 0x80067dec, 0xa16d7173, 0xc2d064d2, 0xe3bb684d,
+        0x3b3e3626, 0x1a553ab9, 0x79e82f18, 0x58832387, 0xbe92045a, 0x9ff908c5, 0xfc441d64, 0xdd2f11fb,
+        0xa1d83881, 0x80b3341e, 0xe30e21bf, 0xc2652d20, 0x24740afd, 0x051f0662, 0x66a213c3, 0x47c91f5c,
+        0x651da7ef, 0x4476ab70, 0x27cbbed1, 0x06a0b24e, 0xe0b19593, 0xc1da990c, 0xa2678cad, 0x830c8032,
+        0xfffba948, 0xde90a5d7, 0xbd2db076, 0x9c46bce9, 0x7a579b34, 0x5b3c97ab, 0x3881820a, 0x19ea8e95,
+        0xc16fd0fe, 0xe004dc61, 0x83b9c9c0, 0xa2d2c55f, 0x44c3e282, 0x65a8ee1d, 0x0615fbbc, 0x277ef723,
+        0x5b89de59, 0x7ae2d2c6, 0x195fc767, 0x3834cbf8, 0xde25ec25, 0xff4ee0ba, 0x9cf3f51b, 0xbd98f984,
+        0xbc472392, 0x9d2c2f0d, 0xfe913aac, 0xdffa3633, 0x39eb11ee, 0x18801d71, 0x7b3d08d0, 0x5a56044f,
+        0x26a12d35, 0x07ca21aa, 0x6477340b, 0x451c3894, 0xa30d1f49, 0x826613d6, 0xe1db0677, 0xc0b00ae8,
+        0x18355483, 0x395e581c, 0x5ae34dbd, 0x7b884122, 0x9d9966ff, 0xbcf26a60, 0xdf4f7fc1, 0xfe24735e,
+        0x82d35a24, 0xa3b856bb, 0xc005431a, 0xe16e4f85, 0x077f6858, 0x261464c7, 0x45a97166, 0x64c27df9
+    },
+    {
+        0x00000000, 0x65df4ff1, 0xcbbe9fe2, 0xae61d013, 0x06c3559b, 0x631c1a6a, 0xcd7dca79, 0xa8a28588,
+        0x0d86ab36, 0x6859e4c7, 0xc63834d4, 0xa3e77b25, 0x0b45fead, 0x6e9ab15c, 0xc0fb614f, 0xa5242ebe,
+        0x1b0d566c, 0x7ed2199d, 0xd0b3c98e, 0xb56c867f, 0x1dce03f7, 0x78114c06, 0xd6709c15, 0xb3afd3e4,
+        0x168bfd5a, 0x7354b2ab, 0xdd3562b8, 0xb8ea2d49, 0x1048a8c1, 0x7597e730, 0xdbf63723, 0xbe2978d2,
+        0x361aacd8, 0x53c5e329, 0xfda4333a, 0x987b7ccb, 0x30d9f943, 0x5506b6b2, 0xfb6766a1, 0x9eb82950,
+        0x3b9c07ee, 0x5e43481f, 0xf022980c, 0x95fdd7fd, 0x3d5f5275, 0x58801d84, 0xf6e1cd97, 0x933e8266,
+        0x2d17fab4, 0x48c8b545, 0xe6a96556, 0x83762aa7, 0x2bd4af2f, 0x4e0be0de, 0xe06a30cd, 0x85b57f3c,
+        0x20915182, 0x454e1e73, 0xeb2fce60, 0x8ef08191, 0x26520419, 0x438d4be8, 0xedec9bfb, 0x8833d40a,
+        0x6c3559b0, 0x09ea1641, 0xa78bc652, 0xc25489a3, 0x6af60c2b, 0x0f2943da, 0xa14893c9, 0xc497dc38,
+        0x61b3f286, 0x046cbd77, 0xaa0d6d64, 0xcfd22295, 0x6770a71d, 0x02afe8ec, 0xacce38ff, 0xc911770e,
+        0x77380fdc, 0x12e7402d, 0xbc86903e, 0xd959dfcf, 0x71fb5a47, 0x142415b6, 0xba45c5a5, 0xdf9a8a54,
+        0x7abea4ea, 0x1f61eb1b, 0xb1003b08, 0xd4df74f9, 0x7c7df171, 0x19a2be80, 0xb7c36e93, 0xd21c2162,
+        0x5a2ff568, 0x3ff0ba99, 0x91916a8a, 0xf44e257b, 0x5ceca0f3, 0x3933ef02, 0x97523f11, 0xf28d70e0,
+        0x57a95e5e, 0x327611af, 0x9c17c1bc, 0xf9c88e4d, 0x516a0bc5, 0x34b54434, 0x9ad49427, 0xff0bdbd6,
+        0x4122a304, 0x24fdecf5, 0x8a9c3ce6, 0xef437317, 0x47e1f69f, 0x223eb96e, 0x8c5f697d, 0xe980268c,
+        0x4ca40832, 0x297b47c3, 0x871a97d0, 0xe2c5d821, 0x4a675da9, 0x2fb81258, 0x81d9c24b, 0xe4068dba,
+        0xd86ab360, 0xbdb5fc91, 0x13d42c82, 0x760b6373, 0xdea9e6fb, 0xbb76a90a, 0x15177919, 0x70c836e8,
+        0xd5ec1856, 0xb03357a7, 0x1e5287b4, 0x7b8dc845, 0xd32f4dcd, 0xb6f0023c, 0x1891d22f, 0x7d4e9dde,
+        0xc367e50c, 0xa6b8aafd, 0x08d97aee, 0x6d06351f, 0xc5a4b097, 0xa07bff66, 0x0e1a2f75, 0x6bc56084,
+        0xcee14e3a, 0xab3e01cb, 0x055fd1d8, 0x60809e29, 0xc8221ba1, 0xadfd5450, 0x039c8443, 0x6643cbb2,
+        0xee701fb8, 0x8baf5049, 0x25ce805a, 0x4011cfab, 0xe8b34a23, 0x8d6c05d2, 0x230dd5c1, 0x46d29a30,
+        0xe3f6b48e, 0x8629fb7f, 0x28482b6c, 0x4d97649d, 0xe535e115, 0x80eaaee4, 0x2e8b7ef7, 0x4b543106,
+        0xf57d49d4, 0x90a20625, 0x3ec3d636, 0x5b1c99c7, 0xf3be1c4f, 0x966153be, 0x380083ad, 0x5ddfcc5c,
+        0xf8fbe2e2, 0x9d24ad13, 0x33457d00, 0x569a32f1, 0xfe38b779, 0x9be7f888, 0x3586289b, 0x5059676a,
+        0xb45fead0, 0xd180a521, 0x7fe17532, 0x1a3e3ac3, 0xb29cbf4b, 0xd743f0ba, 0x792220a9, 0x1cfd6f58,
+        0xb9d941e6, 0xdc060e17, 0x7267de04, 0x17b891f5, 0xbf1a147d, 0xdac55b8c, 0x74a48b9f, 0x117bc46e,
+        0xaf52bcbc, 0xca8df34d, 0x64ec235e, 0x01336caf, 0xa991e927, 0xcc4ea6d6, 0x622f76c5, 0x07f03934,
+        0xa2d4178a, 0xc70b587b, 0x696a8868, 0x0cb5c799, 0xa4174211, 0xc1c80de0, 0x6fa9ddf3, 0x0a769202,
+        0x82454608, 0xe79a09f9, 0x49fbd9ea, 0x2c24961b, 0x84861393, 0xe1595c62, 0x4f388c71, 0x2ae7c380,
+        0x8fc3ed3e, 0xea1ca2cf, 0x447d72dc, 0x21a23d2d, 0x8900b8a5, 0xecdff754, 0x42be2747, 0x276168b6,
+        0x99481064, 0xfc975f95, 0x52f68f86, 0x3729c077, 0x9f8b45ff, 0xfa540a0e, 0x5435da1d, 0x31ea95ec,
+        0x94cebb52, 0xf111f4a3, 0x5f7024b0, 0x3aaf6b41, 0x920deec9, 0xf7d2a138, 0x59b3712b, 0x3c6c3eda
+    },
+    {
+        0x00000000, 0x29fb361f, 0x53f66c3e, 0x7a0d5a21, 0xa7ecd87c, 0x8e17ee63, 0xf41ab442, 0xdde1825d,
+        0xde67daa7, 0xf79cecb8, 0x8d91b699, 0xa46a8086, 0x798b02db, 0x507034c4, 0x2a7d6ee5, 0x038658fa,
+        0x2d71df11, 0x048ae90e, 0x7e87b32f, 0x577c8530, 0x8a9d076d, 0xa3663172, 0xd96b6b53, 0xf0905d4c,
+        0xf31605b6, 0xdaed33a9, 0xa0e06988, 0x891b5f97, 0x54faddca, 0x7d01ebd5, 0x070cb1f4, 0x2ef787eb,
+        0x5ae3be22, 0x7318883d, 0x0915d21c, 0x20eee403, 0xfd0f665e, 0xd4f45041, 0xaef90a60, 0x87023c7f,
+        0x84846485, 0xad7f529a, 0xd77208bb, 0xfe893ea4, 0x2368bcf9, 0x0a938ae6, 0x709ed0c7, 0x5965e6d8,
+        0x77926133, 0x5e69572c, 0x24640d0d, 0x0d9f3b12, 0xd07eb94f, 0xf9858f50, 0x8388d571, 0xaa73e36e,
+        0xa9f5bb94, 0x800e8d8b, 0xfa03d7aa, 0xd3f8e1b5, 0x0e1963e8, 0x27e255f7, 0x5def0fd6, 0x741439c9,
+        0xb5c77c44, 0x9c3c4a5b, 0xe631107a, 0xcfca2665, 0x122ba438, 0x3bd09227, 0x41ddc806, 0x6826fe19,
+        0x6ba0a6e3, 0x425b90fc, 0x3856cadd, 0x11adfcc2, 0xcc4c7e9f, 0xe5b74880, 0x9fba12a1, 0xb64124be,
+        0x98b6a355, 0xb14d954a, 0xcb40cf6b, 0xe2bbf974, 0x3f5a7b29, 0x16a14d36, 0x6cac1717, 0x45572108,
+        0x46d179f2, 0x6f2a4fed, 0x152715cc, 0x3cdc23d3, 0xe13da18e, 0xc8c69791, 0xb2cbcdb0, 0x9b30fbaf,
+        0xef24c266, 0xc6dff479, 0xbcd2ae58, 0x95299847, 0x48c81a1a, 0x61332c05, 0x1b3e7624, 0x32c5403b,
+        0x314318c1, 0x18b82ede, 0x62b574ff, 0x4b4e42e0, 0x96afc0bd, 0xbf54f6a2, 0xc559ac83, 0xeca29a9c,
+        0xc2551d77, 0xebae2b68, 0x91a37149, 0xb8584756, 0x65b9c50b, 0x4c42f314, 0x364fa935, 0x1fb49f2a,
+        0x1c32c7d0, 0x35c9f1cf, 0x4fc4abee, 0x663f9df1, 0xbbde1fac, 0x922529b3, 0xe8287392, 0xc1d3458d,
+        0xfa3092d7, 0xd3cba4c8, 0xa9c6fee9, 0x803dc8f6, 0x5ddc4aab, 0x74277cb4, 0x0e2a2695, 0x27d1108a,
+        0x24574870, 0x0dac7e6f, 0x77a1244e, 0x5e5a1251, 0x83bb900c, 0xaa40a613, 0xd04dfc32, 0xf9b6ca2d,
+        0xd7414dc6, 0xfeba7bd9, 0x84b721f8, 0xad4c17e7, 0x70ad95ba, 0x5956a3a5, 0x235bf984, 0x0aa0cf9b,
+        0x09269761, 0x20dda17e, 0x5ad0fb5f, 0x732bcd40, 0xaeca4f1d, 0x87317902, 0xfd3c2323, 0xd4c7153c,
+        0xa0d32cf5, 0x89281aea, 0xf32540cb, 0xdade76d4, 0x073ff489, 0x2ec4c296, 0x54c998b7, 0x7d32aea8,
+        0x7eb4f652, 0x574fc04d, 0x2d429a6c, 0x04b9ac73, 0xd9582e2e, 0xf0a31831, 0x8aae4210, 0xa355740f,
+        0x8da2f3e4, 0xa459c5fb, 0xde549fda, 0xf7afa9c5, 0x2a4e2b98, 0x03b51d87, 0x79b847a6, 0x504371b9,
+        0x53c52943, 0x7a3e1f5c, 0x0033457d, 0x29c87362, 0xf429f13f, 0xddd2c720, 0xa7df9d01, 0x8e24ab1e,
+        0x4ff7ee93, 0x660cd88c, 0x1c0182ad, 0x35fab4b2, 0xe81b36ef, 0xc1e000f0, 0xbbed5ad1, 0x92166cce,
+        0x91903434, 0xb86b022b, 0xc266580a, 0xeb9d6e15, 0x367cec48, 0x1f87da57, 0x658a8076, 0x4c71b669,
+        0x62863182, 0x4b7d079d, 0x31705dbc, 0x188b6ba3, 0xc56ae9fe, 0xec91dfe1, 0x969c85c0, 0xbf67b3df,
+        0xbce1eb25, 0x951add3a, 0xef17871b, 0xc6ecb104, 0x1b0d3359, 0x32f60546, 0x48fb5f67, 0x61006978,
+        0x151450b1, 0x3cef66ae, 0x46e23c8f, 0x6f190a90, 0xb2f888cd, 0x9b03bed2, 0xe10ee4f3, 0xc8f5d2ec,
+        0xcb738a16, 0xe288bc09, 0x9885e628, 0xb17ed037, 0x6c9f526a, 0x45646475, 0x3f693e54, 0x1692084b,
+        0x38658fa0, 0x119eb9bf, 0x6b93e39e, 0x4268d581, 0x9f8957dc, 0xb67261c3, 0xcc7f3be2, 0xe5840dfd,
+        0xe6025507, 0xcff96318, 0xb5f43939, 0x9c0f0f26, 0x41ee8d7b, 0x6815bb64, 0x1218e145, 0x3be3d75a
+    },
+    {
+        0x00000000, 0xad08eae4, 0xcbafbf97, 0x66a75573, 0x06e11571, 0xabe9ff95, 0xcd4eaae6, 0x60464002,
+        0x0dc22ae2, 0xa0cac006, 0xc66d9575, 0x6b657f91, 0x0b233f93, 0xa62bd577, 0xc08c8004, 0x6d846ae0,
+        0x1b8455c4, 0xb68cbf20, 0xd02bea53, 0x7d2300b7, 0x1d6540b5, 0xb06daa51, 0xd6caff22, 0x7bc215c6,
+        0x16467f26, 0xbb4e95c2, 0xdde9c0b1, 0x70e12a55, 0x10a76a57, 0xbdaf80b3, 0xdb08d5c0, 0x76003f24,
+        0x3708ab88, 0x9a00416c, 0xfca7141f, 0x51affefb, 0x31e9bef9, 0x9ce1541d, 0xfa46016e, 0x574eeb8a,
+        0x3aca816a, 0x97c26b8e, 0xf1653efd, 0x5c6dd419, 0x3c2b941b, 0x91237eff, 0xf7842b8c, 0x5a8cc168,
+        0x2c8cfe4c, 0x818414a8, 0xe72341db, 0x4a2bab3f, 0x2a6deb3d, 0x876501d9, 0xe1c254aa, 0x4ccabe4e,
+        0x214ed4ae, 0x8c463e4a, 0xeae16b39, 0x47e981dd, 0x27afc1df, 0x8aa72b3b, 0xec007e48, 0x410894ac,
+        0x6e115710, 0xc319bdf4, 0xa5bee887, 0x08b60263, 0x68f04261, 0xc5f8a885, 0xa35ffdf6, 0x0e571712,
+        0x63d37df2, 0xcedb9716, 0xa87cc265, 0x05742881, 0x65326883, 0xc83a8267, 0xae9dd714, 0x03953df0,
+        0x759502d4, 0xd89de830, 0xbe3abd43, 0x133257a7, 0x737417a5, 0xde7cfd41, 0xb8dba832, 0x15d342d6,
+        0x78572836, 0xd55fc2d2, 0xb3f897a1, 0x1ef07d45, 0x7eb63d47, 0xd3bed7a3, 0xb51982d0, 0x18116834,
+        0x5919fc98, 0xf411167c, 0x92b6430f, 0x3fbea9eb, 0x5ff8e9e9, 0xf2f0030d, 0x9457567e, 0x395fbc9a,
+        0x54dbd67a, 0xf9d33c9e, 0x9f7469ed, 0x327c8309, 0x523ac30b, 0xff3229ef, 0x99957c9c, 0x349d9678,
+        0x429da95c, 0xef9543b8, 0x893216cb, 0x243afc2f, 0x447cbc2d, 0xe97456c9, 0x8fd303ba, 0x22dbe95e,
+        0x4f5f83be, 0xe257695a, 0x84f03c29, 0x29f8d6cd, 0x49be96cf, 0xe4b67c2b, 0x82112958, 0x2f19c3bc,
+        0xdc22ae20, 0x712a44c4, 0x178d11b7, 0xba85fb53, 0xdac3bb51, 0x77cb51b5, 0x116c04c6, 0xbc64ee22,
+        0xd1e084c2, 0x7ce86e26, 0x1a4f3b55, 0xb747d1b1, 0xd70191b3, 0x7a097b57, 0x1cae2e24, 0xb1a6c4c0,
+        0xc7a6fbe4, 0x6aae1100, 0x0c094473, 0xa101ae97, 0xc147ee95, 0x6c4f0471, 0x0ae85102, 0xa7e0bbe6,
+        0xca64d106, 0x676c3be2, 0x01cb6e91, 0xacc38475, 0xcc85c477, 0x618d2e93, 0x072a7be0, 0xaa229104,
+        0xeb2a05a8, 0x4622ef4c, 0x2085ba3f, 0x8d8d50db, 0xedcb10d9, 0x40c3fa3d, 0x2664af4e, 0x8b6c45aa,
+        0xe6e82f4a, 0x4be0c5ae, 0x2d4790dd, 0x804f7a39, 0xe0093a3b, 0x4d01d0df, 0x2ba685ac, 0x86ae6f48,
+        0xf0ae506c, 0x5da6ba88, 0x3b01effb, 0x9609051f, 0xf64f451d, 0x5b47aff9, 0x3de0fa8a, 0x90e8106e,
+        0xfd6c7a8e, 0x5064906a, 0x36c3c519, 0x9bcb2ffd, 0xfb8d6fff, 0x5685851b, 0x3022d068, 0x9d2a3a8c,
+        0xb233f930, 0x1f3b13d4, 0x799c46a7, 0xd494ac43, 0xb4d2ec41, 0x19da06a5, 0x7f7d53d6, 0xd275b932,
+        0xbff1d3d2, 0x12f93936, 0x745e6c45, 0xd95686a1, 0xb910c6a3, 0x14182c47, 0x72bf7934, 0xdfb793d0,
+        0xa9b7acf4, 0x04bf4610, 0x62181363, 0xcf10f987, 0xaf56b985, 0x025e5361, 0x64f90612, 0xc9f1ecf6,
+        0xa4758616, 0x097d6cf2, 0x6fda3981, 0xc2d2d365, 0xa2949367, 0x0f9c7983, 0x693b2cf0, 0xc433c614,
+        0x853b52b8, 0x2833b85c, 0x4e94ed2f, 0xe39c07cb, 0x83da47c9, 0x2ed2ad2d, 0x4875f85e, 0xe57d12ba,
+        0x88f9785a, 0x25f192be, 0x4356c7cd, 0xee5e2d29, 0x8e186d2b, 0x231087cf, 0x45b7d2bc, 0xe8bf3858,
+        0x9ebf077c, 0x33b7ed98, 0x5510b8eb, 0xf818520f, 0x985e120d, 0x3556f8e9, 0x53f1ad9a, 0xfef9477e,
+        0x937d2d9e, 0x3e75c77a, 0x58d29209, 0xf5da78ed, 0x959c38ef, 0x3894d20b, 0x5e338778, 0xf33b6d9c
+    },
+    {
+        0x00000000, 0xf08efa75, 0x70a39eb5, 0x802d64c0, 0xe1473d6a, 0x11c9c71f, 0x91e4a3df, 0x616a59aa,
+        0x5330108b, 0xa3beeafe, 0x23938e3e, 0xd31d744b, 0xb2772de1, 0x42f9d794, 0xc2d4b354, 0x325a4921,
+        0xa6602116, 0x56eedb63, 0xd6c3bfa3, 0x264d45d6, 0x47271c7c, 0xb7a9e609, 0x378482c9, 0xc70a78bc,
+        0xf550319d, 0x05decbe8, 0x85f3af28, 0x757d555d, 0x14170cf7, 0xe499f682, 0x64b49242, 0x943a6837,
+        0xdd7e2873, 0x2df0d206, 0xadddb6c6, 0x5d534cb3, 0x3c391519, 0xccb7ef6c, 0x4c9a8bac, 0xbc1471d9,
+        0x8e4e38f8, 0x7ec0c28d, 0xfeeda64d, 0x0e635c38, 0x6f090592, 0x9f87ffe7, 0x1faa9b27, 0xef246152,
+        0x7b1e0965, 0x8b90f310, 0x0bbd97d0, 0xfb336da5, 0x9a59340f, 0x6ad7ce7a, 0xeafaaaba, 0x1a7450cf,
+        0x282e19ee, 0xd8a0e39b, 0x588d875b, 0xa8037d2e, 0xc9692484, 0x39e7def1, 0xb9caba31, 0x49444044,
+        0x2b423ab9, 0xdbccc0cc, 0x5be1a40c, 0xab6f5e79, 0xca0507d3, 0x3a8bfda6, 0xbaa69966, 0x4a286313,
+        0x78722a32, 0x88fcd047, 0x08d1b487, 0xf85f4ef2, 0x99351758, 0x69bbed2d, 0xe99689ed, 0x19187398,
+        0x8d221baf, 0x7dace1da, 0xfd81851a, 0x0d0f7f6f, 0x6c6526c5, 0x9cebdcb0, 0x1cc6b870, 0xec484205,
+        0xde120b24, 0x2e9cf151, 0xaeb19591, 0x5e3f6fe4, 0x3f55364e, 0xcfdbcc3b, 0x4ff6a8fb, 0xbf78528e,
+        0xf63c12ca, 0x06b2e8bf, 0x869f8c7f, 0x7611760a, 0x177b2fa0, 0xe7f5d5d5, 0x67d8b115, 0x97564b60,
+        0xa50c0241, 0x5582f834, 0xd5af9cf4, 0x25216681, 0x444b3f2b, 0xb4c5c55e, 0x34e8a19e, 0xc4665beb,
+        0x505c33dc, 0xa0d2c9a9, 0x20ffad69, 0xd071571c, 0xb11b0eb6, 0x4195f4c3, 0xc1b89003, 0x31366a76,
+        0x036c2357, 0xf3e2d922, 0x73cfbde2, 0x83414797, 0xe22b1e3d, 0x12a5e448, 0x92888088, 0x62067afd,
+        0x56847572, 0xa60a8f07, 0x2627ebc7, 0xd6a911b2, 0xb7c34818, 0x474db26d, 0xc760d6ad, 0x37ee2cd8,
+        0x05b465f9, 0xf53a9f8c, 0x7517fb4c, 0x85990139, 0xe4f35893, 0x147da2e6, 0x9450c626, 0x64de3c53,
+        0xf0e45464, 0x006aae11, 0x8047cad1, 0x70c930a4, 0x11a3690e, 0xe12d937b, 0x6100f7bb, 0x918e0dce,
+        0xa3d444ef, 0x535abe9a, 0xd377da5a, 0x23f9202f, 0x42937985, 0xb21d83f0, 0x3230e730, 0xc2be1d45,
+        0x8bfa5d01, 0x7b74a774, 0xfb59c3b4, 0x0bd739c1, 0x6abd606b, 0x9a339a1e, 0x1a1efede, 0xea9004ab,
+        0xd8ca4d8a, 0x2844b7ff, 0xa869d33f, 0x58e7294a, 0x398d70e0, 0xc9038a95, 0x492eee55, 0xb9a01420,
+        0x2d9a7c17, 0xdd148662, 0x5d39e2a2, 0xadb718d7, 0xccdd417d, 0x3c53bb08, 0xbc7edfc8, 0x4cf025bd,
+        0x7eaa6c9c, 0x8e2496e9, 0x0e09f229, 0xfe87085c, 0x9fed51f6, 0x6f63ab83, 0xef4ecf43, 0x1fc03536,
+        0x7dc64fcb, 0x8d48b5be, 0x0d65d17e, 0xfdeb2b0b, 0x9c8172a1, 0x6c0f88d4, 0xec22ec14, 0x1cac1661,
+        0x2ef65f40, 0xde78a535, 0x5e55c1f5, 0xaedb3b80, 0xcfb1622a, 0x3f3f985f, 0xbf12fc9f, 0x4f9c06ea,
+        0xdba66edd, 0x2b2894a8, 0xab05f068, 0x5b8b0a1d, 0x3ae153b7, 0xca6fa9c2, 0x4a42cd02, 0xbacc3777,
+        0x88967e56, 0x78188423, 0xf835e0e3, 0x08bb1a96, 0x69d1433c, 0x995fb949, 0x1972dd89, 0xe9fc27fc,
+        0xa0b867b8, 0x50369dcd, 0xd01bf90d, 0x20950378, 0x41ff5ad2, 0xb171a0a7, 0x315cc467, 0xc1d23e12,
+        0xf3887733, 0x03068d46, 0x832be986, 0x73a513f3, 0x12cf4a59, 0xe241b02c, 0x626cd4ec, 0x92e22e99,
+        0x06d846ae, 0xf656bcdb, 0x767bd81b, 0x86f5226e, 0xe79f7bc4, 0x171181b1, 0x973ce571, 0x67b21f04,
+        0x55e85625, 0xa566ac50, 0x254bc890, 0xd5c532e5, 0xb4af6b4f, 0x4421913a, 0xc40cf5fa, 0x34820f8f
+    }
+};
+
+static uint64_t load64(const uint8_t* data) {
+    uint64_t value;
+    memcpy(&value, data, sizeof(value));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    value = __builtin_bswap64(value);
+#endif
+    return value;
+}
+
+uint32_t Crc_UpdateCRC32P4Register(uint32_t Crc_Register,
+                                   const uint8_t* Crc_DataPtr,
+                                   size_t Crc_Length) {
+    uint32_t remainder = Crc_Register;
+
+    const uint8_t* data = Crc_DataPtr;
+    size_t length = Crc_Length;
+
+    /*
+     * Divide the message by the polynomial, eight bytes at a time.
+     */
+    while (length >= 8)
+    {
+        const uint64_t word = load64(data) ^ remainder;
+
+        remainder = crcTable[7][word & 0xFF] ^
+                    crcTable[6][(word >> 8) & 0xFF] ^
+                    crcTable[5][(word >> 16) & 0xFF] ^
+                    crcTable[4][(word >> 24) & 0xFF] ^
+                    crcTable[3][(word >> 32) & 0xFF] ^
+                    crcTable[2][(word >> 40) & 0xFF] ^
+                    crcTable[1][(word >> 48) & 0xFF] ^
+                    crcTable[0][word >> 56];
+
+        data += 8;
+        length -= 8;
+    }
+
+    /*
+     * Divide the remaining bytes one at a time.
+     */
+    while (length > 0)
+    {
+        remainder = crcTable[0][(remainder ^ *data) & 0xFF] ^ (remainder >> 8);
+
+        ++data;
+        --length;
+    }
+
+    return remainder;
+}
+
+// cppcheck-suppress unusedFunction
+uint32_t Crc_CalculateCRC32P4Long(const uint8_t* Crc_DataPtr,
+                                  size_t Crc_Length,
+                                  uint32_t Crc_StartValue32,
+                                  bool Crc_IsFirstCall) {
+    uint32_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = 0xFFFFFFFF;
+    } else {
+        // SWS_Crc_00041
+        remainder = (Crc_StartValue32 ^ 0xFFFFFFFF);
+    }
+
+    remainder = Crc_UpdateCRC32P4Register(remainder, Crc_DataPtr, Crc_Length);
+
+    /*
+     * The final remainder is the CRC result.
+     */
+    return remainder ^ 0xFFFFFFFF;
+}
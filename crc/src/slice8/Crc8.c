@@ -0,0 +1,372 @@
+/**
+ * @file Crc8.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * The Crc_CalculateCRC8 function uses the slicing-by-8 technique from
+ * Kounavis and Berry, "A Systematic Approach to Building High Performance,
+ * Software-based, CRC Generators" (ISCC 2005).
+ *
+ * crcTable[0] is the regular byte-at-a-time table and crcTable[k] is
+ * crcTable[0] followed by k zero bytes, which lets eight table lookups
+ * consume one 64-bit load.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "Crc.h"
+#include "CrcRegister.h"
+
+#include <string.h>
+
+static const uint8_t crcTable[8][256] = {
+    {
+        0x00, 0x1d, 0x3a, 0x27, 0x74, 0x69, 0x4e, 0x53,
+        0xe8, 0xf5, 0xd2, 0xcf, 0x9c, 0x81, 0xa6, 0xbb,
+        0xcd, 0xd0, 0xf7, 0xea, 0xb9, 0xa4, 0x83, 0x9e,
+        0x25, 0x38, 0x1f, 0x02, 0x51, 0x4c, 0x6b, 0x76,
+        0x87, 0x9a, 0xbd, 0xa0, 0xf3, 0xee, 0xc9, 0xd4,
+        0x6f, 0x72, 0x55, 0x48, 0x1b, 0x06, 0x21, 0x3c,
+        0x4a, 0x57, 0x70, 0x6d, 0x3e, 0x23, 0x04, 0x19,
+        0xa2, 0xbf, 0x98, 0x85, 0xd6, 0xcb, 0xec, 0xf1,
+        0x13, 0x0e, 0x29, 0x34, 0x67, 0x7a, 0x5d, 0x40,
+        0xfb, 0xe6, 0xc1, 0xdc, 0x8f, 0x92, 0xb5, 0xa8,
+        0xde, 0xc3, 0xe4, 0xf9, 0xaa, 0xb7, 0x90, 0x8d,
+        0x36, 0x2b, 0x0c, 0x11, 0x42, 0x5f, 0x78, 0x65,
+        0x94, 0x89, 0xae, 0xb3, 0xe0, 0xfd, 0xda, 0xc7,
+        0x7c, 0x61, 0x46, 0x5b, 0x08, 0x15, 0x32, 0x2f,
+        0x59, 0x44, 0x63, 0x7e, 0x2d, 0x30, 0x17, 0x0a,
+        0xb1, 0xac, 0x8b, 0x96, 0xc5, 0xd8, 0xff, 0xe2,
+        0x26, 0x3b, 0x1c, 0x01, 0x52, 0x4f, 0x68, 0x75,
+        0xce, 0xd3, 0xf4, 0xe9, 0xba, 0xa7, 0x80, 0x9d,
+        0xeb, 0xf6, 0xd1, 0xcc, 0x9f, 0x82, 0xa5, 0xb8,
+        0x03, 0x1e, 0x39, 0x24, 0x77, 0x6a, 0x4d, 0x50,
+        0xa1, 0xbc, 0x9b, 0x86, 0xd5, 0xc8, 0xef, 0xf2,
+        0x49, 0x54, 0x73, 0x6e, 0x3d, 0x20, 0x07, 0x1a,
+        0x6c, 0x71, 0x56, 0x4b, 0x18, 0x05, 0x22, 0x3f,
+        0x84, 0x99, 0xbe, 0xa3, 0xf0, 0xed, 0xca, 0xd7,
+        0x35, 0x28, 0x0f, 0x12, 0x41, 0x5c, 0x7b, 0x66,
+        0xdd, 0xc0, 0xe7, 0xfa, 0xa9, 0xb4, 0x93, 0x8e,
+        0xf8, 0xe5, 0xc2, 0xdf, 0x8c, 0x91, 0xb6, 0xab,
+        0x10, 0x0d, 0x2a, 0x37, 0x64, 0x79, 0x5e, 0x43,
+        0xb2, 0xaf, 0x88, 0x95, 0xc6, 0xdb, 0xfc, 0xe1,
+        0x5a, 0x47, 0x60, 0x7d, 0x2e, 0x33, 0x14, 0x09,
+        0x7f, 0x62, 0x45, 0x58, 0x0b, 0x16, 0x31, 0x2c,
+        0x97, 0x8a, 0xad, 0xb0, 0xe3, 0xfe, 0xd9, 0xc4
+    },
+    {
+        0x00, 0x4c, 0x98, 0xd4, 0x2d, 0x61, 0xb5, 0xf9,
+        0x5a, 0x16, 0xc2, 0x8e, 0x77, 0x3b, 0xef, 0xa3,
+        0xb4, 0xf8, 0x2c, 0x60, 0x99, 0xd5, 0x01, 0x4d,
+        0xee, 0xa2, 0x76, 0x3a, 0xc3, 0x8f, 0x5b, 0x17,
+        0x75, 0x39, 0xed, 0xa1, 0x58, 0x14, 0xc0, 0x8c,
+        0x2f, 0x63, 0xb7, 0xfb, 0x02, 0x4e, 0x9a, 0xd6,
+        0xc1, 0x8d, 0x59, 0x15, 0xec, 0xa0, 0x74, 0x38,
+        0x9b, 0xd7, 0x03, 0x4f, 0xb6, 0xfa, 0x2e, 0x62,
+        0xea, 0xa6, 0x72, 0x3e, 0xc7, 0x8b, 0x5f, 0x13,
+        0xb0, 0xfc, 0x28, 0x64, 0x9d, 0xd1, 0x05, 0x49,
+        0x5e, 0x12, 0xc6, 0x8a, 0x73, 0x3f, 0xeb, 0xa7,
+        0x04, 0x48, 0x9c, 0xd0, 0x29, 0x65, 0xb1, 0xfd,
+        0x9f, 0xd3, 0x07, 0x4b, 0xb2, 0xfe, 0x2a, 0x66,
+        0xc5, 0x89, 0x5d, 0x11, 0xe8, 0xa4, 0x70, 0x3c,
+        0x2b, 0x67, 0xb3, 0xff, 0x06, 0x4a, 0x9e, 0xd2,
+        0x71, 0x3d, 0xe9, 0xa5, 0x5c, 0x10, 0xc4, 0x88,
+        0xc9, 0x85, 0x51, 0x1d, 0xe4, 0xa8, 0x7c, 0x30,
+        0x93, 0xdf, 0x0b, 0x47, 0xbe, 0xf2, 0x26, 0x6a,
+        0x7d, 0x31, 0xe5, 0xa9, 0x50, 0x1c, 0xc8, 0x84,
+        0x27, 0x6b, 0xbf, 0xf3, 0x0a, 0x46, 0x92, 0xde,
+        0xbc, 0xf0, 0x24, 0x68, 0x91, 0xdd, 0x09, 0x45,
+        0xe6, 0xaa, 0x7e, 0x32, 0xcb, 0x87, 0x53, 0x1f,
+        0x08, 0x44, 0x90, 0xdc, 0x25, 0x69, 0xbd, 0xf1,
+        0x52, 0x1e, 0xca, 0x86, 0x7f, 0x33, 0xe7, 0xab,
+        0x23, 0x6f, 0xbb, 0xf7, 0x0e, 0x42, 0x96, 0xda,
+        0x79, 0x35, 0xe1, 0xad, 0x54, 0x18, 0xcc, 0x80,
+        0x97, 0xdb, 0x0f, 0x43, 0xba, 0xf6, 0x22, 0x6e,
+        0xcd, 0x81, 0x55, 0x19, 0xe0, 0xac, 0x78, 0x34,
+        0x56, 0x1a, 0xce, 0x82, 0x7b, 0x37, 0xe3, 0xaf,
+        0x0c, 0x40, 0x94, 0xd8, 0x21, 0x6d, 0xb9, 0xf5,
+        0xe2, 0xae, 0x7a, 0x36, 0xcf, 0x83, 0x57, 0x1b,
+        0xb8, 0xf4, 0x20, 0x6c, 0x95, 0xd9, 0x0d, 0x41
+    },
+    {
+        0x00, 0x8f, 0x03, 0x8c, 0x06, 0x89, 0x05, 0x8a,
+        0x0c, 0x83, 0x0f, 0x80, 0x0a, 0x85, 0x09, 0x86,
+        0x18, 0x97, 0x1b, 0x94, 0x1e, 0x91, 0x1d, 0x92,
+        0x14, 0x9b, 0x17, 0x98, 0x12, 0x9d, 0x11, 0x9e,
+        0x30, 0xbf, 0x33, 0xbc, 0x36, 0xb9, 0x35, 0xba,
+        0x3c, 0xb3, 0x3f, 0xb0, 0x3a, 0xb5, 0x39, 0xb6,
+        0x28, 0xa7, 0x2b, 0xa4, 0x2e, 0xa1, 0x2d, 0xa2,
+        0x24, 0xab, 0x27, 0xa8, 0x22, 0xad, 0x21, 0xae,
+        0x60, 0xef, 0x63, 0xec, 0x66, 0xe9, 0x65, 0xea,
+        0x6c, 0xe3, 0x6f, 0xe0, 0x6a, 0xe5, 0x69, 0xe6,
+        0x78, 0xf7, 0x7b, 0xf4, 0x7e, 0xf1, 0x7d, 0xf2,
+        0x74, 0xfb, 0x77, 0xf8, 0x72, 0xfd, 0x71, 0xfe,
+        0x50, 0xdf, 0x53, 0xdc, 0x56, 0xd9, 0x55, 0xda,
+        0x5c, 0xd3, 0x5f, 0xd0, 0x5a, 0xd5, 0x59, 0xd6,
+        0x48, 0xc7, 0x4b, 0xc4, 0x4e, 0xc1, 0x4d, 0xc2,
+        0x44, 0xcb, 0x47, 0xc8, 0x42, 0xcd, 0x41, 0xce,
+        0xc0, 0x4f, 0xc3, 0x4c, 0xc6, 0x49, 0xc5, 0x4a,
+        0xcc, 0x43, 0xcf, 0x40, 0xca, 0x45, 0xc9, 0x46,
+        0xd8, 0x57, 0xdb, 0x54, 0xde, 0x51, 0xdd, 0x52,
+        0xd4, 0x5b, 0xd7, 0x58, 0xd2, 0x5d, 0xd1, 0x5e,
+        0xf0, 0x7f, 0xf3, 0x7c, 0xf6, 0x79, 0xf5, 0x7a,
+        0xfc, 0x73, 0xff, 0x70, 0xfa, 0x75, 0xf9, 0x76,
+        0xe8, 0x67, 0xeb, 0x64, 0xee, 0x61, 0xed, 0x62,
+        0xe4, 0x6b, 0xe7, 0x68, 0xe2, 0x6d, 0xe1, 0x6e,
+        0xa0, 0x2f, 0xa3, 0x2c, 0xa6, 0x29, 0xa5, 0x2a,
+        0xac, 0x23, 0xaf, 0x20, 0xaa, 0x25, 0xa9, 0x26,
+        0xb8, 0x37, 0xbb, 0x34, 0xbe, 0x31, 0xbd, 0x32,
+        0xb4, 0x3b, 0xb7, 0x38, 0xb2, 0x3d, 0xb1, 0x3e,
+        0x90, 0x1f, 0x93, 0x1c, 0x96, 0x19, 0x95, 0x1a,
+        0x9c, 0x13, 0x9f, 0x10, 0x9a, 0x15, 0x99, 0x16,
+        0x88, 0x07, 0x8b, 0x04, 0x8e, 0x01, 0x8d, 0x02,
+        0x84, 0x0b, 0x87, 0x08, 0x82, 0x0d, 0x81, 0x0e
+    },
+    {
+        0x00, 0x9d, 0x27, 0xba, 0x4e, 0xd3, 0x69, 0xf4,
+        0x9c, 0x01, 0xbb, 0x26, 0xd2, 0x4f, 0xf5, 0x68,
+        0x25, 0xb8, 0x02, 0x9f, 0x6b, 0xf6, 0x4c, 0xd1,
+        0xb9, 0x24, 0x9e, 0x03, 0xf7, 0x6a, 0xd0, 0x4d,
+        0x4a, 0xd7, 0x6d, 0xf0, 0x04, 0x99, 0x23, 0xbe,
+        0xd6, 0x4b, 0xf1, 0x6c, 0x98, 0x05, 0xbf, 0x22,
+        0x6f, 0xf2, 0x48, 0xd5, 0x21, 0xbc, 0x06, 0x9b,
+        0xf3, 0x6e, 0xd4, 0x49, 0xbd, 0x20, 0x9a, 0x07,
+        0x94, 0x09, 0xb3, 0x2e, 0xda, 0x47, 0xfd, 0x60,
+        0x08, 0x95, 0x2f, 0xb2, 0x46, 0xdb, 0x61, 0xfc,
+        0xb1, 0x2c, 0x96, 0x0b, 0xff, 0x62, 0xd8, 0x45,
+        0x2d, 0xb0, 0x0a, 0x97, 0x63, 0xfe, 0x44, 0xd9,
+        0xde, 0x43, 0xf9, 0x64, 0x90, 0x0d, 0xb7, 0x2a,
+        0x42, 0xdf, 0x65, 0xf8, 0x0c, 0x91, 0x2b, 0xb6,
+        0xfb, 0x66, 0xdc, 0x41, 0xb5, 0x28, 0x92, 0x0f,
+        0x67, 0xfa, 0x40, 0xdd, 0x29, 0xb4, 0x0e, 0x93,
+        0x35, 0xa8, 0x12, 0x8f, 0x7b, 0xe6, 0x5c, 0xc1,
+        0xa9, 0x34, 0x8e, 0x13, 0xe7, 0x7a, 0xc0, 0x5d,
+        0x10, 0x8d, 0x37, 0xaa, 0x5e, 0xc3, 0x79, 0xe4,
+        0x8c, 0x11, 0xab, 0x36, 0xc2, 0x5f, 0xe5, 0x78,
+        0x7f, 0xe2, 0x58, 0xc5, 0x31, 0xac, 0x16, 0x8b,
+        0xe3, 0x7e, 0xc4, 0x59, 0xad, 0x30, 0x8a, 0x17,
+        0x5a, 0xc7, 0x7d, 0xe0, 0x14, 0x89, 0x33, 0xae,
+        0xc6, 0x5b, 0xe1, 0x7c, 0x88, 0x15, 0xaf, 0x32,
+        0xa1, 0x3c, 0x86, 0x1b, 0xef, 0x72, 0xc8, 0x55,
+        0x3d, 0xa0, 0x1a, 0x87, 0x73, 0xee, 0x54, 0xc9,
+        0x84, 0x19, 0xa3, 0x3e, 0xca, 0x57, 0xed, 0x70,
+        0x18, 0x85, 0x3f, 0xa2, 0x56, 0xcb, 0x71, 0xec,
+        0xeb, 0x76, 0xcc, 0x51, 0xa5, 0x38, 0x82, 0x1f,
+        0x77, 0xea, 0x50, 0xcd, 0x39, 0xa4, 0x1e, 0x83,
+        0xce, 0x53, 0xe9, 0x74, 0x80, 0x1d, 0xa7, 0x3a,
+        0x52, 0xcf, 0x75, 0xe8, 0x1c, 0x81, 0x3b, 0xa6
+    },
+    {
+        0x00, 0x6a, 0xd4, 0xbe, 0xb5, 0xdf, 0x61, 0x0b,
+        0x77, 0x1d, 0xa3, 0xc9, 0xc2, 0xa8, 0x16, 0x7c,
+        0xee, 0x84, 0x3a, 0x50, 0x5b, 0x31, 0x8f, 0xe5,
+        0x99, 0xf3, 0x4d, 0x27, 0x2c, 0x46, 0xf8, 0x92,
+        0xc1, 0xab, 0x15, 0x7f, 0x74, 0x1e, 0xa0, 0xca,
+        0xb6, 0xdc, 0x62, 0x08, 0x03, 0x69, 0xd7, 0xbd,
+        0x2f, 0x45, 0xfb, 0x91, 0x9a, 0xf0, 0x4e, 0x24,
+        0x58, 0x32, 0x8c, 0xe6, 0xed, 0x87, 0x39, 0x53,
+        0x9f, 0xf5, 0x4b, 0x21, 0x2a, 0x40, 0xfe, 0x94,
+        0xe8, 0x82, 0x3c, 0x56, 0x5d, 0x37, 0x89, 0xe3,
+        0x71, 0x1b, 0xa5, 0xcf, 0xc4, 0xae, 0x10, 0x7a,
+        0x06, 0x6c, 0xd2, 0xb8, 0xb3, 0xd9, 0x67, 0x0d,
+        0x5e, 0x34, 0x8a, 0xe0, 0xeb, 0x81, 0x3f, 0x55,
+        0x29, 0x43, 0xfd, 0x97, 0x9c, 0xf6, 0x48, 0x22,
+        0xb0, 0xda, 0x64, 0x0e, 0x05, 0x6f, 0xd1, 0xbb,
+        0xc7, 0xad, 0x13, 0x79, 0x72, 0x18, 0xa6, 0xcc,
+        0x23, 0x49, 0xf7, 0x9d, 0x96, 0xfc, 0x42, 0x28,
+        0x54, 0x3e, 0x80, 0xea, 0xe1, 0x8b, 0x35, 0x5f,
+        0xcd, 0xa7, 0x19, 0x73, 0x78, 0x12, 0xac, 0xc6,
+        0xba, 0xd0, 0x6e, 0x04, 0x0f, 0x65, 0xdb, 0xb1,
+        0xe2, 0x88, 0x36, 0x5c, 0x57, 0x3d, 0x83, 0xe9,
+        0x95, 0xff, 0x41, 0x2b, 0x20, 0x4a, 0xf4, 0x9e,
+        0x0c, 0x66, 0xd8, 0xb2, 0xb9, 0xd3, 0x6d, 0x07,
+        0x7b, 0x11, 0xaf, 0xc5, 0xce, 0xa4, 0x1a, 0x70,
+        0xbc, 0xd6, 0x68, 0x02, 0x09, 0x63, 0xdd, 0xb7,
+        0xcb, 0xa1, 0x1f, 0x75, 0x7e, 0x14, 0xaa, 0xc0,
+        0x52, 0x38, 0x86, 0xec, 0xe7, 0x8d, 0x33, 0x59,
+        0x25, 0x4f, 0xf1, 0x9b, 0x90, 0xfa, 0x44, 0x2e,
+        0x7d, 0x17, 0xa9, 0xc3, 0xc8, 0xa2, 0x1c, 0x76,
+        0x0a, 0x60, 0xde, 0xb4, 0xbf, 0xd5, 0x6b, 0x01,
+        0x93, 0xf9, 0x47, 0x2d, 0x26, 0x4c, 0xf2, 0x98,
+        0xe4, 0x8e, 0x30, 0x5a, 0x51, 0x3b, 0x85, 0xef
+    },
+    {
+        0x00, 0x46, 0x8c, 0xca, 0x05, 0x43, 0x89, 0xcf,
+        0x0a, 0x4c, 0x86, 0xc0, 0x0f, 0x49, 0x83, 0xc5,
+        0x14, 0x52, 0x98, 0xde, 0x11, 0x57, 0x9d, 0xdb,
+        0x1e, 0x58, 0x92, 0xd4, 0x1b, 0x5d, 0x97, 0xd1,
+        0x28, 0x6e, 0xa4, 0xe2, 0x2d, 0x6b, 0xa1, 0xe7,
+        0x22, 0x64, 0xae, 0xe8, 0x27, 0x61, 0xab, 0xed,
+        0x3c, 0x7a, 0xb0, 0xf6, 0x39, 0x7f, 0xb5, 0xf3,
+        0x36, 0x70, 0xba, 0xfc, 0x33, 0x75, 0xbf, 0xf9,
+        0x50, 0x16, 0xdc, 0x9a, 0x55, 0x13, 0xd9, 0x9f,
+        0x5a, 0x1c, 0xd6, 0x90, 0x5f, 0x19, 0xd3, 0x95,
+        0x44, 0x02, 0xc8, 0x8e, 0x41, 0x07, 0xcd, 0x8b,
+        0x4e, 0x08, 0xc2, 0x84, 0x4b, 0x0d, 0xc7, 0x81,
+        0x78, 0x3e, 0xf4, 0xb2, 0x7d, 0x3b, 0xf1, 0xb7,
+        0x72, 0x34, 0xfe, 0xb8, 0x77, 0x31, 0xfb, 0xbd,
+        0x6c, 0x2a, 0xe0, 0xa6, 0x69, 0x2f, 0xe5, 0xa3,
+        0x66, 0x20, 0xea, 0xac, 0x63, 0x25, 0xef, 0xa9,
+        0xa0, 0xe6, 0x2c, 0x6a, 0xa5, 0xe3, 0x29, 0x6f,
+        0xaa, 0xec, 0x26, 0x60, 0xaf, 0xe9, 0x23, 0x65,
+        0xb4, 0xf2, 0x38, 0x7e, 0xb1, 0xf7, 0x3d, 0x7b,
+        0xbe, 0xf8, 0x32, 0x74, 0xbb, 0xfd, 0x37, 0x71,
+        0x88, 0xce, 0x04, 0x42, 0x8d, 0xcb, 0x01, 0x47,
+        0x82, 0xc4, 0x0e, 0x48, 0x87, 0xc1, 0x0b, 0x4d,
+        0x9c, 0xda, 0x10, 0x56, 0x99, 0xdf, 0x15, 0x53,
+        0x96, 0xd0, 0x1a, 0x5c, 0x93, 0xd5, 0x1f, 0x59,
+        0xf0, 0xb6, 0x7c, 0x3a, 0xf5, 0xb3, 0x79, 0x3f,
+        0xfa, 0xbc, 0x76, 0x30, 0xff, 0xb9, 0x73, 0x35,
+        0xe4, 0xa2, 0x68, 0x2e, 0xe1, 0xa7, 0x6d, 0x2b,
+        0xee, 0xa8, 0x62, 0x24, 0xeb, 0xad, 0x67, 0x21,
+        0xd8, 0x9e, 0x54, 0x12, 0xdd, 0x9b, 0x51, 0x17,
+        0xd2, 0x94, 0x5e, 0x18, 0xd7, 0x91, 0x5b, 0x1d,
+        0xcc, 0x8a, 0x40, 0x06, 0xc9, 0x8f, 0x45, 0x03,
+        0xc6, 0x80, 0x4a, 0x0c, 0xc3, 0x85, 0x4f, 0x09
+    },
+    {
+        0x00, 0x5d, 0xba, 0xe7, 0x69, 0x34, 0xd3, 0x8e,
+        0xd2, 0x8f, 0x68, 0x35, 0xbb, 0xe6, 0x01, 0x5c,
+        0xb9, 0xe4, 0x03, 0x5e, 0xd0, 0x8d, 0x6a, 0x37,
+        0x6b, 0x36, 0xd1, 0x8c, 0x02, 0x5f, 0xb8, 0xe5,
+        0x6f, 0x32, 0xd5, 0x88, 0x06, 0x5b, 0xbc, 0xe1,
+        0xbd, 0xe0, 0x07, 0x5a, 0xd4, 0x89, 0x6e, 0x33,
+        0xd6, 0x8b, 0x6c, 0x31, 0xbf, 0xe2, 0x05, 0x58,
+        0x04, 0x59, 0xbe, 0xe3, 0x6d, 0x30, 0xd7, 0x8a,
+        0xde, 0x83, 0x64, 0x39, 0xb7, 0xea, 0x0d, 0x50,
+        0x0c, 0x51, 0xb6, 0xeb, 0x65, 0x38, 0xdf, 0x82,
+        0x67, 0x3a, 0xdd, 0x80, 0x0e, 0x53, 0xb4, 0xe9,
+        0xb5, 0xe8, 0x0f, 0x52, 0xdc, 0x81, 0x66, 0x3b,
+        0xb1, 0xec, 0x0b, 0x56, 0xd8, 0x85, 0x62, 0x3f,
+        0x63, 0x3e, 0xd9, 0x84, 0x0a, 0x57, 0xb0, 0xed,
+        0x08, 0x55, 0xb2, 0xef, 0x61, 0x3c, 0xdb, 0x86,
+        0xda, 0x87, 0x60, 0x3d, 0xb3, 0xee, 0x09, 0x54,
+        0xa1, 0xfc, 0x1b, 0x46, 0xc8, 0x95, 0x72, 0x2f,
+        0x73, 0x2e, 0xc9, 0x94, 0x1a, 0x47, 0xa0, 0xfd,
+        0x18, 0x45, 0xa2, 0xff, 0x71, 0x2c, 0xcb, 0x96,
+        0xca, 0x97, 0x70, 0x2d, 0xa3, 0xfe, 0x19, 0x44,
+        0xce, 0x93, 0x74, 0x29, 0xa7, 0xfa, 0x1d, 0x40,
+        0x1c, 0x41, 0xa6, 0xfb, 0x75, 0x28, 0xcf, 0x92,
+        0x77, 0x2a, 0xcd, 0x90, 0x1e, 0x43, 0xa4, 0xf9,
+        0xa5, 0xf8, 0x1f, 0x42, 0xcc, 0x91, 0x76, 0x2b,
+        0x7f, 0x22, 0xc5, 0x98, 0x16, 0x4b, 0xac, 0xf1,
+        0xad, 0xf0, 0x17, 0x4a, 0xc4, 0x99, 0x7e, 0x23,
+        0xc6, 0x9b, 0x7c, 0x21, 0xaf, 0xf2, 0x15, 0x48,
+        0x14, 0x49, 0xae, 0xf3, 0x7d, 0x20, 0xc7, 0x9a,
+        0x10, 0x4d, 0xaa, 0xf7, 0x79, 0x24, 0xc3, 0x9e,
+        0xc2, 0x9f, 0x78, 0x25, 0xab, 0xf6, 0x11, 0x4c,
+        0xa9, 0xf4, 0x13, 0x4e, 0xc0, 0x9d, 0x7a, 0x27,
+        0x7b, 0x26, 0xc1, 0x9c, 0x12, 0x4f, 0xa8, 0xf5
+    },
+    {
+        0x00, 0x5f, 0xbe, 0xe1, 0x61, 0x3e, 0xdf, 0x80,
+        0xc2, 0x9d, 0x7c, 0x23, 0xa3, 0xfc, 0x1d, 0x42,
+        0x99, 0xc6, 0x27, 0x78, 0xf8, 0xa7, 0x46, 0x19,
+        0x5b, 0x04, 0xe5, 0xba, 0x3a, 0x65, 0x84, 0xdb,
+        0x2f, 0x70, 0x91, 0xce, 0x4e, 0x11, 0xf0, 0xaf,
+        0xed, 0xb2, 0x53, 0x0c, 0x8c, 0xd3, 0x32, 0x6d,
+        0xb6, 0xe9, 0x08, 0x57, 0xd7, 0x88, 0x69, 0x36,
+        0x74, 0x2b, 0xca, 0x95, 0x15, 0x4a, 0xab, 0xf4,
+        0x5e, 0x01, 0xe0, 0xbf, 0x3f, 0x60, 0x81, 0xde,
+        0x9c, 0xc3, 0x22, 0x7d, 0xfd, 0xa2, 0x43, 0x1c,
+        0xc7, 0x98, 0x79, 0x26, 0xa6, 0xf9, 0x18, 0x47,
+        0x05, 0x5a, 0xbb, 0xe4, 0x64, 0x3b, 0xda, 0x85,
+        0x71, 0x2e, 0xcf, 0x90, 0x10, 0x4f, 0xae, 0xf1,
+        0xb3, 0xec, 0x0d, 0x52, 0xd2, 0x8d, 0x6c, 0x33,
+        0xe8, 0xb7, 0x56, 0x09, 0x89, 0xd6, 0x37, 0x68,
+        0x2a, 0x75, 0x94, 0xcb, 0x4b, 0x14, 0xf5, 0xaa,
+        0xbc, 0xe3, 0x02, 0x5d, 0xdd, 0x82, 0x63, 0x3c,
+        0x7e, 0x21, 0xc0, 0x9f, 0x1f, 0x40, 0xa1, 0xfe,
+        0x25, 0x7a, 0x9b, 0xc4, 0x44, 0x1b, 0xfa, 0xa5,
+        0xe7, 0xb8, 0x59, 0x06, 0x86, 0xd9, 0x38, 0x67,
+        0x93, 0xcc, 0x2d, 0x72, 0xf2, 0xad, 0x4c, 0x13,
+        0x51, 0x0e, 0xef, 0xb0, 0x30, 0x6f, 0x8e, 0xd1,
+        0x0a, 0x55, 0xb4, 0xeb, 0x6b, 0x34, 0xd5, 0x8a,
+        0xc8, 0x97, 0x76, 0x29, 0xa9, 0xf6, 0x17, 0x48,
+        0xe2, 0xbd, 0x5c, 0x03, 0x83, 0xdc, 0x3d, 0x62,
+        0x20, 0x7f, 0x9e, 0xc1, 0x41, 0x1e, 0xff, 0xa0,
+        0x7b, 0x24, 0xc5, 0x9a, 0x1a, 0x45, 0xa4, 0xfb,
+        0xb9, 0xe6, 0x07, 0x58, 0xd8, 0x87, 0x66, 0x39,
+        0xcd, 0x92, 0x73, 0x2c, 0xac, 0xf3, 0x12, 0x4d,
+        0x0f, 0x50, 0xb1, 0xee, 0x6e, 0x31, 0xd0, 0x8f,
+        0x54, 0x0b, 0xea, 0xb5, 0x35, 0x6a, 0x8b, 0xd4,
+        0x96, 0xc9, 0x28, 0x77, 0xf7, 0xa8, 0x49, 0x16
+    }
+};
+
+static uint64_t load64(const uint8_t* data) {
+    uint64_t value;
+    memcpy(&value, data, sizeof(value));
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    value = __builtin_bswap64(value);
+#endif
+    return value;
+}
+
+uint8_t Crc_UpdateCRC8Register(uint8_t Crc_Register,
+                               const uint8_t* Crc_DataPtr,
+                               size_t Crc_Length) {
+    uint8_t remainder = Crc_Register;
+
+    const uint8_t* data = Crc_DataPtr;
+    size_t length = Crc_Length;
+
+    /*
+     * Divide the message by the polynomial, eight bytes at a time.
+     */
+    while (length >= 8)
+    {
+        const uint64_t word = load64(data) ^ ((uint64_t)remainder << 56);
+
+        remainder = crcTable[7][word >> 56] ^
+                    crcTable[6][(word >> 48) & 0xFF] ^
+                    crcTable[5][(word >> 40) & 0xFF] ^
+                    crcTable[4][(word >> 32) & 0xFF] ^
+                    crcTable[3][(word >> 24) & 0xFF] ^
+                    crcTable[2][(word >> 16) & 0xFF] ^
+                    crcTable[1][(word >> 8) & 0xFF] ^
+                    crcTable[0][word & 0xFF];
+
+        data += 8;
+        length -= 8;
+    }
+
+    /*
+     * Divide the remaining bytes one at a time.
+     */
+    while (length > 0)
+    {
+        remainder = crcTable[0][remainder ^ *data];
+
+        ++data;
+        --length;
+    }
+
+    return remainder;
+}
+
+// cppcheck-suppress unusedFunction
+uint8_t Crc_CalculateCRC8Long(const uint8_t* Crc_DataPtr,
+                              size_t Crc_Length,
+                              uint8_t Crc_StartValue8,
+                              bool Crc_IsFirstCall) {
+    uint8_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = 0xFF;
+    } else {
+        // SWS_Crc_00041
+        remainder = (Crc_StartValue8 ^ 0xFF);
+    }
+
+    remainder = Crc_UpdateCRC8Register(remainder, Crc_DataPtr, Crc_Length);
+
+    /*
+     * The final remainder is the CRC result.
+     */
+    return remainder ^ 0xFF;
+}
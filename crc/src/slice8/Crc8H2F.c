@@ -0,0 +1,372 @@
+/**
+ * @file Crc8H2F.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * The Crc_CalculateCRC8H2F function uses the slicing-by-8 technique from
+ * Kounavis and Berry, "A Systematic Approach to Building High Performance,
+ * Software-based, CRC Generators" (ISCC 2005).
+ *
+ * crcTable[0] is the regular byte-at-a-time table and crcTable[k] is
+ * crcTable[0] followed by k zero bytes, which lets eight table lookups
+ * consume one 64-bit load.
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include "Crc.h"
+#include "CrcRegister.h"
+
+#include <string.h>
+
+static const uint8_t crcTable[8][256] = {
+    {
+        0x00, 0x2f, 0x5e, 0x71, 0xbc, 0x93, 0xe2, 0xcd,
+        0x57, 0x78, 0x09, 0x26, 0xeb, 0xc4, 0xb5, 0x9a,
+        0xae, 0x81, 0xf0, 0xdf, 0x12, 0x3d, 0x4c, 0x63,
+        0xf9, 0xd6, 0xa7, 0x88, 0x45, 0x6a, 0x1b, 0x34,
+        0x73, 0x5c, 0x2d, 0x02, 0xcf, 0xe0, 0x91, 0xbe,
+        0x24, 0x0b, 0x7a, 0x55, 0x98, 0xb7, 0xc6, 0xe9,
+        0xdd, 0xf2, 0x83, 0xac, 0x61, 0x4e, 0x3f, 0x10,
+        0x8a, 0xa5, 0xd4, 0xfb, 0x36, 0x19, 0x68, 0x47,
+        0xe6, 0xc9, 0xb8, 0x97, 0x5a, 0x75, 0x04, 0x2b,
+        0xb1, 0x9e, 0xef, 0xc0, 0x0d, 0x22, 0x53, 0x7c,
+        0x48, 0x67, 0x16, 0x39, 0xf4, 0xdb, 0xaa, 0x85,
+        0x1f, 0x30, 0x41, 0x6e, 0xa3, 0x8c, 0xfd, 0xd2,
+        0x95, 0xba, 0xcb, 0xe4, 0x29, 0x06, 0x77, 0x58,
+        0xc2, 0xed, 0x9c, 0xb3, 0x7e, 0x51, 0x20, 0x0f,
+        0x3b, 0x14, 0x65, 0x4a, 0x87, 0xa8, 0xd9, 0xf6,
+        0x6c, 0x43, 0x32, 0x1d, 0xd0, 0xff, 0x8e, 0xa1,
+        0xe3, 0xcc, 0xbd, 0x92, 0x5f, 0x70, 0x01, 0x2e,
+        0xb4, 0x9b, 0xea, 0xc5, 0x08, 0x27, 0x56, 0x79,
+        0x4d, 0x62, 0x13, 0x3c, 0xf1, 0xde, 0xaf, 0x80,
+        0x1a, 0x35, 0x44, 0x6b, 0xa6, 0x89, 0xf8, 0xd7,
+        0x90, 0xbf, 0xce, 0xe1, 0x2c, 0x03, 0x72, 0x5d,
+        0xc7, 0xe8, 0x99, 0xb6, 0x7b, 0x54, 0x25, 0x0a,
+        0x3e, 0x11, 0x60, 0x4f, 0x82, 0xad, 0xdc, 0xf3,
+        0x69, 0x46, 0x37, 0x18, 0xd5, 0xfa, 0x8b, 0xa4,
+        0x05, 0x2a, 0x5b, 0x74, 0xb9, 0x96, 0xe7, 0xc8,
+        0x52, 0x7d, 0x0c, 0x23, 0xee, 0xc1, 0xb0, 0x9f,
+        0xab, 0x84, 0xf5, 0xda, 0x17, 0x38, 0x49, 0x66,
+        0xfc, 0xd3, 0xa2, 0x8d, 0x40, 0x6f, 0x1e, 0x31,
+        0x76, 0x59, 0x28, 0x07, 0xca, 0xe5, 0x94, 0xbb,
+        0x21, 0x0e, 0x7f, 0x50, 0x9d, 0xb2, 0xc3, 0xec,
+        0xd8, 0xf7, 0x86, 0xa9, 0x64, 0x4b, 0x3a, 0x15,
+        0x8f, 0xa0, 0xd1, 0xfe, 0x33, 0x1c, 0x6d, 0x42
+    },
+    {
+        0x00, 0xe9, 0xfd, 0x14, 0xd5, 0x3c, 0x28, 0xc1,
+        0x85, 0x6c, 0x78, 0x91, 0x50, 0xb9, 0xad, 0x44,
+        0x25, 0xcc, 0xd8, 0x31, 0xf0, 0x19, 0x0d, 0xe4,
+        0xa0, 0x49, 0x5d, 0xb4, 0x75, 0x9c, 0x88, 0x61,
+        0x4a, 0xa3, 0xb7, 0x5e, 0x9f, 0x76, 0x62, 0x8b,
+        0xcf, 0x26, 0x32, 0xdb, 0x1a, 0xf3, 0xe7, 0x0e,
+        0x6f, 0x86, 0x92, 0x7b, 0xba, 0x53, 0x47, 0xae,
+        0xea, 0x03, 0x17, 0xfe, 0x3f, 0xd6, 0xc2, 0x2b,
+        0x94, 0x7d, 0x69, 0x80, 0x41, 0xa8, 0xbc, 0x55,
+        0x11, 0xf8, 0xec, 0x05, 0xc4, 0x2d, 0x39, 0xd0,
+        0xb1, 0x58, 0x4c, 0xa5, 0x64, 0x8d, 0x99, 0x70,
+        0x34, 0xdd, 0xc9, 0x20, 0xe1, 0x08, 0x1c, 0xf5,
+        0xde, 0x37, 0x23, 0xca, 0x0b, 0xe2, 0xf6, 0x1f,
+        0x5b, 0xb2, 0xa6, 0x4f, 0x8e, 0x67, 0x73, 0x9a,
+        0xfb, 0x12, 0x06, 0xef, 0x2e, 0xc7, 0xd3, 0x3a,
+        0x7e, 0x97, 0x83, 0x6a, 0xab, 0x42, 0x56, 0xbf,
+        0x07, 0xee, 0xfa, 0x13, 0xd2, 0x3b, 0x2f, 0xc6,
+        0x82, 0x6b, 0x7f, 0x96, 0x57, 0xbe, 0xaa, 0x43,
+        0x22, 0xcb, 0xdf, 0x36, 0xf7, 0x1e, 0x0a, 0xe3,
+        0xa7, 0x4e, 0x5a, 0xb3, 0x72, 0x9b, 0x8f, 0x66,
+        0x4d, 0xa4, 0xb0, 0x59, 0x98, 0x71, 0x65, 0x8c,
+        0xc8, 0x21, 0x35, 0xdc, 0x1d, 0xf4, 0xe0, 0x09,
+        0x68, 0x81, 0x95, 0x7c, 0xbd, 0x54, 0x40, 0xa9,
+        0xed, 0x04, 0x10, 0xf9, 0x38, 0xd1, 0xc5, 0x2c,
+        0x93, 0x7a, 0x6e, 0x87, 0x46, 0xaf, 0xbb, 0x52,
+        0x16, 0xff, 0xeb, 0x02, 0xc3, 0x2a, 0x3e, 0xd7,
+        0xb6, 0x5f, 0x4b, 0xa2, 0x63, 0x8a, 0x9e, 0x77,
+        0x33, 0xda, 0xce, 0x27, 0xe6, 0x0f, 0x1b, 0xf2,
+        0xd9, 0x30, 0x24, 0xcd, 0x0c, 0xe5, 0xf1, 0x18,
+        0x5c, 0xb5, 0xa1, 0x48, 0x89, 0x60, 0x74, 0x9d,
+        0xfc, 0x15, 0x01, 0xe8, 0x29, 0xc0, 0xd4, 0x3d,
+        0x79, 0x90, 0x84, 0x6d, 0xac, 0x45, 0x51, 0xb8
+    },
+    {
+        0x00, 0x0e, 0x1c, 0x12, 0x38, 0x36, 0x24, 0x2a,
+        0x70, 0x7e, 0x6c, 0x62, 0x48, 0x46, 0x54, 0x5a,
+        0xe0, 0xee, 0xfc, 0xf2, 0xd8, 0xd6, 0xc4, 0xca,
+        0x90, 0x9e, 0x8c, 0x82, 0xa8, 0xa6, 0xb4, 0xba,
+        0xef, 0xe1, 0xf3, 0xfd, 0xd7, 0xd9, 0xcb, 0xc5,
+        0x9f, 0x91, 0x83, 0x8d, 0xa7, 0xa9, 0xbb, 0xb5,
+        0x0f, 0x01, 0x13, 0x1d, 0x37, 0x39, 0x2b, 0x25,
+        0x7f, 0x71, 0x63, 0x6d, 0x47, 0x49, 0x5b, 0x55,
+        0xf1, 0xff, 0xed, 0xe3, 0xc9, 0xc7, 0xd5, 0xdb,
+        0x81, 0x8f, 0x9d, 0x93, 0xb9, 0xb7, 0xa5, 0xab,
+        0x11, 0x1f, 0x0d, 0x03, 0x29, 0x27, 0x35, 0x3b,
+        0x61, 0x6f, 0x7d, 0x73, 0x59, 0x57, 0x45, 0x4b,
+        0x1e, 0x10, 0x02, 0x0c, 0x26, 0x28, 0x3a, 0x34,
+        0x6e, 0x60, 0x72, 0x7c, 0x56, 0x58, 0x4a, 0x44,
+        0xfe, 0xf0, 0xe2, 0xec, 0xc6, 0xc8, 0xda, 0xd4,
+        0x8e, 0x80, 0x92, 0x9c, 0xb6, 0xb8, 0xaa, 0xa4,
+        0xcd, 0xc3, 0xd1, 0xdf, 0xf5, 0xfb, 0xe9, 0xe7,
+        0xbd, 0xb3, 0xa1, 0xaf, 0x85, 0x8b, 0x99, 0x97,
+        0x2d, 0x23, 0x31, 0x3f, 0x15, 0x1b, 0x09, 0x07,
+        0x5d, 0x53, 0x41, 0x4f, 0x65, 0x6b, 0x79, 0x77,
+        0x22, 0x2c, 0x3e, 0x30, 0x1a, 0x14, 0x06, 0x08,
+        0x52, 0x5c, 0x4e, 0x40, 0x6a, 0x64, 0x76, 0x78,
+        0xc2, 0xcc, 0xde, 0xd0, 0xfa, 0xf4, 0xe6, 0xe8,
+        0xb2, 0xbc, 0xae, 0xa0, 0x8a, 0x84, 0x96, 0x98,
+        0x3c, 0x32, 0x20, 0x2e, 0x04, 0x0a, 0x18, 0x16,
+        0x4c, 0x42, 0x50, 0x5e, 0x74, 0x7a, 0x68, 0x66,
+        0xdc, 0xd2, 0xc0, 0xce, 0xe4, 0xea, 0xf8, 0xf6,
+        0xac, 0xa2, 0xb0, 0xbe, 0x94, 0x9a, 0x88, 0x86,
+        0xd3, 0xdd, 0xcf, 0xc1, 0xeb, 0xe5, 0xf7, 0xf9,
+        0xa3, 0xad, 0xbf, 0xb1, 0x9b, 0x95, 0x87, 0x89,
+        0x33, 0x3d, 0x2f, 0x21, 0x0b, 0x05, 0x17, 0x19,
+        0x43, 0x4d, 0x5f, 0x51, 0x7b, 0x75, 0x67, 0x69
+    },
+    {
+        0x00, 0xb5, 0x45, 0xf0, 0x8a, 0x3f, 0xcf, 0x7a,
+        0x3b, 0x8e, 0x7e, 0xcb, 0xb1, 0x04, 0xf4, 0x41,
+        0x76, 0xc3, 0x33, 0x86, 0xfc, 0x49, 0xb9, 0x0c,
+        0x4d, 0xf8, 0x08, 0xbd, 0xc7, 0x72, 0x82, 0x37,
+        0xec, 0x59, 0xa9, 0x1c, 0x66, 0xd3, 0x23, 0x96,
+        0xd7, 0x62, 0x92, 0x27, 0x5d, 0xe8, 0x18, 0xad,
+        0x9a, 0x2f, 0xdf, 0x6a, 0x10, 0xa5, 0x55, 0xe0,
+        0xa1, 0x14, 0xe4, 0x51, 0x2b, 0x9e, 0x6e, 0xdb,
+        0xf7, 0x42, 0xb2, 0x07, 0x7d, 0xc8, 0x38, 0x8d,
+        0xcc, 0x79, 0x89, 0x3c, 0x46, 0xf3, 0x03, 0xb6,
+        0x81, 0x34, 0xc4, 0x71, 0x0b, 0xbe, 0x4e, 0xfb,
+        0xba, 0x0f, 0xff, 0x4a, 0x30, 0x85, 0x75, 0xc0,
+        0x1b, 0xae, 0x5e, 0xeb, 0x91, 0x24, 0xd4, 0x61,
+        0x20, 0x95, 0x65, 0xd0, 0xaa, 0x1f, 0xef, 0x5a,
+        0x6d, 0xd8, 0x28, 0x9d, 0xe7, 0x52, 0xa2, 0x17,
+        0x56, 0xe3, 0x13, 0xa6, 0xdc, 0x69, 0x99, 0x2c,
+        0xc1, 0x74, 0x84, 0x31, 0x4b, 0xfe, 0x0e, 0xbb,
+        0xfa, 0x4f, 0xbf, 0x0a, 0x70, 0xc5, 0x35, 0x80,
+        0xb7, 0x02, 0xf2, 0x47, 0x3d, 0x88, 0x78, 0xcd,
+        0x8c, 0x39, 0xc9, 0x7c, 0x06, 0xb3, 0x43, 0xf6,
+        0x2d, 0x98, 0x68, 0xdd, 0xa7, 0x12, 0xe2, 0x57,
+        0x16, 0xa3, 0x53, 0xe6, 0x9c, 0x29, 0xd9, 0x6c,
+        0x5b, 0xee, 0x1e, 0xab, 0xd1, 0x64, 0x94, 0x21,
+        0x60, 0xd5, 0x25, 0x90, 0xea, 0x5f, 0xaf, 0x1a,
+        0x36, 0x83, 0x73, 0xc6, 0xbc, 0x09, 0xf9, 0x4c,
+        0x0d, 0xb8, 0x48, 0xfd, 0x87, 0x32, 0xc2, 0x77,
+        0x40, 0xf5, 0x05, 0xb0, 0xca, 0x7f, 0x8f, 0x3a,
+        0x7b, 0xce, 0x3e, 0x8b, 0xf1, 0x44, 0xb4, 0x01,
+        0xda, 0x6f, 0x9f, 0x2a, 0x50, 0xe5, 0x15, 0xa0,
+        0xe1, 0x54, 0xa4, 0x11, 0x6b, 0xde, 0x2e, 0x9b,
+        0xac, 0x19, 0xe9, 0x5c, 0x26, 0x93, 0x63, 0xd6,
+        0x97, 0x22, 0xd2, 0x67, 0x1d, 0xa8, 0x58, 0xed
+    },
+    {
+        0x00, 0xad, 0x75, 0xd8, 0xea, 0x47, 0x9f, 0x32,
+        0xfb, 0x56, 0x8e, 0x23, 0x11, 0xbc, 0x64, 0xc9,
+        0xd9, 0x74, 0xac, 0x01, 0x33, 0x9e, 0x46, 0xeb,
+        0x22, 0x8f, 0x57, 0xfa, 0xc8, 0x65, 0xbd, 0x10,
+        0x9d, 0x30, 0xe8, 0x45, 0x77, 0xda, 0x02, 0xaf,
+        0x66, 0xcb, 0x13, 0xbe, 0x8c, 0x21, 0xf9, 0x54,
+        0x44, 0xe9, 0x31, 0x9c, 0xae, 0x03, 0xdb, 0x76,
+        0xbf, 0x12, 0xca, 0x67, 0x55, 0xf8, 0x20, 0x8d,
+        0x15, 0xb8, 0x60, 0xcd, 0xff, 0x52, 0x8a, 0x27,
+        0xee, 0x43, 0x9b, 0x36, 0x04, 0xa9, 0x71, 0xdc,
+        0xcc, 0x61, 0xb9, 0x14, 0x26, 0x8b, 0x53, 0xfe,
+        0x37, 0x9a, 0x42, 0xef, 0xdd, 0x70, 0xa8, 0x05,
+        0x88, 0x25, 0xfd, 0x50, 0x62, 0xcf, 0x17, 0xba,
+        0x73, 0xde, 0x06, 0xab, 0x99, 0x34, 0xec, 0x41,
+        0x51, 0xfc, 0x24, 0x89, 0xbb, 0x16, 0xce, 0x63,
+        0xaa, 0x07, 0xdf, 0x72, 0x40, 0xed, 0x35, 0x98,
+        0x2a, 0x87, 0x5f, 0xf2, 0xc0, 0x6d, 0xb5, 0x18,
+        0xd1, 0x7c, 0xa4, 0x09, 0x3b, 0x96, 0x4e, 0xe3,
+        0xf3, 0x5e, 0x86, 0x2b, 0x19, 0xb4, 0x6c, 0xc1,
+        0x08, 0xa5, 0x7d, 0xd0, 0xe2, 0x4f, 0x97, 0x3a,
+        0xb7, 0x1a, 0xc2, 0x6f, 0x5d, 0xf0, 0x28, 0x85,
+        0x4c, 0xe1, 0x39, 0x94, 0xa6, 0x0b, 0xd3, 0x7e,
+        0x6e, 0xc3, 0x1b, 0xb6, 0x84, 0x29, 0xf1, 0x5c,
+        0x95, 0x38, 0xe0, 0x4d, 0x7f, 0xd2, 0x0a, 0xa7,
+        0x3f, 0x92, 0x4a, 0xe7, 0xd5, 0x78, 0xa0, 0x0d,
+        0xc4, 0x69, 0xb1, 0x1c, 0x2e, 0x83, 0x5b, 0xf6,
+        0xe6, 0x4b, 0x93, 0x3e, 0x0c, 0xa1, 0x79, 0xd4,
+        0x1d, 0xb0, 0x68, 0xc5, 0xf7, 0x5a, 0x82, 0x2f,
+        0xa2, 0x0f, 0xd7, 0x7a, 0x48, 0xe5, 0x3d, 0x90,
+        0x59, 0xf4, 0x2c, 0x81, 0xb3, 0x1e, 0xc6, 0x6b,
+        0x7b, 0xd6, 0x0e, 0xa3, 0x91, 0x3c, 0xe4, 0x49,
+        0x80, 0x2d, 0xf5, 0x58, 0x6a, 0xc7, 0x1f, 0xb2
+    },
+    {
+        0x00, 0x54, 0xa8, 0xfc, 0x7f, 0x2b, 0xd7, 0x83,
+        0xfe, 0xaa, 0x56, 0x02, 0x81, 0xd5, 0x29, 0x7d,
+        0xd3, 0x87, 0x7b, 0x2f, 0xac, 0xf8, 0x04, 0x50,
+        0x2d, 0x79, 0x85, 0xd1, 0x52, 0x06, 0xfa, 0xae,
+        0x89, 0xdd, 0x21, 0x75, 0xf6, 0xa2, 0x5e, 0x0a,
+        0x77, 0x23, 0xdf, 0x8b, 0x08, 0x5c, 0xa0, 0xf4,
+        0x5a, 0x0e, 0xf2, 0xa6, 0x25, 0x71, 0x8d, 0xd9,
+        0xa4, 0xf0, 0x0c, 0x58, 0xdb, 0x8f, 0x73, 0x27,
+        0x3d, 0x69, 0x95, 0xc1, 0x42, 0x16, 0xea, 0xbe,
+        0xc3, 0x97, 0x6b, 0x3f, 0xbc, 0xe8, 0x14, 0x40,
+        0xee, 0xba, 0x46, 0x12, 0x91, 0xc5, 0x39, 0x6d,
+        0x10, 0x44, 0xb8, 0xec, 0x6f, 0x3b, 0xc7, 0x93,
+        0xb4, 0xe0, 0x1c, 0x48, 0xcb, 0x9f, 0x63, 0x37,
+        0x4a, 0x1e, 0xe2, 0xb6, 0x35, 0x61, 0x9d, 0xc9,
+        0x67, 0x33, 0xcf, 0x9b, 0x18, 0x4c, 0xb0, 0xe4,
+        0x99, 0xcd, 0x31, 0x65, 0xe6, 0xb2, 0x4e, 0x1a,
+        0x7a, 0x2e, 0xd2, 0x86, 0x05, 0x51, 0xad, 0xf9,
+        0x84, 0xd0, 0x2c, 0x78, 0xfb, 0xaf, 0x53, 0x07,
+        0xa9, 0xfd, 0x01, 0x55, 0xd6, 0x82, 0x7e, 0x2a,
+        0x57, 0x03, 0xff, 0xab, 0x28, 0x7c, 0x80, 0xd4,
+        0xf3, 0xa7, 0x5b, 0x0f, 0x8c, 0xd8, 0x24, 0x70,
+        0x0d, 0x59, 0xa5, 0xf1, 0x72, 0x26, 0xda, 0x8e,
+        0x20, 0x74, 0x88, 0xdc, 0x5f, 0x0b, 0xf7, 0xa3,
+        0xde, 0x8a, 0x76, 0x22, 0xa1, 0xf5, 0x09, 0x5d,
+        0x47, 0x13, 0xef, 0xbb, 0x38, 0x6c, 0x90, 0xc4,
+        0xb9, 0xed, 0x11, 0x45, 0xc6, 0x92, 0x6e, 0x3a,
+        0x94, 0xc0, 0x3c, 0x68, 0xeb, 0xbf, 0x43, 0x17,
+        0x6a, 0x3e, 0xc2, 0x96, 0x15, 0x41, 0xbd, 0xe9,
+        0xce, 0x9a, 0x66, 0x32, 0xb1, 0xe5, 0x19, 0x4d,
+        0x30, 0x64, 0x98, 0xcc, 0x4f, 0x1b, 0xe7, 0xb3,
+        0x1d, 0x49, 0xb5, 0xe1, 0x62, 0x36, 0xca, 0x9e,
+        0xe3, 0xb7, 0x4b, 0x1f, 0x9c, 0xc8, 0x34, 0x60
+    },
+    {
+        0x00, 0xf4, 0xc7, 0x33, 0xa1, 0x55, 0x66, 0x92,
+        0x6d, 0x99, 0xaa, 0x5e, 0xcc, 0x38, 0x0b, 0xff,
+        0xda, 0x2e, 0x1d, 0xe9, 0x7b, 0x8f, 0xbc, 0x48,
+        0xb7, 0x43, 0x70, 0x84, 0x16, 0xe2, 0xd1, 0x25,
+        0x9b, 0x6f, 0x5c, 0xa8, 0x3a, 0xce, 0xfd, 0x09,
+        0xf6, 0x02, 0x31, 0xc5, 0x57, 0xa3, 0x90, 0x64,
+        0x41, 0xb5, 0x86, 0x72, 0xe0, 0x14, 0x27, 0xd3,
+        0x2c, 0xd8, 0xeb, 0x1f, 0x8d, 0x79, 0x4a, 0xbe,
+        0x19, 0xed, 0xde, 0x2a, 0xb8, 0x4c, 0x7f, 0x8b,
+        0x74, 0x80, 0xb3, 0x47, 0xd5, 0x21, 0x12, 0xe6,
+        0xc3, 0x37, 0x04, 0xf0, 0x62, 0x96, 0xa5, 0x51,
+        0xae, 0x5a, 0x69, 0x9d, 0x0f, 0xfb, 0xc8, 0x3c,
+        0x82, 0x76, 0x45, 0xb1, 0x23, 0xd7, 0xe4, 0x10,
+        0xef, 0x1b, 0x28, 0xdc, 0x4e, 0xba, 0x89, 0x7d,
+        0x58, 0xac, 0x9f, 0x6b, 0xf9, 0x0d, 0x3e, 0xca,
+        0x35, 0xc1, 0xf2, 0x06, 0x94, 0x60, 0x53, 0xa7,
+        0x32, 0xc6, 0xf5, 0x01, 0x93, 0x67, 0x54, 0xa0,
+        0x5f, 0xab, 0x98, 0x6c, 0xfe, 0x0a, 0x39, 0xcd,
+        0xe8, 0x1c, 0x2f, 0xdb, 0x49, 0xbd, 0x8e, 0x7a,
+        0x85, 0x71, 0x42, 0xb6, 0x24, 0xd0, 0xe3, 0x17,
+        0xa9, 0x5d, 0x6e, 0x9a, 0x08, 0xfc, 0xcf, 0x3b,
+        0xc4, 0x30, 0x03, 0xf7, 0x65, 0x91, 0xa2, 0x56,
+        0x73, 0x87, 0xb4, 0x40, 0xd2, 0x26, 0x15, 0xe1,
+        0x1e, 0xea, 0xd9, 0x2d, 0xbf, 0x4b, 0x78, 0x8c,
+        0x2b, 0xdf, 0xec, 0x18, 0x8a, 0x7e, 0x4d, 0xb9,
+        0x46, 0xb2, 0x81, 0x75, 0xe7, 0x13, 0x20, 0xd4,
+        0xf1, 0x05, 0x36, 0xc2, 0x50, 0xa4, 0x97, 0x63,
+        0x9c, 0x68, 0x5b, 0xaf, 0x3d, 0xc9, 0xfa, 0x0e,
+        0xb0, 0x44, 0x77, 0x83, 0x11, 0xe5, 0xd6, 0x22,
+        0xdd, 0x29, 0x1a, 0xee, 0x7c, 0x88, 0xbb, 0x4f,
+        0x6a, 0x9e, 0xad, 0x59, 0xcb, 0x3f, 0x0c, 0xf8,
+        0x07, 0xf3, 0xc0, 0x34, 0xa6, 0x52, 0x61, 0x95
+    },
+    {
+        0x00, 0x64, 0xc8, 0xac, 0xbf, 0xdb, 0x77, 0x13,
+        0x51, 0x35, 0x99, 0xfd, 0xee, 0x8a, 0x26, 0x42,
+        0xa2, 0xc6, 0x6a, 0x0e, 0x1d, 0x79, 0xd5, 0xb1,
+        0xf3, 0x97, 0x3b, 0x5f, 0x4c, 0x28, 0x84, 0xe0,
+        0x6b, 0x0f, 0xa3, 0xc7, 0xd4, 0xb0, 0x1c, 0x78,
+        0x3a, 0x5e, 0xf2, 0x96, 0x85, 0xe1, 0x4d, 0x29,
+        0xc9, 0xad, 0x01, 0x65, 0x76, 0x12, 0xbe, 0xda,
+        0x98, 0xfc, 0x50, 0x34, 0x27, 0x43, 0xef, 0x8b,
+        0xd6, 0xb2, 0x1e, 0x7a, 0x69, 0x0d, 0xa1, 0xc5,
+        0x87, 0xe3, 0x4f, 0x2b, 0x38, 0x5c, 0xf0, 0x94,
+        0x74, 0x10, 0xbc, 0xd8, 0xcb, 0xaf, 0x03, 0x67,
+        0x25, 0x41, 0xed, 0x89, 0x9a, 0xfe, 0x52, 0x36,
+        0xbd, 0xd9, 0x75, 0x11, 0x02, 0x66, 0xca, 0xae,
+        0xec, 0x88, 0x24, 0x40, 0x53, 0x37, 0x9b, 0xff,
+        0x1f, 0x7b, 0xd7, 0xb3, 0xa0, 0xc4, 0x68, 0x0c,
+        0x4e, 0x2a, 0x86, 0xe2, 0xf1, 0x95, 0x39, 0x5d,
+        0x83, 0xe7, 0x4b, 0x2f, 0x3c, 0x58, 0xf4, 0x90,
+        0xd2, 0xb6, 0x1a, 0x7e, 0x6d, 0x09, 0xa5, 0xc1,
+        0x21, 0x45, 0xe9, 0x8d, 0x9e, 0xfa, 0x56, 0x32,
+        0x70, 0x14, 0xb8, 0xdc, 0xcf, 0xab, 0x07, 0x63,
+        0xe8, 0x8c, 0x20, 0x44, 0x57, 0x33, 0x9f, 0xfb,
+        0xb9, 0xdd, 0x71, 0x15, 0x06, 0x62, 0xce, 0xaa,
+        0x4a, 0x2e, 0x82, 0xe6, 0xf5, 0x91, 0x3d, 0x59,
+        0x1b, 0x7f, 0xd3, 0xb7, 0xa4, 0xc0, 0x6c, 0x08,
+        0x55, 0x31, 0x9d, 0xf9, 0xea, 0x8e, 0x22, 0x46,
+        0x04, 0x60, 0xcc, 0xa8, 0xbb, 0xdf, 0x73, 0x17,
+        0xf7, 0x93, 0x3f, 0x5b, 0x48, 0x2c, 0x80, 0xe4,
+        0xa6, 0xc2, 0x6e, 0x0a, 0x19, 0x7d, 0xd1, 0xb5,
+        0x3e, 0x5a, 0xf6, 0x92, 0x81, 0xe5, 0x49, 0x2d,
+        0x6f, 0x0b, 0xa7, 0xc3, 0xd0, 0xb4, 0x18, 0x7c,
+        0x9c, 0xf8, 0x54, 0x30, 0x23, 0x47, 0xeb, 0x8f,
+        0xcd, 0xa9, 0x05, 0x61, 0x72, 0x16, 0xba, 0xde
+    }
+};
+
+static uint64_t load64(const uint8_t* data) {
+    uint64_t value;
+    memcpy(&value, data, sizeof(value));
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    value = __builtin_bswap64(value);
+#endif
+    return value;
+}
+
+uint8_t Crc_UpdateCRC8H2FRegister(uint8_t Crc_Register,
+                                  const uint8_t* Crc_DataPtr,
+                                  size_t Crc_Length) {
+    uint8_t remainder = Crc_Register;
+
+    const uint8_t* data = Crc_DataPtr;
+    size_t length = Crc_Length;
+
+    /*
+     * Divide the message by the polynomial, eight bytes at a time.
+     */
+    while (length >= 8)
+    {
+        const uint64_t word = load64(data) ^ ((uint64_t)remainder << 56);
+
+        remainder = crcTable[7][word >> 56] ^
+                    crcTable[6][(word >> 48) & 0xFF] ^
+                    crcTable[5][(word >> 40) & 0xFF] ^
+                    crcTable[4][(word >> 32) & 0xFF] ^
+                    crcTable[3][(word >> 24) & 0xFF] ^
+                    crcTable[2][(word >> 16) & 0xFF] ^
+                    crcTable[1][(word >> 8) & 0xFF] ^
+                    crcTable[0][word & 0xFF];
+
+        data += 8;
+        length -= 8;
+    }
+
+    /*
+     * Divide the remaining bytes one at a time.
+     */
+    while (length > 0)
+    {
+        remainder = crcTable[0][remainder ^ *data];
+
+        ++data;
+        --length;
+    }
+
+    return remainder;
+}
+
+// cppcheck-suppress unusedFunction
+uint8_t Crc_CalculateCRC8H2FLong(const uint8_t* Crc_DataPtr,
+                                 size_t Crc_Length,
+                                 uint8_t Crc_StartValue8H2F,
+                                 bool Crc_IsFirstCall) {
+    uint8_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = 0xFF;
+    } else {
+        // SWS_Crc_00041
+        remainder = (Crc_StartValue8H2F ^ 0xFF);
+    }
+
+    remainder = Crc_UpdateCRC8H2FRegister(remainder, Crc_DataPtr, Crc_Length);
+
+    /*
+     * The final remainder is the CRC result.
+     */
+    return remainder ^ 0xFF;
+}
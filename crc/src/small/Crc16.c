@@ -19,23 +19,14 @@
  */
 
 #include "Crc.h"
+#include "CrcRegister.h"
 
-// cppcheck-suppress unusedFunction
-uint16_t Crc_CalculateCRC16(const uint8_t* Crc_DataPtr,
-                          uint32_t Crc_Length,
-                          uint16_t Crc_StartValue16,
-                          bool Crc_IsFirstCall) {
+uint16_t Crc_UpdateCRC16Register(uint16_t Crc_Register,
+                                 const uint8_t* Crc_DataPtr,
+                                 size_t Crc_Length) {
     const uint16_t topbit = 0x8000;
     const uint16_t polynomial = 0x1021;
-    uint16_t remainder = 0;
-
-    if (Crc_IsFirstCall) {
-        // SWS_Crc_00014
-        remainder = 0xFFFF;
-    } else {
-        // SWS_Crc_00041
-        remainder = (Crc_StartValue16 ^ 0x0000);
-    }
+    uint16_t remainder = Crc_Register;
 
     /*
      * Perform modulo-2 division, a byte at a time.
@@ -66,6 +57,26 @@ uint16_t Crc_CalculateCRC16(const uint8_t* Crc_DataPtr,
         }
     }
 
+    return remainder;
+}
+
+// cppcheck-suppress unusedFunction
+uint16_t Crc_CalculateCRC16Long(const uint8_t* Crc_DataPtr,
+                              size_t Crc_Length,
+                              uint16_t Crc_StartValue16,
+                              bool Crc_IsFirstCall) {
+    uint16_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = 0xFFFF;
+    } else {
+        // SWS_Crc_00041
+        remainder = (Crc_StartValue16 ^ 0x0000);
+    }
+
+    remainder = Crc_UpdateCRC16Register(remainder, Crc_DataPtr, Crc_Length);
+
     /*
      * The final remainder is the CRC result.
      */
@@ -21,47 +21,17 @@
  */
 
 #include "Crc.h"
+#include "CrcRegister.h"
 
-static uint32_t reflect(uint32_t data, uint8_t nBits) {
-    uint32_t  reflection = 0x00000000;
-	uint8_t  bit;
-
-	/*
-	 * Reflect the data about the center bit.
-	 */
-	for (bit = 0; bit < nBits; ++bit)
-	{
-		/*
-		 * If the LSB bit is set, set the reflection of it.
-		 */
-		if (data & 0x01)
-		{
-			reflection |= (1 << ((nBits - 1) - bit));
-		}
-
-		data = (data >> 1);
-	}
-
-	return (reflection);
-}
-
-// cppcheck-suppress unusedFunction
-uint32_t Crc_CalculateCRC32(const uint8_t* Crc_DataPtr,
-                          uint32_t Crc_Length,
-                          uint32_t Crc_StartValue32,
-                          bool Crc_IsFirstCall) {
-    const uint32_t topbit = 0x80000000;
-    const uint32_t polynomial = 0x04C11DB7;
-    uint32_t remainder = 0;
-
-    if (Crc_IsFirstCall) {
-        // SWS_Crc_00014
-        remainder = 0xFFFFFFFF;
-    } else {
-        // SWS_Crc_00041
-        remainder = (Crc_StartValue32 ^ 0xFFFFFFFF);
-        remainder = reflect(remainder, 32);
-    }
+uint32_t Crc_UpdateCRC32Register(uint32_t Crc_Register,
+                                 const uint8_t* Crc_DataPtr,
+                                 size_t Crc_Length) {
+    /*
+     * 0x04C11DB7 reflected. The remainder is kept in the bit order of the input
+     * data and of the result, so nothing is reflected.
+     */
+    const uint32_t polynomial = 0xEDB88320;
+    uint32_t remainder = Crc_Register;
 
     /*
      * Perform modulo-2 division, a byte at a time.
@@ -71,7 +41,7 @@ uint32_t Crc_CalculateCRC32(const uint8_t* Crc_DataPtr,
         /*
          * Bring the next byte into the remainder.
          */
-        remainder ^= reflect(Crc_DataPtr[byte], 8) << 24;
+        remainder ^= Crc_DataPtr[byte];
 
         /*
          * Perform modulo-2 division, a bit at a time.
@@ -81,19 +51,39 @@ uint32_t Crc_CalculateCRC32(const uint8_t* Crc_DataPtr,
             /*
              * Try to divide the current data bit.
              */
-            if (remainder & topbit)
+            if (remainder & 0x01)
             {
-                remainder = (remainder << 1) ^ polynomial;
+                remainder = (remainder >> 1) ^ polynomial;
             }
             else
             {
-                remainder = (remainder << 1);
+                remainder = (remainder >> 1);
             }
         }
     }
 
+    return remainder;
+}
+
+// cppcheck-suppress unusedFunction
+uint32_t Crc_CalculateCRC32Long(const uint8_t* Crc_DataPtr,
+                              size_t Crc_Length,
+                              uint32_t Crc_StartValue32,
+                              bool Crc_IsFirstCall) {
+    uint32_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = 0xFFFFFFFF;
+    } else {
+        // SWS_Crc_00041
+        remainder = (Crc_StartValue32 ^ 0xFFFFFFFF);
+    }
+
+    remainder = Crc_UpdateCRC32Register(remainder, Crc_DataPtr, Crc_Length);
+
     /*
      * The final remainder is the CRC result.
      */
-    return reflect(remainder, 32) ^ 0xFFFFFFFF;
+    return remainder ^ 0xFFFFFFFF;
 }
@@ -19,52 +19,17 @@
  */
 
 #include "Crc.h"
+#include "CrcRegister.h"
 
-static uint64_t reflect(uint64_t data, uint8_t nBits) {
-    uint64_t  reflection = 0x0000000000000000;
-	uint8_t  bit;
-
-	/*
-	 * Reflect the data about the center bit.
-	 */
-	for (bit = 0; bit < nBits; ++bit)
-	{
-		/*
-		 * If the LSB bit is set, set the reflection of it.
-		 */
-		if (data & 0x01)
-		{
-            /**
-             * Note the '1ULL' integer literal
-             * The type of the result of a bit-shift operation is the same
-             * as the type of the left-hand operator.
-             */
-			reflection |= (1ULL << ((nBits - 1) - bit));
-		}
-
-		data = (data >> 1);
-	}
-
-	return (reflection);
-}
-
-// cppcheck-suppress unusedFunction
-uint64_t Crc_CalculateCRC64(const uint8_t* Crc_DataPtr,
-                          uint32_t Crc_Length,
-                          uint64_t Crc_StartValue64,
-                          bool Crc_IsFirstCall) {
-    const uint64_t topbit = 0x8000000000000000;
-    const uint64_t polynomial = 0x42F0E1EBA9EA3693;
-    uint64_t remainder = 0;
-
-    if (Crc_IsFirstCall) {
-        // SWS_Crc_00014
-        remainder = 0xFFFFFFFFFFFFFFFF;
-    } else {
-        // SWS_Crc_00041
-        remainder = (Crc_StartValue64 ^ 0xFFFFFFFFFFFFFFFF);
-        remainder = reflect(remainder, 64);
-    }
+uint64_t Crc_UpdateCRC64Register(uint64_t Crc_Register,
+                                 const uint8_t* Crc_DataPtr,
+                                 size_t Crc_Length) {
+    /*
+     * 0x42F0E1EBA9EA3693 reflected. The remainder is kept in the bit order of the input
+     * data and of the result, so nothing is reflected.
+     */
+    const uint64_t polynomial = 0xC96C5795D7870F42;
+    uint64_t remainder = Crc_Register;
 
     /*
      * Perform modulo-2 division, a byte at a time.
@@ -74,7 +39,7 @@ uint64_t Crc_CalculateCRC64(const uint8_t* Crc_DataPtr,
         /*
          * Bring the next byte into the remainder.
          */
-        remainder ^= reflect(Crc_DataPtr[byte], 8) << 56;
+        remainder ^= Crc_DataPtr[byte];
 
         /*
          * Perform modulo-2 division, a bit at a time.
@@ -84,19 +49,39 @@ uint64_t Crc_CalculateCRC64(const uint8_t* Crc_DataPtr,
             /*
              * Try to divide the current data bit.
              */
-            if (remainder & topbit)
+            if (remainder & 0x01)
             {
-                remainder = (remainder << 1) ^ polynomial;
+                remainder = (remainder >> 1) ^ polynomial;
             }
             else
             {
-                remainder = (remainder << 1);
+                remainder = (remainder >> 1);
             }
         }
     }
 
+    return remainder;
+}
+
+// cppcheck-suppress unusedFunction
+uint64_t Crc_CalculateCRC64Long(const uint8_t* Crc_DataPtr,
+                              size_t Crc_Length,
+                              uint64_t Crc_StartValue64,
+                              bool Crc_IsFirstCall) {
+    uint64_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = 0xFFFFFFFFFFFFFFFF;
+    } else {
+        // SWS_Crc_00041
+        remainder = (Crc_StartValue64 ^ 0xFFFFFFFFFFFFFFFF);
+    }
+
+    remainder = Crc_UpdateCRC64Register(remainder, Crc_DataPtr, Crc_Length);
+
     /*
      * The final remainder is the CRC result.
      */
-    return reflect(remainder, 64) ^ 0xFFFFFFFFFFFFFFFF;
+    return remainder ^ 0xFFFFFFFFFFFFFFFF;
 }
@@ -18,22 +18,14 @@
  *
  */
 #include "Crc.h"
+#include "CrcRegister.h"
 
-uint8_t Crc_CalculateCRC8(const uint8_t* Crc_DataPtr,
-                          uint32_t Crc_Length,
-                          uint8_t Crc_StartValue8,
-                          bool Crc_IsFirstCall) {
+uint8_t Crc_UpdateCRC8Register(uint8_t Crc_Register,
+                               const uint8_t* Crc_DataPtr,
+                               size_t Crc_Length) {
     const uint8_t topbit = 0x80;
     const uint8_t polynomial = 0x1D;
-    uint8_t remainder = 0;
-
-    if (Crc_IsFirstCall) {
-        // SWS_Crc_00014
-        remainder = 0xFF;
-    } else {
-        // SWS_Crc_00041
-        remainder = (Crc_StartValue8 ^ 0xFF);
-    }
+    uint8_t remainder = Crc_Register;
 
     /*
      * Perform modulo-2 division, a byte at a time.
@@ -64,6 +56,25 @@ uint8_t Crc_CalculateCRC8(const uint8_t* Crc_DataPtr,
         }
     }
 
+    return remainder;
+}
+
+uint8_t Crc_CalculateCRC8Long(const uint8_t* Crc_DataPtr,
+                              size_t Crc_Length,
+                              uint8_t Crc_StartValue8,
+                              bool Crc_IsFirstCall) {
+    uint8_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = 0xFF;
+    } else {
+        // SWS_Crc_00041
+        remainder = (Crc_StartValue8 ^ 0xFF);
+    }
+
+    remainder = Crc_UpdateCRC8Register(remainder, Crc_DataPtr, Crc_Length);
+
     /*
      * The final remainder is the CRC result.
      */
@@ -18,23 +18,14 @@
  *
  */
 #include "Crc.h"
+#include "CrcRegister.h"
 
-// cppcheck-suppress unusedFunction
-uint8_t Crc_CalculateCRC8H2F(const uint8_t* Crc_DataPtr,
-                             uint32_t Crc_Length,
-                             uint8_t Crc_StartValue8H2F,
-                             bool Crc_IsFirstCall) {
+uint8_t Crc_UpdateCRC8H2FRegister(uint8_t Crc_Register,
+                                  const uint8_t* Crc_DataPtr,
+                                  size_t Crc_Length) {
     const uint8_t topbit = 0x80;
     const uint8_t polynomial = 0x2F;
-    uint8_t remainder = 0;
-
-    if (Crc_IsFirstCall) {
-        // SWS_Crc_00014
-        remainder = 0xFF;
-    } else {
-        // SWS_Crc_00041
-        remainder = (Crc_StartValue8H2F ^ 0xFF);
-    }
+    uint8_t remainder = Crc_Register;
 
     /*
      * Perform modulo-2 division, a byte at a time.
@@ -65,6 +56,26 @@ uint8_t Crc_CalculateCRC8H2F(const uint8_t* Crc_DataPtr,
         }
     }
 
+    return remainder;
+}
+
+// cppcheck-suppress unusedFunction
+uint8_t Crc_CalculateCRC8H2FLong(const uint8_t* Crc_DataPtr,
+                                 size_t Crc_Length,
+                                 uint8_t Crc_StartValue8H2F,
+                                 bool Crc_IsFirstCall) {
+    uint8_t remainder = 0;
+
+    if (Crc_IsFirstCall) {
+        // SWS_Crc_00014
+        remainder = 0xFF;
+    } else {
+        // SWS_Crc_00041
+        remainder = (Crc_StartValue8H2F ^ 0xFF);
+    }
+
+    remainder = Crc_UpdateCRC8H2FRegister(remainder, Crc_DataPtr, Crc_Length);
+
     /*
      * The final remainder is the CRC result.
      */
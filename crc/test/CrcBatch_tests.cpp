@@ -0,0 +1,217 @@
+extern "C" {
+    #include "Crc.h"
+}
+
+#include "reference_crc.h"
+
+#include <gtest/gtest.h>
+
+/**
+ * These tests compare each Crc_CalculateCRCxxBatch function against separate
+ * Crc_CalculateCRCxx calls for every message:
+ * - messages of random lengths, in batches of every size up to a few SIMD groups
+ * - continuing every message from a start value, its own CRC, with the results written over the
+ *   start values
+ * - messages of equal length, so that every lane has a complete block
+ * - an empty batch, which must not write any result
+ */
+
+namespace {
+    template <typename T>
+    using CrcFunction = T (*)(const uint8_t*, uint32_t, T, bool);
+
+    template <typename T>
+    using BatchFunction = void (*)(const uint8_t* const[], const uint32_t[], const T[], bool, T[], uint32_t);
+
+    struct Messages {
+        std::vector<uint8_t> data;
+        std::vector<const uint8_t*> pointers;
+        std::vector<uint32_t> lengths;
+    };
+
+    /**
+     * count messages of minLength to maxLength bytes at varying alignments
+     */
+    Messages makeMessages(size_t count, uint32_t minLength, uint32_t maxLength) {
+        Messages messages;
+        const auto lengths = referenceData(count, 0x1234567);
+        size_t offset = 0;
+
+        for (size_t message = 0; message < count; ++message) {
+            messages.lengths.push_back(minLength + lengths[message] % (maxLength - minLength + 1));
+            offset += messages.lengths.back() + message % 7;
+        }
+
+        messages.data = referenceData(offset);
+        offset = 0;
+        for (size_t message = 0; message < count; ++message) {
+            messages.pointers.push_back(messages.data.data() + offset);
+            offset += messages.lengths[message] + message % 7;
+        }
+
+        return messages;
+    }
+
+    template <typename T>
+    void expectBatchMatches(CrcFunction<T> calculate, BatchFunction<T> batch, uint32_t minLength, uint32_t maxLength) {
+        for (size_t count = 1; count <= 40; ++count) {
+            const auto messages = makeMessages(count, minLength, maxLength);
+            std::vector<T> results(count);
+
+            batch(messages.pointers.data(), messages.lengths.data(), nullptr, true, results.data(),
+                  static_cast<uint32_t>(count));
+
+            for (size_t message = 0; message < count; ++message) {
+                ASSERT_EQ(results[message], calculate(messages.pointers[message], messages.lengths[message], 0, true))
+                    << "message " << message << " of " << count;
+            }
+        }
+    }
+
+    template <typename T>
+    void expectRandomLengthsMatch(CrcFunction<T> calculate, BatchFunction<T> batch) {
+        expectBatchMatches(calculate, batch, 0, 100);
+    }
+
+    template <typename T>
+    void expectEqualLengthsMatch(CrcFunction<T> calculate, BatchFunction<T> batch) {
+        expectBatchMatches(calculate, batch, 64, 64);
+    }
+
+    template <typename T>
+    void expectChainedMatches(CrcFunction<T> calculate, BatchFunction<T> batch) {
+        const size_t count = 37;
+        const auto messages = makeMessages(count, 0, 80);
+        std::vector<T> crcs(count);
+        std::vector<T> expected(count);
+
+        for (size_t message = 0; message < count; ++message) {
+            crcs[message] = calculate(messages.pointers[message], messages.lengths[message], 0, true);
+            expected[message] = calculate(messages.pointers[message], messages.lengths[message], crcs[message], false);
+        }
+
+        batch(messages.pointers.data(), messages.lengths.data(), crcs.data(), false, crcs.data(),
+              static_cast<uint32_t>(count));
+        EXPECT_EQ(crcs, expected);
+    }
+
+    template <typename T>
+    void expectEmptyBatchWritesNothing(BatchFunction<T> batch) {
+        T result = 0x5A;
+
+        batch(nullptr, nullptr, nullptr, true, &result, 0);
+        EXPECT_EQ(result, 0x5A);
+    }
+}
+
+TEST(CrcBatchTests, CalculateCRC8Batch_random_lengths) {
+    expectRandomLengthsMatch<uint8_t>(Crc_CalculateCRC8, Crc_CalculateCRC8Batch);
+}
+
+TEST(CrcBatchTests, CalculateCRC8Batch_equal_lengths) {
+    expectEqualLengthsMatch<uint8_t>(Crc_CalculateCRC8, Crc_CalculateCRC8Batch);
+}
+
+TEST(CrcBatchTests, CalculateCRC8Batch_chained) {
+    expectChainedMatches<uint8_t>(Crc_CalculateCRC8, Crc_CalculateCRC8Batch);
+}
+
+TEST(CrcBatchTests, CalculateCRC8Batch_empty_batch) {
+    expectEmptyBatchWritesNothing<uint8_t>(Crc_CalculateCRC8Batch);
+}
+
+TEST(CrcBatchTests, CalculateCRC8H2FBatch_random_lengths) {
+    expectRandomLengthsMatch<uint8_t>(Crc_CalculateCRC8H2F, Crc_CalculateCRC8H2FBatch);
+}
+
+TEST(CrcBatchTests, CalculateCRC8H2FBatch_equal_lengths) {
+    expectEqualLengthsMatch<uint8_t>(Crc_CalculateCRC8H2F, Crc_CalculateCRC8H2FBatch);
+}
+
+TEST(CrcBatchTests, CalculateCRC8H2FBatch_chained) {
+    expectChainedMatches<uint8_t>(Crc_CalculateCRC8H2F, Crc_CalculateCRC8H2FBatch);
+}
+
+TEST(CrcBatchTests, CalculateCRC8H2FBatch_empty_batch) {
+    expectEmptyBatchWritesNothing<uint8_t>(Crc_CalculateCRC8H2FBatch);
+}
+
+TEST(CrcBatchTests, CalculateCRC16Batch_random_lengths) {
+    expectRandomLengthsMatch<uint16_t>(Crc_CalculateCRC16, Crc_CalculateCRC16Batch);
+}
+
+TEST(CrcBatchTests, CalculateCRC16Batch_equal_lengths) {
+    expectEqualLengthsMatch<uint16_t>(Crc_CalculateCRC16, Crc_CalculateCRC16Batch);
+}
+
+TEST(CrcBatchTests, CalculateCRC16Batch_chained) {
+    expectChainedMatches<uint16_t>(Crc_CalculateCRC16, Crc_CalculateCRC16Batch);
+}
+
+TEST(CrcBatchTests, CalculateCRC16Batch_empty_batch) {
+    expectEmptyBatchWritesNothing<uint16_t>(Crc_CalculateCRC16Batch);
+}
+
+TEST(CrcBatchTests, CalculateCRC16ARCBatch_random_lengths) {
+    expectRandomLengthsMatch<uint16_t>(Crc_CalculateCRC16ARC, Crc_CalculateCRC16ARCBatch);
+}
+
+TEST(CrcBatchTests, CalculateCRC16ARCBatch_equal_lengths) {
+    expectEqualLengthsMatch<uint16_t>(Crc_CalculateCRC16ARC, Crc_CalculateCRC16ARCBatch);
+}
+
+TEST(CrcBatchTests, CalculateCRC16ARCBatch_chained) {
+    expectChainedMatches<uint16_t>(Crc_CalculateCRC16ARC, Crc_CalculateCRC16ARCBatch);
+}
+
+TEST(CrcBatchTests, CalculateCRC16ARCBatch_empty_batch) {
+    expectEmptyBatchWritesNothing<uint16_t>(Crc_CalculateCRC16ARCBatch);
+}
+
+TEST(CrcBatchTests, CalculateCRC32Batch_random_lengths) {
+    expectRandomLengthsMatch<uint32_t>(Crc_CalculateCRC32, Crc_CalculateCRC32Batch);
+}
+
+TEST(CrcBatchTests, CalculateCRC32Batch_equal_lengths) {
+    expectEqualLengthsMatch<uint32_t>(Crc_CalculateCRC32, Crc_CalculateCRC32Batch);
+}
+
+TEST(CrcBatchTests, CalculateCRC32Batch_chained) {
+    expectChainedMatches<uint32_t>(Crc_CalculateCRC32, Crc_CalculateCRC32Batch);
+}
+
+TEST(CrcBatchTests, CalculateCRC32Batch_empty_batch) {
+    expectEmptyBatchWritesNothing<uint32_t>(Crc_CalculateCRC32Batch);
+}
+
+TEST(CrcBatchTests, CalculateCRC32P4Batch_random_lengths) {
+    expectRandomLengthsMatch<uint32_t>(Crc_CalculateCRC32P4, Crc_CalculateCRC32P4Batch);
+}
+
+TEST(CrcBatchTests, CalculateCRC32P4Batch_equal_lengths) {
+    expectEqualLengthsMatch<uint32_t>(Crc_CalculateCRC32P4, Crc_CalculateCRC32P4Batch);
+}
+
+TEST(CrcBatchTests, CalculateCRC32P4Batch_chained) {
+    expectChainedMatches<uint32_t>(Crc_CalculateCRC32P4, Crc_CalculateCRC32P4Batch);
+}
+
+TEST(CrcBatchTests, CalculateCRC32P4Batch_empty_batch) {
+    expectEmptyBatchWritesNothing<uint32_t>(Crc_CalculateCRC32P4Batch);
+}
+
+TEST(CrcBatchTests, CalculateCRC64Batch_random_lengths) {
+    expectRandomLengthsMatch<uint64_t>(Crc_CalculateCRC64, Crc_CalculateCRC64Batch);
+}
+
+TEST(CrcBatchTests, CalculateCRC64Batch_equal_lengths) {
+    expectEqualLengthsMatch<uint64_t>(Crc_CalculateCRC64, Crc_CalculateCRC64Batch);
+}
+
+TEST(CrcBatchTests, CalculateCRC64Batch_chained) {
+    expectChainedMatches<uint64_t>(Crc_CalculateCRC64, Crc_CalculateCRC64Batch);
+}
+
+TEST(CrcBatchTests, CalculateCRC64Batch_empty_batch) {
+    expectEmptyBatchWritesNothing<uint64_t>(Crc_CalculateCRC64Batch);
+}
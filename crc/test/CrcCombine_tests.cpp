@@ -0,0 +1,201 @@
+extern "C" {
+    #include "Crc.h"
+}
+
+#include "reference_crc.h"
+
+#include <gtest/gtest.h>
+
+/**
+ * These tests check each Crc_CombineCRCxx function by splitting a message in two, calculating
+ * the CRC of each part with Crc_CalculateCRCxx and comparing the combined CRC against the
+ * bit-by-bit model in reference_crc.h for the whole message:
+ * - a short message split at every position, including empty first and second parts
+ * - a message of more than 64 KiB split at a few positions, so that every bit of the length
+ *   up to 2^16 is used
+ *
+ * Each Crc_AppendZerosCRCxx function is checked against the bit-by-bit model for a message
+ * followed by every run of 0 to 300 zero bytes, and by a run of more than 1 MiB.
+ */
+
+namespace {
+    template <typename T>
+    using CrcFunction = T (*)(const uint8_t*, uint32_t, T, bool);
+
+    template <typename T>
+    using CombineFunction = T (*)(T, T, size_t);
+
+    template <typename T>
+    void expectCombinedMatches(CrcFunction<T> calculate,
+                               CombineFunction<T> combine,
+                               const CrcModel& model,
+                               const std::vector<uint8_t>& data,
+                               size_t split) {
+        const T expected = static_cast<T>(referenceCrc(model, data.data(), data.size()));
+        const size_t length2 = data.size() - split;
+
+        const T crc1 = calculate(data.data(), static_cast<uint32_t>(split), 0, true);
+        const T crc2 = calculate(&data[split], static_cast<uint32_t>(length2), 0, true);
+        ASSERT_EQ(combine(crc1, crc2, length2), expected) << "split at " << split;
+    }
+
+    template <typename T>
+    void expectEverySplitMatches(CrcFunction<T> calculate, CombineFunction<T> combine, const CrcModel& model) {
+        const auto data = referenceData(130);
+
+        for (size_t split = 0; split <= data.size(); ++split) {
+            expectCombinedMatches(calculate, combine, model, data, split);
+        }
+    }
+
+    template <typename T>
+    void expectLongSecondPartMatches(CrcFunction<T> calculate, CombineFunction<T> combine, const CrcModel& model) {
+        const auto data = referenceData(65536 + 1000);
+
+        for (const size_t split : {0, 1, 999, 1000}) {
+            expectCombinedMatches(calculate, combine, model, data, split);
+        }
+    }
+
+    template <typename T>
+    using AppendZerosFunction = T (*)(T, size_t);
+
+    template <typename T>
+    void expectAppendedZerosMatch(CrcFunction<T> calculate,
+                                  AppendZerosFunction<T> appendZeros,
+                                  const CrcModel& model,
+                                  size_t messageLength,
+                                  size_t zeroLength) {
+        std::vector<uint8_t> data = referenceData(messageLength);
+        data.resize(messageLength + zeroLength, 0);
+        const T expected = static_cast<T>(referenceCrc(model, data.data(), data.size()));
+
+        const T crc = calculate(data.data(), static_cast<uint32_t>(messageLength), 0, true);
+        ASSERT_EQ(appendZeros(crc, zeroLength), expected) << messageLength << " + " << zeroLength << " zeros";
+    }
+
+    template <typename T>
+    void expectShortZeroRunsMatch(CrcFunction<T> calculate, AppendZerosFunction<T> appendZeros, const CrcModel& model) {
+        for (size_t zeroLength = 0; zeroLength <= 300; ++zeroLength) {
+            expectAppendedZerosMatch(calculate, appendZeros, model, 0, zeroLength);
+            expectAppendedZerosMatch(calculate, appendZeros, model, 21, zeroLength);
+        }
+    }
+
+    template <typename T>
+    void expectLongZeroRunMatches(CrcFunction<T> calculate, AppendZerosFunction<T> appendZeros, const CrcModel& model) {
+        expectAppendedZerosMatch(calculate, appendZeros, model, 100, 1048576 + 12345);
+    }
+}
+
+TEST(CrcCombineTests, CombineCRC8_every_split) {
+    expectEverySplitMatches<uint8_t>(Crc_CalculateCRC8, Crc_CombineCRC8, crc8Model);
+}
+
+TEST(CrcCombineTests, CombineCRC8_long_second_part) {
+    expectLongSecondPartMatches<uint8_t>(Crc_CalculateCRC8, Crc_CombineCRC8, crc8Model);
+}
+
+TEST(CrcCombineTests, CombineCRC8H2F_every_split) {
+    expectEverySplitMatches<uint8_t>(Crc_CalculateCRC8H2F, Crc_CombineCRC8H2F, crc8H2FModel);
+}
+
+TEST(CrcCombineTests, CombineCRC8H2F_long_second_part) {
+    expectLongSecondPartMatches<uint8_t>(Crc_CalculateCRC8H2F, Crc_CombineCRC8H2F, crc8H2FModel);
+}
+
+TEST(CrcCombineTests, CombineCRC16_every_split) {
+    expectEverySplitMatches<uint16_t>(Crc_CalculateCRC16, Crc_CombineCRC16, crc16Model);
+}
+
+TEST(CrcCombineTests, CombineCRC16_long_second_part) {
+    expectLongSecondPartMatches<uint16_t>(Crc_CalculateCRC16, Crc_CombineCRC16, crc16Model);
+}
+
+TEST(CrcCombineTests, CombineCRC16ARC_every_split) {
+    expectEverySplitMatches<uint16_t>(Crc_CalculateCRC16ARC, Crc_CombineCRC16ARC, crc16ARCModel);
+}
+
+TEST(CrcCombineTests, CombineCRC16ARC_long_second_part) {
+    expectLongSecondPartMatches<uint16_t>(Crc_CalculateCRC16ARC, Crc_CombineCRC16ARC, crc16ARCModel);
+}
+
+TEST(CrcCombineTests, CombineCRC32_every_split) {
+    expectEverySplitMatches<uint32_t>(Crc_CalculateCRC32, Crc_CombineCRC32, crc32Model);
+}
+
+TEST(CrcCombineTests, CombineCRC32_long_second_part) {
+    expectLongSecondPartMatches<uint32_t>(Crc_CalculateCRC32, Crc_CombineCRC32, crc32Model);
+}
+
+TEST(CrcCombineTests, CombineCRC32P4_every_split) {
+    expectEverySplitMatches<uint32_t>(Crc_CalculateCRC32P4, Crc_CombineCRC32P4, crc32P4Model);
+}
+
+TEST(CrcCombineTests, CombineCRC32P4_long_second_part) {
+    expectLongSecondPartMatches<uint32_t>(Crc_CalculateCRC32P4, Crc_CombineCRC32P4, crc32P4Model);
+}
+
+TEST(CrcCombineTests, CombineCRC64_every_split) {
+    expectEverySplitMatches<uint64_t>(Crc_CalculateCRC64, Crc_CombineCRC64, crc64Model);
+}
+
+TEST(CrcCombineTests, CombineCRC64_long_second_part) {
+    expectLongSecondPartMatches<uint64_t>(Crc_CalculateCRC64, Crc_CombineCRC64, crc64Model);
+}
+
+TEST(CrcCombineTests, AppendZerosCRC8_short_zero_runs) {
+    expectShortZeroRunsMatch<uint8_t>(Crc_CalculateCRC8, Crc_AppendZerosCRC8, crc8Model);
+}
+
+TEST(CrcCombineTests, AppendZerosCRC8_long_zero_run) {
+    expectLongZeroRunMatches<uint8_t>(Crc_CalculateCRC8, Crc_AppendZerosCRC8, crc8Model);
+}
+
+TEST(CrcCombineTests, AppendZerosCRC8H2F_short_zero_runs) {
+    expectShortZeroRunsMatch<uint8_t>(Crc_CalculateCRC8H2F, Crc_AppendZerosCRC8H2F, crc8H2FModel);
+}
+
+TEST(CrcCombineTests, AppendZerosCRC8H2F_long_zero_run) {
+    expectLongZeroRunMatches<uint8_t>(Crc_CalculateCRC8H2F, Crc_AppendZerosCRC8H2F, crc8H2FModel);
+}
+
+TEST(CrcCombineTests, AppendZerosCRC16_short_zero_runs) {
+    expectShortZeroRunsMatch<uint16_t>(Crc_CalculateCRC16, Crc_AppendZerosCRC16, crc16Model);
+}
+
+TEST(CrcCombineTests, AppendZerosCRC16_long_zero_run) {
+    expectLongZeroRunMatches<uint16_t>(Crc_CalculateCRC16, Crc_AppendZerosCRC16, crc16Model);
+}
+
+TEST(CrcCombineTests, AppendZerosCRC16ARC_short_zero_runs) {
+    expectShortZeroRunsMatch<uint16_t>(Crc_CalculateCRC16ARC, Crc_AppendZerosCRC16ARC, crc16ARCModel);
+}
+
+TEST(CrcCombineTests, AppendZerosCRC16ARC_long_zero_run) {
+    expectLongZeroRunMatches<uint16_t>(Crc_CalculateCRC16ARC, Crc_AppendZerosCRC16ARC, crc16ARCModel);
+}
+
+TEST(CrcCombineTests, AppendZerosCRC32_short_zero_runs) {
+    expectShortZeroRunsMatch<uint32_t>(Crc_CalculateCRC32, Crc_AppendZerosCRC32, crc32Model);
+}
+
+TEST(CrcCombineTests, AppendZerosCRC32_long_zero_run) {
+    expectLongZeroRunMatches<uint32_t>(Crc_CalculateCRC32, Crc_AppendZerosCRC32, crc32Model);
+}
+
+TEST(CrcCombineTests, AppendZerosCRC32P4_short_zero_runs) {
+    expectShortZeroRunsMatch<uint32_t>(Crc_CalculateCRC32P4, Crc_AppendZerosCRC32P4, crc32P4Model);
+}
+
+TEST(CrcCombineTests, AppendZerosCRC32P4_long_zero_run) {
+    expectLongZeroRunMatches<uint32_t>(Crc_CalculateCRC32P4, Crc_AppendZerosCRC32P4, crc32P4Model);
+}
+
+TEST(CrcCombineTests, AppendZerosCRC64_short_zero_runs) {
+    expectShortZeroRunsMatch<uint64_t>(Crc_CalculateCRC64, Crc_AppendZerosCRC64, crc64Model);
+}
+
+TEST(CrcCombineTests, AppendZerosCRC64_long_zero_run) {
+    expectLongZeroRunMatches<uint64_t>(Crc_CalculateCRC64, Crc_AppendZerosCRC64, crc64Model);
+}
@@ -0,0 +1,119 @@
+extern "C" {
+    #include "Crc.h"
+}
+
+#include "CrcEngine.hpp"
+#include "reference_crc.h"
+
+#include <gtest/gtest.h>
+
+/**
+ * These tests cover the compile-time engine in CrcEngine.hpp:
+ * - the check value of every algorithm in Crc.h and of two CRCs with a width below the width of
+ *   their type, evaluated by the compiler
+ * - the DataID contribution of E2E Profile 5 evaluated by the compiler, which must match
+ *   Crc_CalculateCRC16 at runtime
+ * - every algorithm in Crc.h against reference_crc.h at runtime, as single and chained calls
+ * - chained calls of a CRC whose input and output reflection differ
+ *
+ * The Crc_CalculateCRCxx functions instantiated from the engine are tested with the other CRC
+ * libraries as crc_engine.
+ */
+
+namespace {
+    constexpr uint8_t checkData[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+    // CRC-12/UMTS: input data not reflected, result reflected
+    using Crc12UmtsEngine = crc::Engine<uint16_t, 12, 0x80F, 0x000, false, true, 0x000>;
+
+    // CRC-15/CAN
+    using Crc15CanEngine = crc::Engine<uint16_t, 15, 0x4599, 0x0000, false, false, 0x0000>;
+
+    static_assert(crc::Crc8Engine::calculate(checkData, sizeof(checkData), 0, true) == 0x4B, "CRC8 check");
+    static_assert(crc::Crc8H2FEngine::calculate(checkData, sizeof(checkData), 0, true) == 0xDF, "CRC8H2F check");
+    static_assert(crc::Crc16Engine::calculate(checkData, sizeof(checkData), 0, true) == 0x29B1, "CRC16 check");
+    static_assert(crc::Crc16ARCEngine::calculate(checkData, sizeof(checkData), 0, true) == 0xBB3D, "CRC16ARC check");
+    static_assert(crc::Crc32Engine::calculate(checkData, sizeof(checkData), 0, true) == 0xCBF43926, "CRC32 check");
+    static_assert(crc::Crc32P4Engine::calculate(checkData, sizeof(checkData), 0, true) == 0x1697D06A,
+                  "CRC32P4 check");
+    static_assert(crc::Crc64Engine::calculate(checkData, sizeof(checkData), 0, true) == 0x995DC9BBDF1939FA,
+                  "CRC64 check");
+    static_assert(Crc12UmtsEngine::calculate(checkData, sizeof(checkData), 0, true) == 0xDAF, "CRC-12/UMTS check");
+    static_assert(Crc15CanEngine::calculate(checkData, sizeof(checkData), 0, true) == 0x059E, "CRC-15/CAN check");
+
+    /*
+     * E2E Profile 5 appends the DataID, low byte first, to the CRC of the data
+     */
+    constexpr uint16_t dataID = 0x1234;
+    constexpr uint8_t dataIDBytes[] = {dataID & 0xFF, (dataID >> 8) & 0xFF};
+
+    constexpr uint16_t dataIDContribution(uint16_t dataCrc) {
+        return crc::Crc16Engine::calculate(dataIDBytes, sizeof(dataIDBytes), dataCrc, false);
+    }
+
+    constexpr uint16_t checkDataCrc16 = 0x29B1;
+    constexpr uint16_t checkDataWithDataIDCrc16 = dataIDContribution(checkDataCrc16);
+
+    template <typename Engine>
+    void expectEngineMatches(const CrcModel& model) {
+        using T = typename Engine::ValueType;
+        const auto data = referenceData(300);
+
+        for (size_t length = 0; length <= data.size(); ++length) {
+            const T expected = static_cast<T>(referenceCrc(model, data.data(), length));
+            const size_t split = length / 3;
+
+            ASSERT_EQ(Engine::calculate(data.data(), length, 0, true), expected) << "length " << length;
+
+            const T first = Engine::calculate(data.data(), split, 0, true);
+            ASSERT_EQ(Engine::calculate(&data[split], length - split, first, false), expected)
+                << "length " << length << " split at " << split;
+        }
+    }
+}
+
+TEST(CrcEngineTests, DataIDContribution_compile_time) {
+    const uint8_t runtimeDataIDBytes[] = {dataID & 0xFF, (dataID >> 8) & 0xFF};
+
+    ASSERT_EQ(Crc_CalculateCRC16(checkData, sizeof(checkData), 0, true), checkDataCrc16);
+    EXPECT_EQ(checkDataWithDataIDCrc16, Crc_CalculateCRC16(runtimeDataIDBytes, 2, checkDataCrc16, false));
+}
+
+TEST(CrcEngineTests, CRC8_reference) {
+    expectEngineMatches<crc::Crc8Engine>(crc8Model);
+}
+
+TEST(CrcEngineTests, CRC8H2F_reference) {
+    expectEngineMatches<crc::Crc8H2FEngine>(crc8H2FModel);
+}
+
+TEST(CrcEngineTests, CRC16_reference) {
+    expectEngineMatches<crc::Crc16Engine>(crc16Model);
+}
+
+TEST(CrcEngineTests, CRC16ARC_reference) {
+    expectEngineMatches<crc::Crc16ARCEngine>(crc16ARCModel);
+}
+
+TEST(CrcEngineTests, CRC32_reference) {
+    expectEngineMatches<crc::Crc32Engine>(crc32Model);
+}
+
+TEST(CrcEngineTests, CRC32P4_reference) {
+    expectEngineMatches<crc::Crc32P4Engine>(crc32P4Model);
+}
+
+TEST(CrcEngineTests, CRC64_reference) {
+    expectEngineMatches<crc::Crc64Engine>(crc64Model);
+}
+
+TEST(CrcEngineTests, CRC12UMTS_chained) {
+    const auto data = referenceData(100);
+    const uint16_t expected = Crc12UmtsEngine::calculate(data.data(), data.size(), 0, true);
+
+    for (size_t split = 0; split <= data.size(); ++split) {
+        const uint16_t first = Crc12UmtsEngine::calculate(data.data(), split, 0, true);
+        ASSERT_EQ(Crc12UmtsEngine::calculate(&data[split], data.size() - split, first, false), expected)
+            << "split at " << split;
+    }
+}
@@ -0,0 +1,187 @@
+extern "C" {
+    #include "Crc.h"
+    #include "Crc_Generic.h"
+}
+
+#include "reference_crc.h"
+
+#include <gtest/gtest.h>
+
+/**
+ * These tests cover the descriptors of crc_generic with CRCs from the catalogue of parametrised
+ * CRC algorithms, including widths that are not a multiple of 8, CRCs whose input and output
+ * reflection differ and a normal 64-bit CRC:
+ * - the check value of every CRC
+ * - every length up to beyond the 512-byte wide folding threshold at two alignments, as single
+ *   and chained calls, against a bit-by-bit model of the parameters
+ * - updating the CRC register of a message in parts
+ * - the Crc_CalculateCRCxx functions over descriptors in global initializers, which run before
+ *   any constructor of crc_generic
+ * - rejecting invalid parameters
+ *
+ * The Crc_CalculateCRCxx functions over descriptors are tested with the other CRC libraries as
+ * crc_generic.
+ */
+
+namespace {
+    struct CatalogueEntry {
+        const char* name;
+        Crc_ParametersType parameters;
+        uint64_t check;
+    };
+
+    const CatalogueEntry catalogue[] = {
+        {"CRC-3/ROHC", {3, 0x3, 0x7, true, true, 0x0}, 0x6},
+        {"CRC-5/USB", {5, 0x05, 0x1F, true, true, 0x1F}, 0x19},
+        {"CRC-8/AUTOSAR", {8, 0x2F, 0xFF, false, false, 0xFF}, 0xDF},
+        {"CRC-8/MAXIM-DOW", {8, 0x31, 0x00, true, true, 0x00}, 0xA1},
+        {"CRC-12/UMTS", {12, 0x80F, 0x000, false, true, 0x000}, 0xDAF},
+        {"CRC-15/CAN", {15, 0x4599, 0x0000, false, false, 0x0000}, 0x059E},
+        {"CRC-16/MODBUS", {16, 0x8005, 0xFFFF, true, true, 0x0000}, 0x4B37},
+        {"CRC-16/IBM-3740", {16, 0x1021, 0xFFFF, false, false, 0x0000}, 0x29B1},
+        {"CRC-16/RIELLO", {16, 0x1021, 0xB2AA, true, true, 0x0000}, 0x63D0},
+        {"CRC-24/OPENPGP", {24, 0x864CFB, 0xB704CE, false, false, 0x000000}, 0x21CF02},
+        {"CRC-32/ISCSI", {32, 0x1EDC6F41, 0xFFFFFFFF, true, true, 0xFFFFFFFF}, 0xE3069283},
+        {"CRC-32/BZIP2", {32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0xFFFFFFFF}, 0xFC891918},
+        {"CRC-40/GSM", {40, 0x0004820009, 0x0000000000, false, false, 0xFFFFFFFFFF}, 0xD4164FC646},
+        {"CRC-64/WE", {64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, false, false, 0xFFFFFFFFFFFFFFFF},
+         0x62EC59E3F1A4F00A},
+        {"CRC-64/XZ", {64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, true, true, 0xFFFFFFFFFFFFFFFF},
+         0x995DC9BBDF1939FA},
+    };
+
+    /**
+     * Bit-by-bit model of the Rocksoft parameters, most significant bit first
+     */
+    uint64_t modelCrc(const Crc_ParametersType& parameters, const uint8_t* data, size_t length) {
+        const unsigned width = parameters.Width;
+        const uint64_t mask = (width < 64) ? ((1ULL << width) - 1) : ~0ULL;
+        uint64_t remainder = parameters.Initial;
+
+        for (size_t byte = 0; byte < length; ++byte) {
+            const uint64_t value = parameters.ReflectIn ? referenceReflect(data[byte], 8) : data[byte];
+
+            for (int bit = 7; bit >= 0; --bit) {
+                const bool top = (((remainder >> (width - 1)) ^ (value >> bit)) & 1) != 0;
+                remainder = (remainder << 1) & mask;
+                if (top) {
+                    remainder ^= parameters.Polynomial;
+                }
+            }
+        }
+
+        if (parameters.ReflectOut) {
+            remainder = referenceReflect(remainder, width);
+        }
+        return remainder ^ parameters.XorValue;
+    }
+
+    Crc_DescriptorType descriptor;
+
+    const uint8_t checkData[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+    /*
+     * Dynamic initialization of this file runs before the constructors of the crc_generic
+     * library, which is linked after it.
+     */
+    const uint8_t globalCrc8 = Crc_CalculateCRC8(checkData, sizeof(checkData), 0, true);
+    const uint8_t globalCrc8H2F = Crc_CalculateCRC8H2F(checkData, sizeof(checkData), 0, true);
+    const uint16_t globalCrc16 = Crc_CalculateCRC16(checkData, sizeof(checkData), 0, true);
+    const uint16_t globalCrc16ARC = Crc_CalculateCRC16ARC(checkData, sizeof(checkData), 0, true);
+    const uint32_t globalCrc32 = Crc_CalculateCRC32(checkData, sizeof(checkData), 0, true);
+    const uint32_t globalCrc32P4 = Crc_CalculateCRC32P4(checkData, sizeof(checkData), 0, true);
+    const uint64_t globalCrc64 = Crc_CalculateCRC64(checkData, sizeof(checkData), 0, true);
+}
+
+TEST(CrcGenericTests, CalculateCRC_global_initializers) {
+    EXPECT_EQ(globalCrc8, 0x4B);
+    EXPECT_EQ(globalCrc8H2F, 0xDF);
+    EXPECT_EQ(globalCrc16, 0x29B1);
+    EXPECT_EQ(globalCrc16ARC, 0xBB3D);
+    EXPECT_EQ(globalCrc32, 0xCBF43926);
+    EXPECT_EQ(globalCrc32P4, 0x1697D06A);
+    EXPECT_EQ(globalCrc64, 0x995DC9BBDF1939FAULL);
+}
+
+TEST(CrcGenericTests, InitDescriptor_check_values) {
+    for (const auto& entry : catalogue) {
+        ASSERT_EQ(Crc_InitDescriptor(&descriptor, &entry.parameters), E_OK) << entry.name;
+        EXPECT_EQ(Crc_CalculateGeneric(&descriptor, checkData, sizeof(checkData), 0, true), entry.check) << entry.name;
+        EXPECT_EQ(modelCrc(entry.parameters, checkData, sizeof(checkData)), entry.check) << entry.name;
+    }
+}
+
+TEST(CrcGenericTests, CalculateGeneric_reference) {
+    const auto data = referenceData(700);
+
+    for (const auto& entry : catalogue) {
+        ASSERT_EQ(Crc_InitDescriptor(&descriptor, &entry.parameters), E_OK) << entry.name;
+
+        for (size_t offset = 0; offset <= 1; ++offset) {
+            for (size_t length = 0; length <= data.size() - offset; ++length) {
+                const uint8_t* message = &data[offset];
+                const uint64_t expected = modelCrc(entry.parameters, message, length);
+                const size_t split = length / 3;
+
+                ASSERT_EQ(Crc_CalculateGeneric(&descriptor, message, static_cast<uint32_t>(length), 0, true),
+                          expected) << entry.name << " length " << length << " offset " << offset;
+
+                const uint64_t first = Crc_CalculateGeneric(&descriptor, message, static_cast<uint32_t>(split), 0, true);
+                ASSERT_EQ(Crc_CalculateGeneric(&descriptor, &message[split], static_cast<uint32_t>(length - split),
+                                               first, false),
+                          expected) << entry.name << " length " << length << " split at " << split;
+            }
+        }
+    }
+}
+
+TEST(CrcGenericTests, CalculateGeneric_long_message) {
+    const auto data = referenceData(5000);
+
+    for (const auto& entry : catalogue) {
+        ASSERT_EQ(Crc_InitDescriptor(&descriptor, &entry.parameters), E_OK) << entry.name;
+        EXPECT_EQ(Crc_CalculateGeneric(&descriptor, data.data(), static_cast<uint32_t>(data.size()), 0, true),
+                  modelCrc(entry.parameters, data.data(), data.size())) << entry.name;
+    }
+}
+
+TEST(CrcGenericTests, UpdateGeneric_parts) {
+    const auto data = referenceData(700);
+    const size_t splits[] = {0, 1, 15, 16, 17, 255, 256, 512};
+
+    for (const auto& entry : catalogue) {
+        const Crc_ParametersType& parameters = entry.parameters;
+        const uint64_t initial = parameters.ReflectOut ? referenceReflect(parameters.Initial, parameters.Width)
+                                                       : parameters.Initial;
+        const uint64_t expected = modelCrc(parameters, data.data(), data.size());
+
+        ASSERT_EQ(Crc_InitDescriptor(&descriptor, &parameters), E_OK) << entry.name;
+
+        for (const size_t split : splits) {
+            uint64_t crcRegister = Crc_UpdateGeneric(&descriptor, initial, data.data(), split);
+            crcRegister = Crc_UpdateGeneric(&descriptor, crcRegister, &data[split], (data.size() - split) / 2);
+            crcRegister = Crc_UpdateGeneric(&descriptor, crcRegister, &data[split + ((data.size() - split) / 2)],
+                                            data.size() - split - ((data.size() - split) / 2));
+
+            EXPECT_EQ(crcRegister ^ parameters.XorValue, expected) << entry.name << " split at " << split;
+        }
+    }
+}
+
+TEST(CrcGenericTests, InitDescriptor_invalid_parameters) {
+    const Crc_ParametersType valid = {16, 0x1021, 0xFFFF, false, false, 0x0000};
+    const Crc_ParametersType invalid[] = {
+        {0, 0x0, 0x0, false, false, 0x0},
+        {65, 0x1021, 0xFFFF, false, false, 0x0000},
+        {16, 0x11021, 0xFFFF, false, false, 0x0000},
+        {16, 0x1021, 0x1FFFF, false, false, 0x0000},
+        {16, 0x1021, 0xFFFF, false, false, 0x10000},
+    };
+
+    EXPECT_EQ(Crc_InitDescriptor(nullptr, &valid), E_NOT_OK);
+    EXPECT_EQ(Crc_InitDescriptor(&descriptor, nullptr), E_NOT_OK);
+
+    for (const auto& parameters : invalid) {
+        EXPECT_EQ(Crc_InitDescriptor(&descriptor, &parameters), E_NOT_OK) << "width " << +parameters.Width;
+    }
+}
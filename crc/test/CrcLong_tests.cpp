@@ -0,0 +1,121 @@
+extern "C" {
+    #include "Crc.h"
+}
+
+#include "reference_crc.h"
+
+#include <gtest/gtest.h>
+
+/**
+ * These tests check each Crc_CalculateCRCxxLong function and its Crc_CalculateCRCxx wrapper
+ * against the bit-by-bit model in reference_crc.h:
+ * - every length up to beyond the wide folding threshold at two alignments, where the Long
+ *   function and the wrapper must return the same CRC
+ * - chained Long calls, which must continue a sequence started with the wrapper and vice versa
+ */
+
+namespace {
+    template <typename T>
+    struct LongFunctions {
+        T (*calculate)(const uint8_t*, uint32_t, T, bool);
+        T (*calculateLong)(const uint8_t*, size_t, T, bool);
+    };
+
+    template <typename T>
+    void expectLongMatches(const LongFunctions<T>& functions, const CrcModel& model) {
+        const auto data = referenceData(700);
+
+        for (size_t offset = 0; offset <= 1; ++offset) {
+            for (size_t length = 0; length <= data.size() - offset; ++length) {
+                const uint8_t* message = &data[offset];
+                const T expected = static_cast<T>(referenceCrc(model, message, length));
+
+                ASSERT_EQ(functions.calculateLong(message, length, 0, true), expected)
+                    << "length " << length << " offset " << offset;
+                ASSERT_EQ(functions.calculate(message, static_cast<uint32_t>(length), 0, true), expected)
+                    << "length " << length << " offset " << offset;
+            }
+        }
+    }
+
+    template <typename T>
+    void expectChainedMatches(const LongFunctions<T>& functions, const CrcModel& model) {
+        const auto data = referenceData(1000);
+        const T expected = static_cast<T>(referenceCrc(model, data.data(), data.size()));
+
+        for (size_t split = 0; split <= data.size(); split += 37) {
+            const uint32_t splitLength = static_cast<uint32_t>(split);
+            const uint32_t restLength = static_cast<uint32_t>(data.size() - split);
+
+            const T first = functions.calculate(data.data(), splitLength, 0, true);
+            ASSERT_EQ(functions.calculateLong(&data[split], restLength, first, false), expected) << "split at " << split;
+
+            const T firstLong = functions.calculateLong(data.data(), splitLength, 0, true);
+            ASSERT_EQ(functions.calculate(&data[split], restLength, firstLong, false), expected) << "split at " << split;
+        }
+    }
+
+    const LongFunctions<uint8_t> crc8Functions{Crc_CalculateCRC8, Crc_CalculateCRC8Long};
+    const LongFunctions<uint8_t> crc8H2FFunctions{Crc_CalculateCRC8H2F, Crc_CalculateCRC8H2FLong};
+    const LongFunctions<uint16_t> crc16Functions{Crc_CalculateCRC16, Crc_CalculateCRC16Long};
+    const LongFunctions<uint16_t> crc16ARCFunctions{Crc_CalculateCRC16ARC, Crc_CalculateCRC16ARCLong};
+    const LongFunctions<uint32_t> crc32Functions{Crc_CalculateCRC32, Crc_CalculateCRC32Long};
+    const LongFunctions<uint32_t> crc32P4Functions{Crc_CalculateCRC32P4, Crc_CalculateCRC32P4Long};
+    const LongFunctions<uint64_t> crc64Functions{Crc_CalculateCRC64, Crc_CalculateCRC64Long};
+}
+
+TEST(CrcLongTests, CalculateCRC8Long_reference) {
+    expectLongMatches(crc8Functions, crc8Model);
+}
+
+TEST(CrcLongTests, CalculateCRC8Long_chained) {
+    expectChainedMatches(crc8Functions, crc8Model);
+}
+
+TEST(CrcLongTests, CalculateCRC8H2FLong_reference) {
+    expectLongMatches(crc8H2FFunctions, crc8H2FModel);
+}
+
+TEST(CrcLongTests, CalculateCRC8H2FLong_chained) {
+    expectChainedMatches(crc8H2FFunctions, crc8H2FModel);
+}
+
+TEST(CrcLongTests, CalculateCRC16Long_reference) {
+    expectLongMatches(crc16Functions, crc16Model);
+}
+
+TEST(CrcLongTests, CalculateCRC16Long_chained) {
+    expectChainedMatches(crc16Functions, crc16Model);
+}
+
+TEST(CrcLongTests, CalculateCRC16ARCLong_reference) {
+    expectLongMatches(crc16ARCFunctions, crc16ARCModel);
+}
+
+TEST(CrcLongTests, CalculateCRC16ARCLong_chained) {
+    expectChainedMatches(crc16ARCFunctions, crc16ARCModel);
+}
+
+TEST(CrcLongTests, CalculateCRC32Long_reference) {
+    expectLongMatches(crc32Functions, crc32Model);
+}
+
+TEST(CrcLongTests, CalculateCRC32Long_chained) {
+    expectChainedMatches(crc32Functions, crc32Model);
+}
+
+TEST(CrcLongTests, CalculateCRC32P4Long_reference) {
+    expectLongMatches(crc32P4Functions, crc32P4Model);
+}
+
+TEST(CrcLongTests, CalculateCRC32P4Long_chained) {
+    expectChainedMatches(crc32P4Functions, crc32P4Model);
+}
+
+TEST(CrcLongTests, CalculateCRC64Long_reference) {
+    expectLongMatches(crc64Functions, crc64Model);
+}
+
+TEST(CrcLongTests, CalculateCRC64Long_chained) {
+    expectChainedMatches(crc64Functions, crc64Model);
+}
@@ -0,0 +1,188 @@
+extern "C" {
+    #include "Crc.h"
+    #include "Crc_Parallel.h"
+}
+
+#include "reference_crc.h"
+
+#include <gtest/gtest.h>
+
+/**
+ * These tests compare each Crc_CalculateCRCxxParallel function against a single
+ * Crc_CalculateCRCxx call over the same message:
+ * - with threads started for the call
+ * - with a caller provided pool that runs the tasks in reverse order on the calling thread
+ * - continuing from a start value, which only applies to the first chunk
+ * - with messages too short to be split, including an empty message
+ */
+
+namespace {
+    template <typename T>
+    using CrcFunction = T (*)(const uint8_t*, uint32_t, T, bool);
+
+    template <typename T>
+    using ParallelFunction = T (*)(const uint8_t*, size_t, T, bool, const Crc_ParallelPoolType*);
+
+    /**
+     * Runs the tasks one after another, last task first, and counts them
+     */
+    void runReversed(void* pool, Crc_ParallelTaskType task, void* argument, size_t count) {
+        *static_cast<size_t*>(pool) = count;
+        for (size_t index = count; index > 0; --index) {
+            task(argument, index - 1);
+        }
+    }
+
+    template <typename T>
+    void expectThreadsMatch(CrcFunction<T> calculate, ParallelFunction<T> parallel) {
+        const auto data = referenceData(10000 + 13);
+        const Crc_ParallelPoolType pool = {nullptr, nullptr, 4, 1000};
+
+        const T expected = calculate(data.data(), static_cast<uint32_t>(data.size()), 0, true);
+        EXPECT_EQ(parallel(data.data(), data.size(), 0, true, &pool), expected);
+    }
+
+    template <typename T>
+    void expectCallerPoolMatches(CrcFunction<T> calculate, ParallelFunction<T> parallel) {
+        const auto data = referenceData(1000 + 7);
+        size_t taskCount = 0;
+        const Crc_ParallelPoolType pool = {runReversed, &taskCount, 5, 100};
+
+        for (const size_t length : {size_t{200}, size_t{333}, data.size()}) {
+            const T expected = calculate(data.data(), static_cast<uint32_t>(length), 0, true);
+            EXPECT_EQ(parallel(data.data(), length, 0, true, &pool), expected) << "length " << length;
+            EXPECT_GE(taskCount, 2U) << "length " << length;
+        }
+    }
+
+    template <typename T>
+    void expectChainedMatches(CrcFunction<T> calculate, ParallelFunction<T> parallel) {
+        const auto data = referenceData(300);
+        const Crc_ParallelPoolType pool = {nullptr, nullptr, 3, 50};
+
+        const T first = calculate(data.data(), 100, 0, true);
+        const T expected = calculate(&data[100], 200, first, false);
+        EXPECT_EQ(parallel(&data[100], 200, first, false, &pool), expected);
+    }
+
+    template <typename T>
+    void expectShortMessageMatches(CrcFunction<T> calculate, ParallelFunction<T> parallel) {
+        const auto data = referenceData(64);
+        const Crc_ParallelPoolType pool = {nullptr, nullptr, 8, 100};
+
+        EXPECT_EQ(parallel(data.data(), 0, 0, true, &pool), calculate(data.data(), 0, 0, true));
+        EXPECT_EQ(parallel(data.data(), data.size(), 0, true, &pool), calculate(data.data(), 64, 0, true));
+    }
+}
+
+TEST(CrcParallelTests, CalculateCRC8Parallel_threads) {
+    expectThreadsMatch<uint8_t>(Crc_CalculateCRC8, Crc_CalculateCRC8Parallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC8Parallel_caller_pool) {
+    expectCallerPoolMatches<uint8_t>(Crc_CalculateCRC8, Crc_CalculateCRC8Parallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC8Parallel_chained) {
+    expectChainedMatches<uint8_t>(Crc_CalculateCRC8, Crc_CalculateCRC8Parallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC8Parallel_short_message) {
+    expectShortMessageMatches<uint8_t>(Crc_CalculateCRC8, Crc_CalculateCRC8Parallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC8H2FParallel_threads) {
+    expectThreadsMatch<uint8_t>(Crc_CalculateCRC8H2F, Crc_CalculateCRC8H2FParallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC8H2FParallel_caller_pool) {
+    expectCallerPoolMatches<uint8_t>(Crc_CalculateCRC8H2F, Crc_CalculateCRC8H2FParallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC8H2FParallel_chained) {
+    expectChainedMatches<uint8_t>(Crc_CalculateCRC8H2F, Crc_CalculateCRC8H2FParallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC8H2FParallel_short_message) {
+    expectShortMessageMatches<uint8_t>(Crc_CalculateCRC8H2F, Crc_CalculateCRC8H2FParallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC16Parallel_threads) {
+    expectThreadsMatch<uint16_t>(Crc_CalculateCRC16, Crc_CalculateCRC16Parallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC16Parallel_caller_pool) {
+    expectCallerPoolMatches<uint16_t>(Crc_CalculateCRC16, Crc_CalculateCRC16Parallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC16Parallel_chained) {
+    expectChainedMatches<uint16_t>(Crc_CalculateCRC16, Crc_CalculateCRC16Parallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC16Parallel_short_message) {
+    expectShortMessageMatches<uint16_t>(Crc_CalculateCRC16, Crc_CalculateCRC16Parallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC16ARCParallel_threads) {
+    expectThreadsMatch<uint16_t>(Crc_CalculateCRC16ARC, Crc_CalculateCRC16ARCParallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC16ARCParallel_caller_pool) {
+    expectCallerPoolMatches<uint16_t>(Crc_CalculateCRC16ARC, Crc_CalculateCRC16ARCParallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC16ARCParallel_chained) {
+    expectChainedMatches<uint16_t>(Crc_CalculateCRC16ARC, Crc_CalculateCRC16ARCParallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC16ARCParallel_short_message) {
+    expectShortMessageMatches<uint16_t>(Crc_CalculateCRC16ARC, Crc_CalculateCRC16ARCParallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC32Parallel_threads) {
+    expectThreadsMatch<uint32_t>(Crc_CalculateCRC32, Crc_CalculateCRC32Parallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC32Parallel_caller_pool) {
+    expectCallerPoolMatches<uint32_t>(Crc_CalculateCRC32, Crc_CalculateCRC32Parallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC32Parallel_chained) {
+    expectChainedMatches<uint32_t>(Crc_CalculateCRC32, Crc_CalculateCRC32Parallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC32Parallel_short_message) {
+    expectShortMessageMatches<uint32_t>(Crc_CalculateCRC32, Crc_CalculateCRC32Parallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC32P4Parallel_threads) {
+    expectThreadsMatch<uint32_t>(Crc_CalculateCRC32P4, Crc_CalculateCRC32P4Parallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC32P4Parallel_caller_pool) {
+    expectCallerPoolMatches<uint32_t>(Crc_CalculateCRC32P4, Crc_CalculateCRC32P4Parallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC32P4Parallel_chained) {
+    expectChainedMatches<uint32_t>(Crc_CalculateCRC32P4, Crc_CalculateCRC32P4Parallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC32P4Parallel_short_message) {
+    expectShortMessageMatches<uint32_t>(Crc_CalculateCRC32P4, Crc_CalculateCRC32P4Parallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC64Parallel_threads) {
+    expectThreadsMatch<uint64_t>(Crc_CalculateCRC64, Crc_CalculateCRC64Parallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC64Parallel_caller_pool) {
+    expectCallerPoolMatches<uint64_t>(Crc_CalculateCRC64, Crc_CalculateCRC64Parallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC64Parallel_chained) {
+    expectChainedMatches<uint64_t>(Crc_CalculateCRC64, Crc_CalculateCRC64Parallel);
+}
+
+TEST(CrcParallelTests, CalculateCRC64Parallel_short_message) {
+    expectShortMessageMatches<uint64_t>(Crc_CalculateCRC64, Crc_CalculateCRC64Parallel);
+}
@@ -0,0 +1,177 @@
+extern "C" {
+    #include "Crc.h"
+}
+
+#include "reference_crc.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * These tests rewrite ranges of a buffer, update its CRC with Crc_PatchCRCxx and check the result
+ * against the bit-by-bit model in reference_crc.h for the rewritten buffer:
+ * - one range of 0 to 200 bytes at the start, in the middle and at the end of the buffer
+ * - several ranges in one call, including overlapping ranges and ranges whose bytes are unchanged
+ * - a 4-byte counter in a 256 KiB buffer
+ */
+
+namespace {
+    template <typename T>
+    using PatchFunction = T (*)(T, size_t, const Crc_PatchType[], uint32_t);
+
+    /**
+     * Writes newData at offset into buffer and returns the patch for the change. The old and new
+     * contents are kept in contents, since a later overlapping write changes the buffer.
+     */
+    Crc_PatchType rewrite(std::vector<uint8_t>& buffer,
+                          std::vector<std::vector<uint8_t>>& contents,
+                          size_t offset,
+                          const std::vector<uint8_t>& newData) {
+        contents.emplace_back(buffer.begin() + offset, buffer.begin() + offset + newData.size());
+        const uint8_t* oldDataPtr = contents.back().data();
+        contents.push_back(newData);
+        std::copy(newData.begin(), newData.end(), buffer.begin() + offset);
+
+        return Crc_PatchType{offset, newData.size(), oldDataPtr, contents.back().data()};
+    }
+
+    template <typename T>
+    void expectSinglePatchMatches(PatchFunction<T> patchCrc, const CrcModel& model) {
+        const size_t lengths[] = {0, 1, 2, 63, 64, 65, 200};
+        const auto original = referenceData(3000);
+        const T oldCrc = static_cast<T>(referenceCrc(model, original.data(), original.size()));
+
+        for (const size_t length : lengths) {
+            const size_t offsets[] = {0, 1234, original.size() - length};
+
+            for (const size_t offset : offsets) {
+                std::vector<uint8_t> buffer = original;
+                std::vector<std::vector<uint8_t>> contents;
+                const Crc_PatchType patch = rewrite(buffer, contents, offset, referenceData(length, 0x1F123BB5));
+
+                ASSERT_EQ(patchCrc(oldCrc, buffer.size(), &patch, 1),
+                          static_cast<T>(referenceCrc(model, buffer.data(), buffer.size())))
+                    << "length " << length << " offset " << offset;
+            }
+        }
+    }
+
+    template <typename T>
+    void expectSeveralPatchesMatch(PatchFunction<T> patchCrc, const CrcModel& model) {
+        std::vector<uint8_t> buffer = referenceData(1500);
+        const T oldCrc = static_cast<T>(referenceCrc(model, buffer.data(), buffer.size()));
+        std::vector<std::vector<uint8_t>> contents;
+
+        const Crc_PatchType patches[] = {
+            rewrite(buffer, contents, 10, {0x01, 0x02, 0x03, 0x04}),
+            rewrite(buffer, contents, 700, referenceData(100, 0x6C078965)),
+            rewrite(buffer, contents, 750, referenceData(100, 0x41C64E6D)),
+            rewrite(buffer, contents, 1200, std::vector<uint8_t>(&buffer[1200], &buffer[1216])),
+            rewrite(buffer, contents, 1499, {0xA5}),
+        };
+
+        EXPECT_EQ(patchCrc(oldCrc, buffer.size(), patches, 5),
+                  static_cast<T>(referenceCrc(model, buffer.data(), buffer.size())));
+        EXPECT_EQ(patchCrc(oldCrc, buffer.size(), patches, 0), oldCrc);
+    }
+
+    template <typename T>
+    void expectCounterPatchMatches(PatchFunction<T> patchCrc, const CrcModel& model) {
+        std::vector<uint8_t> buffer = referenceData(256 * 1024);
+        T crc = static_cast<T>(referenceCrc(model, buffer.data(), buffer.size()));
+        std::vector<std::vector<uint8_t>> contents;
+
+        for (uint8_t counter = 1; counter <= 3; ++counter) {
+            const Crc_PatchType patch = rewrite(buffer, contents, 4096, {counter, 0x00, 0x00, 0x00});
+            crc = patchCrc(crc, buffer.size(), &patch, 1);
+        }
+
+        EXPECT_EQ(crc, static_cast<T>(referenceCrc(model, buffer.data(), buffer.size())));
+    }
+}
+
+TEST(CrcPatchTests, PatchCRC8_single_patch) {
+    expectSinglePatchMatches<uint8_t>(Crc_PatchCRC8, crc8Model);
+}
+
+TEST(CrcPatchTests, PatchCRC8_several_patches) {
+    expectSeveralPatchesMatch<uint8_t>(Crc_PatchCRC8, crc8Model);
+}
+
+TEST(CrcPatchTests, PatchCRC8_counter) {
+    expectCounterPatchMatches<uint8_t>(Crc_PatchCRC8, crc8Model);
+}
+
+TEST(CrcPatchTests, PatchCRC8H2F_single_patch) {
+    expectSinglePatchMatches<uint8_t>(Crc_PatchCRC8H2F, crc8H2FModel);
+}
+
+TEST(CrcPatchTests, PatchCRC8H2F_several_patches) {
+    expectSeveralPatchesMatch<uint8_t>(Crc_PatchCRC8H2F, crc8H2FModel);
+}
+
+TEST(CrcPatchTests, PatchCRC8H2F_counter) {
+    expectCounterPatchMatches<uint8_t>(Crc_PatchCRC8H2F, crc8H2FModel);
+}
+
+TEST(CrcPatchTests, PatchCRC16_single_patch) {
+    expectSinglePatchMatches<uint16_t>(Crc_PatchCRC16, crc16Model);
+}
+
+TEST(CrcPatchTests, PatchCRC16_several_patches) {
+    expectSeveralPatchesMatch<uint16_t>(Crc_PatchCRC16, crc16Model);
+}
+
+TEST(CrcPatchTests, PatchCRC16_counter) {
+    expectCounterPatchMatches<uint16_t>(Crc_PatchCRC16, crc16Model);
+}
+
+TEST(CrcPatchTests, PatchCRC16ARC_single_patch) {
+    expectSinglePatchMatches<uint16_t>(Crc_PatchCRC16ARC, crc16ARCModel);
+}
+
+TEST(CrcPatchTests, PatchCRC16ARC_several_patches) {
+    expectSeveralPatchesMatch<uint16_t>(Crc_PatchCRC16ARC, crc16ARCModel);
+}
+
+TEST(CrcPatchTests, PatchCRC16ARC_counter) {
+    expectCounterPatchMatches<uint16_t>(Crc_PatchCRC16ARC, crc16ARCModel);
+}
+
+TEST(CrcPatchTests, PatchCRC32_single_patch) {
+    expectSinglePatchMatches<uint32_t>(Crc_PatchCRC32, crc32Model);
+}
+
+TEST(CrcPatchTests, PatchCRC32_several_patches) {
+    expectSeveralPatchesMatch<uint32_t>(Crc_PatchCRC32, crc32Model);
+}
+
+TEST(CrcPatchTests, PatchCRC32_counter) {
+    expectCounterPatchMatches<uint32_t>(Crc_PatchCRC32, crc32Model);
+}
+
+TEST(CrcPatchTests, PatchCRC32P4_single_patch) {
+    expectSinglePatchMatches<uint32_t>(Crc_PatchCRC32P4, crc32P4Model);
+}
+
+TEST(CrcPatchTests, PatchCRC32P4_several_patches) {
+    expectSeveralPatchesMatch<uint32_t>(Crc_PatchCRC32P4, crc32P4Model);
+}
+
+TEST(CrcPatchTests, PatchCRC32P4_counter) {
+    expectCounterPatchMatches<uint32_t>(Crc_PatchCRC32P4, crc32P4Model);
+}
+
+TEST(CrcPatchTests, PatchCRC64_single_patch) {
+    expectSinglePatchMatches<uint64_t>(Crc_PatchCRC64, crc64Model);
+}
+
+TEST(CrcPatchTests, PatchCRC64_several_patches) {
+    expectSeveralPatchesMatch<uint64_t>(Crc_PatchCRC64, crc64Model);
+}
+
+TEST(CrcPatchTests, PatchCRC64_counter) {
+    expectCounterPatchMatches<uint64_t>(Crc_PatchCRC64, crc64Model);
+}
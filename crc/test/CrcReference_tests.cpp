@@ -0,0 +1,141 @@
+extern "C" {
+    #include "Crc.h"
+}
+
+#include "reference_crc.h"
+
+#include <gtest/gtest.h>
+
+/**
+ * The AUTOSAR samples in test_data.h are at most nine bytes long, which is shorter than
+ * the blocks consumed by the table slicing and folding implementations. These tests compare
+ * each Crc_CalculateCRCxx function against the bit-by-bit model in reference_crc.h for:
+ * - every length up to a few hundred bytes, starting at every alignment within 8 bytes
+ * - buffers of a few kilobytes, with every tail length after the widest folding blocks
+ * - a buffer split into two calls at every possible position, chaining with Crc_IsFirstCall=false
+ */
+
+namespace {
+    template <typename T>
+    using CrcFunction = T (*)(const uint8_t*, uint32_t, T, bool);
+
+    template <typename T>
+    void expectAllLengthsMatch(CrcFunction<T> calculate, const CrcModel& model) {
+        const auto data = referenceData(320 + 8);
+
+        for (size_t offset = 0; offset < 8; ++offset) {
+            for (size_t length = 0; length <= 320; ++length) {
+                const T expected = static_cast<T>(referenceCrc(model, &data[offset], length));
+                const T result = calculate(&data[offset], static_cast<uint32_t>(length), 0, true);
+                ASSERT_EQ(result, expected) << "offset " << offset << ", length " << length;
+            }
+        }
+    }
+
+    template <typename T>
+    void expectLargeBufferMatches(CrcFunction<T> calculate, const CrcModel& model) {
+        const auto data = referenceData(4096 + 256);
+
+        for (size_t length = 4096; length <= data.size(); ++length) {
+            const T expected = static_cast<T>(referenceCrc(model, data.data(), length));
+            const T result = calculate(data.data(), static_cast<uint32_t>(length), 0, true);
+            ASSERT_EQ(result, expected) << "length " << length;
+        }
+    }
+
+    template <typename T>
+    void expectChainedMatches(CrcFunction<T> calculate, const CrcModel& model) {
+        const auto data = referenceData(200);
+        const T expected = static_cast<T>(referenceCrc(model, data.data(), data.size()));
+
+        for (size_t split = 0; split <= data.size(); ++split) {
+            T result = calculate(data.data(), static_cast<uint32_t>(split), 0, true);
+            result = calculate(&data[split], static_cast<uint32_t>(data.size() - split), result, false);
+            ASSERT_EQ(result, expected) << "split at " << split;
+        }
+    }
+}
+
+TEST(CrcReferenceTests, CalculateCRC8_all_lengths) {
+    expectAllLengthsMatch<uint8_t>(Crc_CalculateCRC8, crc8Model);
+}
+
+TEST(CrcReferenceTests, CalculateCRC8_large_buffer) {
+    expectLargeBufferMatches<uint8_t>(Crc_CalculateCRC8, crc8Model);
+}
+
+TEST(CrcReferenceTests, CalculateCRC8_chained) {
+    expectChainedMatches<uint8_t>(Crc_CalculateCRC8, crc8Model);
+}
+
+TEST(CrcReferenceTests, CalculateCRC8H2F_all_lengths) {
+    expectAllLengthsMatch<uint8_t>(Crc_CalculateCRC8H2F, crc8H2FModel);
+}
+
+TEST(CrcReferenceTests, CalculateCRC8H2F_large_buffer) {
+    expectLargeBufferMatches<uint8_t>(Crc_CalculateCRC8H2F, crc8H2FModel);
+}
+
+TEST(CrcReferenceTests, CalculateCRC8H2F_chained) {
+    expectChainedMatches<uint8_t>(Crc_CalculateCRC8H2F, crc8H2FModel);
+}
+
+TEST(CrcReferenceTests, CalculateCRC16_all_lengths) {
+    expectAllLengthsMatch<uint16_t>(Crc_CalculateCRC16, crc16Model);
+}
+
+TEST(CrcReferenceTests, CalculateCRC16_large_buffer) {
+    expectLargeBufferMatches<uint16_t>(Crc_CalculateCRC16, crc16Model);
+}
+
+TEST(CrcReferenceTests, CalculateCRC16_chained) {
+    expectChainedMatches<uint16_t>(Crc_CalculateCRC16, crc16Model);
+}
+
+TEST(CrcReferenceTests, CalculateCRC16ARC_all_lengths) {
+    expectAllLengthsMatch<uint16_t>(Crc_CalculateCRC16ARC, crc16ARCModel);
+}
+
+TEST(CrcReferenceTests, CalculateCRC16ARC_large_buffer) {
+    expectLargeBufferMatches<uint16_t>(Crc_CalculateCRC16ARC, crc16ARCModel);
+}
+
+TEST(CrcReferenceTests, CalculateCRC16ARC_chained) {
+    expectChainedMatches<uint16_t>(Crc_CalculateCRC16ARC, crc16ARCModel);
+}
+
+TEST(CrcReferenceTests, CalculateCRC32_all_lengths) {
+    expectAllLengthsMatch<uint32_t>(Crc_CalculateCRC32, crc32Model);
+}
+
+TEST(CrcReferenceTests, CalculateCRC32_large_buffer) {
+    expectLargeBufferMatches<uint32_t>(Crc_CalculateCRC32, crc32Model);
+}
+
+TEST(CrcReferenceTests, CalculateCRC32_chained) {
+    expectChainedMatches<uint32_t>(Crc_CalculateCRC32, crc32Model);
+}
+
+TEST(CrcReferenceTests, CalculateCRC32P4_all_lengths) {
+    expectAllLengthsMatch<uint32_t>(Crc_CalculateCRC32P4, crc32P4Model);
+}
+
+TEST(CrcReferenceTests, CalculateCRC32P4_large_buffer) {
+    expectLargeBufferMatches<uint32_t>(Crc_CalculateCRC32P4, crc32P4Model);
+}
+
+TEST(CrcReferenceTests, CalculateCRC32P4_chained) {
+    expectChainedMatches<uint32_t>(Crc_CalculateCRC32P4, crc32P4Model);
+}
+
+TEST(CrcReferenceTests, CalculateCRC64_all_lengths) {
+    expectAllLengthsMatch<uint64_t>(Crc_CalculateCRC64, crc64Model);
+}
+
+TEST(CrcReferenceTests, CalculateCRC64_large_buffer) {
+    expectLargeBufferMatches<uint64_t>(Crc_CalculateCRC64, crc64Model);
+}
+
+TEST(CrcReferenceTests, CalculateCRC64_chained) {
+    expectChainedMatches<uint64_t>(Crc_CalculateCRC64, crc64Model);
+}
@@ -0,0 +1,157 @@
+extern "C" {
+    #include "Crc.h"
+}
+
+#include "reference_crc.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * These tests compare each Crc_CalculateCRCxxV function against Crc_CalculateCRCxx over the
+ * concatenated segments:
+ * - a message split into segments of 0 to 40 bytes, so that segments are empty, shorter and longer
+ *   than a block
+ * - continuing from a start value, which must match continuing the single call
+ * - no segments, which is the CRC of no data
+ */
+
+namespace {
+    template <typename T>
+    using CrcFunction = T (*)(const uint8_t*, uint32_t, T, bool);
+
+    template <typename T>
+    using VectorFunction = T (*)(const Crc_SegmentType[], uint32_t, T, bool);
+
+    std::vector<Crc_SegmentType> makeSegments(const std::vector<uint8_t>& data, size_t seed) {
+        std::vector<Crc_SegmentType> segments;
+        const auto lengths = referenceData(data.size() + 1, static_cast<uint32_t>(0x5EED0000U + seed));
+        size_t offset = 0;
+
+        for (size_t segment = 0; offset < data.size(); ++segment) {
+            const size_t length = std::min(static_cast<size_t>(lengths[segment] % 41), data.size() - offset);
+            segments.push_back({&data[offset], length});
+            offset += length;
+        }
+
+        return segments;
+    }
+
+    template <typename T>
+    void expectSegmentsMatch(CrcFunction<T> calculate, VectorFunction<T> vector) {
+        const auto data = referenceData(1000);
+
+        for (size_t seed = 0; seed < 20; ++seed) {
+            const auto segments = makeSegments(data, seed);
+            const uint32_t count = static_cast<uint32_t>(segments.size());
+
+            ASSERT_EQ(vector(segments.data(), count, 0, true), calculate(data.data(), 1000, 0, true))
+                << "seed " << seed;
+        }
+    }
+
+    template <typename T>
+    void expectContinuationMatches(CrcFunction<T> calculate, VectorFunction<T> vector) {
+        const auto data = referenceData(300);
+        const auto segments = makeSegments(data, 99);
+        const uint32_t count = static_cast<uint32_t>(segments.size());
+        const T start = calculate(data.data(), 17, 0, true);
+
+        EXPECT_EQ(vector(segments.data(), count, start, false), calculate(data.data(), 300, start, false));
+    }
+
+    template <typename T>
+    void expectNoSegmentsMatches(CrcFunction<T> calculate, VectorFunction<T> vector) {
+        const uint8_t data[1] = {0};
+        const T start = calculate(data, 1, 0, true);
+
+        EXPECT_EQ(vector(nullptr, 0, 0, true), calculate(data, 0, 0, true));
+        EXPECT_EQ(vector(nullptr, 0, start, false), calculate(data, 0, start, false));
+    }
+}
+
+TEST(CrcSegmentsTests, CalculateCRC8V_segments) {
+    expectSegmentsMatch<uint8_t>(Crc_CalculateCRC8, Crc_CalculateCRC8V);
+}
+
+TEST(CrcSegmentsTests, CalculateCRC8V_continuation) {
+    expectContinuationMatches<uint8_t>(Crc_CalculateCRC8, Crc_CalculateCRC8V);
+}
+
+TEST(CrcSegmentsTests, CalculateCRC8V_no_segments) {
+    expectNoSegmentsMatches<uint8_t>(Crc_CalculateCRC8, Crc_CalculateCRC8V);
+}
+
+TEST(CrcSegmentsTests, CalculateCRC8H2FV_segments) {
+    expectSegmentsMatch<uint8_t>(Crc_CalculateCRC8H2F, Crc_CalculateCRC8H2FV);
+}
+
+TEST(CrcSegmentsTests, CalculateCRC8H2FV_continuation) {
+    expectContinuationMatches<uint8_t>(Crc_CalculateCRC8H2F, Crc_CalculateCRC8H2FV);
+}
+
+TEST(CrcSegmentsTests, CalculateCRC8H2FV_no_segments) {
+    expectNoSegmentsMatches<uint8_t>(Crc_CalculateCRC8H2F, Crc_CalculateCRC8H2FV);
+}
+
+TEST(CrcSegmentsTests, CalculateCRC16V_segments) {
+    expectSegmentsMatch<uint16_t>(Crc_CalculateCRC16, Crc_CalculateCRC16V);
+}
+
+TEST(CrcSegmentsTests, CalculateCRC16V_continuation) {
+    expectContinuationMatches<uint16_t>(Crc_CalculateCRC16, Crc_CalculateCRC16V);
+}
+
+TEST(CrcSegmentsTests, CalculateCRC16V_no_segments) {
+    expectNoSegmentsMatches<uint16_t>(Crc_CalculateCRC16, Crc_CalculateCRC16V);
+}
+
+TEST(CrcSegmentsTests, CalculateCRC16ARCV_segments) {
+    expectSegmentsMatch<uint16_t>(Crc_CalculateCRC16ARC, Crc_CalculateCRC16ARCV);
+}
+
+TEST(CrcSegmentsTests, CalculateCRC16ARCV_continuation) {
+    expectContinuationMatches<uint16_t>(Crc_CalculateCRC16ARC, Crc_CalculateCRC16ARCV);
+}
+
+TEST(CrcSegmentsTests, CalculateCRC16ARCV_no_segments) {
+    expectNoSegmentsMatches<uint16_t>(Crc_CalculateCRC16ARC, Crc_CalculateCRC16ARCV);
+}
+
+TEST(CrcSegmentsTests, CalculateCRC32V_segments) {
+    expectSegmentsMatch<uint32_t>(Crc_CalculateCRC32, Crc_CalculateCRC32V);
+}
+
+TEST(CrcSegmentsTests, CalculateCRC32V_continuation) {
+    expectContinuationMatches<uint32_t>(Crc_CalculateCRC32, Crc_CalculateCRC32V);
+}
+
+TEST(CrcSegmentsTests, CalculateCRC32V_no_segments) {
+    expectNoSegmentsMatches<uint32_t>(Crc_CalculateCRC32, Crc_CalculateCRC32V);
+}
+
+TEST(CrcSegmentsTests, CalculateCRC32P4V_segments) {
+    expectSegmentsMatch<uint32_t>(Crc_CalculateCRC32P4, Crc_CalculateCRC32P4V);
+}
+
+TEST(CrcSegmentsTests, CalculateCRC32P4V_continuation) {
+    expectContinuationMatches<uint32_t>(Crc_CalculateCRC32P4, Crc_CalculateCRC32P4V);
+}
+
+TEST(CrcSegmentsTests, CalculateCRC32P4V_no_segments) {
+    expectNoSegmentsMatches<uint32_t>(Crc_CalculateCRC32P4, Crc_CalculateCRC32P4V);
+}
+
+TEST(CrcSegmentsTests, CalculateCRC64V_segments) {
+    expectSegmentsMatch<uint64_t>(Crc_CalculateCRC64, Crc_CalculateCRC64V);
+}
+
+TEST(CrcSegmentsTests, CalculateCRC64V_continuation) {
+    expectContinuationMatches<uint64_t>(Crc_CalculateCRC64, Crc_CalculateCRC64V);
+}
+
+TEST(CrcSegmentsTests, CalculateCRC64V_no_segments) {
+    expectNoSegmentsMatches<uint64_t>(Crc_CalculateCRC64, Crc_CalculateCRC64V);
+}
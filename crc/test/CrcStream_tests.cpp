@@ -0,0 +1,178 @@
+extern "C" {
+    #include "Crc.h"
+}
+
+#include "reference_crc.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+/**
+ * These tests check each streaming Crc_InitCRCxx, Crc_UpdateCRCxx and Crc_FinalCRCxx sequence
+ * against the bit-by-bit model in reference_crc.h for the whole message:
+ * - a message appended in parts of 1 to 40 bytes, with empty parts in between
+ * - an empty message, which is the CRC of no data
+ * - the result of every prefix, since Crc_FinalCRCxx leaves the context unchanged
+ */
+
+namespace {
+    template <typename T, typename Context>
+    struct StreamFunctions {
+        void (*init)(Context*);
+        void (*update)(Context*, const uint8_t*, size_t);
+        T (*final)(const Context*);
+    };
+
+    template <typename T, typename Context>
+    void expectPartsMatch(const StreamFunctions<T, Context>& stream, const CrcModel& model) {
+        const auto data = referenceData(1000);
+
+        for (size_t partLength = 1; partLength <= 40; ++partLength) {
+            Context context;
+            stream.init(&context);
+
+            size_t offset = 0;
+            while (offset < data.size()) {
+                const size_t length = std::min(partLength + (offset % 3), data.size() - offset);
+                stream.update(&context, &data[offset], 0);
+                stream.update(&context, &data[offset], length);
+                offset += length;
+            }
+
+            ASSERT_EQ(stream.final(&context), static_cast<T>(referenceCrc(model, data.data(), data.size())))
+                << "part length " << partLength;
+        }
+    }
+
+    template <typename T, typename Context>
+    void expectEmptyMessageMatches(const StreamFunctions<T, Context>& stream, const CrcModel& model) {
+        const uint8_t data[1] = {0};
+        Context context;
+
+        stream.init(&context);
+        EXPECT_EQ(stream.final(&context), static_cast<T>(referenceCrc(model, data, 0)));
+
+        stream.update(&context, data, 0);
+        EXPECT_EQ(stream.final(&context), static_cast<T>(referenceCrc(model, data, 0)));
+    }
+
+    template <typename T, typename Context>
+    void expectEveryPrefixMatches(const StreamFunctions<T, Context>& stream, const CrcModel& model) {
+        const auto data = referenceData(100);
+        Context context;
+
+        stream.init(&context);
+        for (size_t length = 1; length <= data.size(); ++length) {
+            stream.update(&context, &data[length - 1], 1);
+            ASSERT_EQ(stream.final(&context), static_cast<T>(referenceCrc(model, data.data(), length)))
+                << "prefix length " << length;
+        }
+    }
+
+    const StreamFunctions<uint8_t, Crc_ContextCRC8Type> crc8Stream{
+        Crc_InitCRC8, Crc_UpdateCRC8, Crc_FinalCRC8
+    };
+    const StreamFunctions<uint8_t, Crc_ContextCRC8H2FType> crc8H2FStream{
+        Crc_InitCRC8H2F, Crc_UpdateCRC8H2F, Crc_FinalCRC8H2F
+    };
+    const StreamFunctions<uint16_t, Crc_ContextCRC16Type> crc16Stream{
+        Crc_InitCRC16, Crc_UpdateCRC16, Crc_FinalCRC16
+    };
+    const StreamFunctions<uint16_t, Crc_ContextCRC16ARCType> crc16ARCStream{
+        Crc_InitCRC16ARC, Crc_UpdateCRC16ARC, Crc_FinalCRC16ARC
+    };
+    const StreamFunctions<uint32_t, Crc_ContextCRC32Type> crc32Stream{
+        Crc_InitCRC32, Crc_UpdateCRC32, Crc_FinalCRC32
+    };
+    const StreamFunctions<uint32_t, Crc_ContextCRC32P4Type> crc32P4Stream{
+        Crc_InitCRC32P4, Crc_UpdateCRC32P4, Crc_FinalCRC32P4
+    };
+    const StreamFunctions<uint64_t, Crc_ContextCRC64Type> crc64Stream{
+        Crc_InitCRC64, Crc_UpdateCRC64, Crc_FinalCRC64
+    };
+}
+
+TEST(CrcStreamTests, StreamCRC8_parts) {
+    expectPartsMatch(crc8Stream, crc8Model);
+}
+
+TEST(CrcStreamTests, StreamCRC8_empty_message) {
+    expectEmptyMessageMatches(crc8Stream, crc8Model);
+}
+
+TEST(CrcStreamTests, StreamCRC8_every_prefix) {
+    expectEveryPrefixMatches(crc8Stream, crc8Model);
+}
+
+TEST(CrcStreamTests, StreamCRC8H2F_parts) {
+    expectPartsMatch(crc8H2FStream, crc8H2FModel);
+}
+
+TEST(CrcStreamTests, StreamCRC8H2F_empty_message) {
+    expectEmptyMessageMatches(crc8H2FStream, crc8H2FModel);
+}
+
+TEST(CrcStreamTests, StreamCRC8H2F_every_prefix) {
+    expectEveryPrefixMatches(crc8H2FStream, crc8H2FModel);
+}
+
+TEST(CrcStreamTests, StreamCRC16_parts) {
+    expectPartsMatch(crc16Stream, crc16Model);
+}
+
+TEST(CrcStreamTests, StreamCRC16_empty_message) {
+    expectEmptyMessageMatches(crc16Stream, crc16Model);
+}
+
+TEST(CrcStreamTests, StreamCRC16_every_prefix) {
+    expectEveryPrefixMatches(crc16Stream, crc16Model);
+}
+
+TEST(CrcStreamTests, StreamCRC16ARC_parts) {
+    expectPartsMatch(crc16ARCStream, crc16ARCModel);
+}
+
+TEST(CrcStreamTests, StreamCRC16ARC_empty_message) {
+    expectEmptyMessageMatches(crc16ARCStream, crc16ARCModel);
+}
+
+TEST(CrcStreamTests, StreamCRC16ARC_every_prefix) {
+    expectEveryPrefixMatches(crc16ARCStream, crc16ARCModel);
+}
+
+TEST(CrcStreamTests, StreamCRC32_parts) {
+    expectPartsMatch(crc32Stream, crc32Model);
+}
+
+TEST(CrcStreamTests, StreamCRC32_empty_message) {
+    expectEmptyMessageMatches(crc32Stream, crc32Model);
+}
+
+TEST(CrcStreamTests, StreamCRC32_every_prefix) {
+    expectEveryPrefixMatches(crc32Stream, crc32Model);
+}
+
+TEST(CrcStreamTests, StreamCRC32P4_parts) {
+    expectPartsMatch(crc32P4Stream, crc32P4Model);
+}
+
+TEST(CrcStreamTests, StreamCRC32P4_empty_message) {
+    expectEmptyMessageMatches(crc32P4Stream, crc32P4Model);
+}
+
+TEST(CrcStreamTests, StreamCRC32P4_every_prefix) {
+    expectEveryPrefixMatches(crc32P4Stream, crc32P4Model);
+}
+
+TEST(CrcStreamTests, StreamCRC64_parts) {
+    expectPartsMatch(crc64Stream, crc64Model);
+}
+
+TEST(CrcStreamTests, StreamCRC64_empty_message) {
+    expectEmptyMessageMatches(crc64Stream, crc64Model);
+}
+
+TEST(CrcStreamTests, StreamCRC64_every_prefix) {
+    expectEveryPrefixMatches(crc64Stream, crc64Model);
+}
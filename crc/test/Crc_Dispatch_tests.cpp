@@ -0,0 +1,122 @@
+extern "C" {
+    #include "Crc.h"
+    #include "Crc_Dispatch.h"
+}
+
+#include "reference_crc.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <cstring>
+
+/**
+ * These tests cover the tier selection of crc_dispatch:
+ * - the tier selected when the program is loaded, with and without CRC_DISPATCH_TIER
+ * - selecting every tier the CPU supports and comparing all CRCs against reference_crc.h
+ * - rejecting unknown tiers and tiers the CPU does not support
+ *
+ * The CRC tests themselves are run against crc_dispatch once per forced tier, see
+ * CMakeLists.txt.
+ */
+
+namespace {
+    const Crc_DispatchTierType allTiers[] = {
+        CRC_DISPATCH_TIER_BITWISE,
+        CRC_DISPATCH_TIER_TABLE,
+        CRC_DISPATCH_TIER_SLICE8,
+        CRC_DISPATCH_TIER_PCLMUL,
+        CRC_DISPATCH_TIER_AVX512
+    };
+
+    const char* const tierNames[] = {"bitwise", "table", "slice8", "pclmul", "avx512"};
+
+    Crc_DispatchTierType fastestAvailableTier() {
+        Crc_DispatchTierType fastest = CRC_DISPATCH_TIER_BITWISE;
+        for (const auto tier : allTiers) {
+            if (Crc_DispatchIsTierAvailable(tier)) {
+                fastest = tier;
+            }
+        }
+        return fastest;
+    }
+
+    /**
+     * Restores the tier selected at load time after each test
+     */
+    class CrcDispatchTests : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            initialTier = Crc_DispatchGetTier();
+        }
+
+        void TearDown() override {
+            EXPECT_EQ(Crc_DispatchSelectTier(initialTier), E_OK);
+        }
+
+        Crc_DispatchTierType initialTier = CRC_DISPATCH_TIER_TABLE;
+    };
+}
+
+TEST_F(CrcDispatchTests, InitialTier) {
+    Crc_DispatchTierType expected = fastestAvailableTier();
+
+    const char* forced = std::getenv("CRC_DISPATCH_TIER");
+    if (forced != nullptr) {
+        for (size_t i = 0; i < sizeof(allTiers) / sizeof(allTiers[0]); ++i) {
+            if ((std::strcmp(forced, tierNames[i]) == 0) && Crc_DispatchIsTierAvailable(allTiers[i])) {
+                expected = allTiers[i];
+            }
+        }
+    }
+
+    EXPECT_EQ(initialTier, expected);
+}
+
+TEST_F(CrcDispatchTests, BasicTiersAlwaysAvailable) {
+    EXPECT_TRUE(Crc_DispatchIsTierAvailable(CRC_DISPATCH_TIER_BITWISE));
+    EXPECT_TRUE(Crc_DispatchIsTierAvailable(CRC_DISPATCH_TIER_TABLE));
+    EXPECT_TRUE(Crc_DispatchIsTierAvailable(CRC_DISPATCH_TIER_SLICE8));
+}
+
+TEST_F(CrcDispatchTests, SelectTier_every_available_tier) {
+    const auto data = referenceData(1000);
+
+    for (const auto tier : allTiers) {
+        if (!Crc_DispatchIsTierAvailable(tier)) {
+            continue;
+        }
+
+        ASSERT_EQ(Crc_DispatchSelectTier(tier), E_OK);
+        EXPECT_EQ(Crc_DispatchGetTier(), tier);
+
+        const uint32_t length = static_cast<uint32_t>(data.size());
+        EXPECT_EQ(Crc_CalculateCRC8(data.data(), length, 0, true), referenceCrc(crc8Model, data.data(), length));
+        EXPECT_EQ(Crc_CalculateCRC8H2F(data.data(), length, 0, true), referenceCrc(crc8H2FModel, data.data(), length));
+        EXPECT_EQ(Crc_CalculateCRC16(data.data(), length, 0, true), referenceCrc(crc16Model, data.data(), length));
+        EXPECT_EQ(Crc_CalculateCRC16ARC(data.data(), length, 0, true), referenceCrc(crc16ARCModel, data.data(), length));
+        EXPECT_EQ(Crc_CalculateCRC32(data.data(), length, 0, true), referenceCrc(crc32Model, data.data(), length));
+        EXPECT_EQ(Crc_CalculateCRC32P4(data.data(), length, 0, true), referenceCrc(crc32P4Model, data.data(), length));
+        EXPECT_EQ(Crc_CalculateCRC64(data.data(), length, 0, true), referenceCrc(crc64Model, data.data(), length));
+    }
+}
+
+TEST_F(CrcDispatchTests, SelectTier_unavailable_tier) {
+    ASSERT_EQ(Crc_DispatchSelectTier(CRC_DISPATCH_TIER_TABLE), E_OK);
+
+    for (const auto tier : allTiers) {
+        if (!Crc_DispatchIsTierAvailable(tier)) {
+            EXPECT_EQ(Crc_DispatchSelectTier(tier), E_NOT_OK);
+            EXPECT_EQ(Crc_DispatchGetTier(), CRC_DISPATCH_TIER_TABLE);
+        }
+    }
+}
+
+TEST_F(CrcDispatchTests, SelectTier_unknown_tier) {
+    ASSERT_EQ(Crc_DispatchSelectTier(CRC_DISPATCH_TIER_TABLE), E_OK);
+
+    const auto unknown = static_cast<Crc_DispatchTierType>(CRC_DISPATCH_TIER_AVX512 + 1);
+    EXPECT_FALSE(Crc_DispatchIsTierAvailable(unknown));
+    EXPECT_EQ(Crc_DispatchSelectTier(unknown), E_NOT_OK);
+    EXPECT_EQ(Crc_DispatchGetTier(), CRC_DISPATCH_TIER_TABLE);
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Bit-by-bit reference model for the CRC routines in Crc.h, written straight from the
+ * parameter tables in the AUTOSAR CRC library specification (width, polynomial, initial
+ * value, reflection and XOR value). It is deliberately slow and simple so that it can be
+ * used to verify the optimized implementations for arbitrary lengths and alignments.
+ */
+
+namespace {
+    struct CrcModel {
+        unsigned width;
+        uint64_t polynomial;
+        uint64_t initial;
+        bool reflected;
+        uint64_t xorValue;
+    };
+
+    const CrcModel crc8Model{8, 0x1D, 0xFF, false, 0xFF};
+    const CrcModel crc8H2FModel{8, 0x2F, 0xFF, false, 0xFF};
+    const CrcModel crc16Model{16, 0x1021, 0xFFFF, false, 0x0000};
+    const CrcModel crc16ARCModel{16, 0x8005, 0x0000, true, 0x0000};
+    const CrcModel crc32Model{32, 0x04C11DB7, 0xFFFFFFFF, true, 0xFFFFFFFF};
+    const CrcModel crc32P4Model{32, 0xF4ACFB13, 0xFFFFFFFF, true, 0xFFFFFFFF};
+    const CrcModel crc64Model{64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, true, 0xFFFFFFFFFFFFFFFF};
+
+    uint64_t referenceReflect(uint64_t value, unsigned bits) {
+        uint64_t reflection = 0;
+        for (unsigned bit = 0; bit < bits; ++bit) {
+            if (value & (1ULL << bit)) {
+                reflection |= 1ULL << (bits - 1 - bit);
+            }
+        }
+        return reflection;
+    }
+
+    uint64_t referenceCrc(const CrcModel& model, const uint8_t* data, size_t length) {
+        const uint64_t topbit = 1ULL << (model.width - 1);
+        const uint64_t mask = (topbit << 1) - 1;
+        uint64_t remainder = model.initial;
+
+        for (size_t byte = 0; byte < length; ++byte) {
+            uint64_t value = data[byte];
+            if (model.reflected) {
+                value = referenceReflect(value, 8);
+            }
+            remainder ^= value << (model.width - 8);
+
+            for (unsigned bit = 0; bit < 8; ++bit) {
+                if (remainder & topbit) {
+                    remainder = ((remainder << 1) ^ model.polynomial) & mask;
+                } else {
+                    remainder = (remainder << 1) & mask;
+                }
+            }
+        }
+
+        if (model.reflected) {
+            remainder = referenceReflect(remainder, model.width);
+        }
+        return remainder ^ model.xorValue;
+    }
+
+    /**
+     * Deterministic pseudo random test data (xorshift), so failures are reproducible.
+     */
+    std::vector<uint8_t> referenceData(size_t length, uint32_t seed = 0x2545F491) {
+        std::vector<uint8_t> data(length);
+        for (auto& byte : data) {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            byte = static_cast<uint8_t>(seed >> 24);
+        }
+        return data;
+    }
+}
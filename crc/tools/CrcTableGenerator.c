@@ -0,0 +1,207 @@
+/**
+ * @file CrcTableGenerator.c
+ * @author Tomas Wester (torsko@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * -----------------------------------------------------------------------
+ * Build step that generates the lookup tables of crc_fast from the CRC
+ * parameters, see crc/CMakeLists.txt.
+ *
+ * Usage: crc_table_generator <output directory> <merged>
+ *
+ * Writes CrcFastTables.h and CrcFastTables.c to the output directory. The
+ * tables are const, so they are placed in .rodata and shared between
+ * processes, and aligned to 64-byte cache lines. With <merged> set to 1
+ * all tables are members of one struct, so together they occupy one
+ * contiguous region. Either way a table is accessed as
+ * CrcFastTables_<Algorithm>[index].
+ * -----------------------------------------------------------------------
+ *
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    const char* Name;
+    uint8_t Width;
+    uint64_t Polynomial;
+    bool Reflected;
+} CrcTableGenerator_AlgorithmType;
+
+/*
+ * In order of increasing table size, so that every table of the merged
+ * struct starts on a cache line.
+ */
+static const CrcTableGenerator_AlgorithmType algorithms[] = {
+    {"Crc8", 8, 0x1D, false},
+    {"Crc8H2F", 8, 0x2F, false},
+    {"Crc16", 16, 0x1021, false},
+    {"Crc16ARC", 16, 0x8005, true},
+    {"Crc32", 32, 0x04C11DB7, true},
+    {"Crc32P4", 32, 0xF4ACFB13, true},
+    {"Crc64", 64, 0x42F0E1EBA9EA3693, true},
+};
+
+#define ALGORITHM_COUNT (sizeof(algorithms) / sizeof(algorithms[0]))
+
+static uint64_t reflect(uint64_t data, uint8_t width) {
+    uint64_t reflection = 0;
+
+    for (uint8_t bit = 0; bit < width; ++bit) {
+        reflection = (reflection << 1) | (data & 1);
+        data >>= 1;
+    }
+
+    return reflection;
+}
+
+/*
+ * The remainder of a byte, in the reflected domain for reflected CRCs.
+ */
+static uint64_t tableEntry(const CrcTableGenerator_AlgorithmType* algorithm, uint8_t byte) {
+    const uint8_t width = algorithm->Width;
+    uint64_t remainder = 0;
+
+    if (algorithm->Reflected) {
+        const uint64_t polynomial = reflect(algorithm->Polynomial, width);
+
+        remainder = byte;
+        for (uint8_t bit = 0; bit < 8; ++bit) {
+            remainder = (remainder & 1) ? ((remainder >> 1) ^ polynomial) : (remainder >> 1);
+        }
+    } else {
+        const uint64_t topbit = 1ULL << (width - 1);
+        const uint64_t mask = (width < 64) ? ((1ULL << width) - 1) : ~0ULL;
+
+        remainder = (uint64_t)byte << (width - 8);
+        for (uint8_t bit = 0; bit < 8; ++bit) {
+            remainder = (remainder & topbit) ? (((remainder << 1) ^ algorithm->Polynomial) & mask)
+                                             : ((remainder << 1) & mask);
+        }
+    }
+
+    return remainder;
+}
+
+static void writeFileHeader(FILE* file, const char* name, bool merged) {
+    fprintf(file,
+            "/**\n"
+            " * @file %s\n"
+            " *\n"
+            " * Generated by crc_table_generator, do not edit.\n"
+            " * Lookup tables of crc_fast, %s.\n"
+            " */\n\n",
+            name,
+            merged ? "merged into one struct" : "one array per algorithm");
+}
+
+static void writeHeader(FILE* file, bool merged) {
+    writeFileHeader(file, "CrcFastTables.h", merged);
+    fprintf(file, "#ifndef CRC_FAST_TABLES_H__\n#define CRC_FAST_TABLES_H__\n\n#include <stdint.h>\n\n");
+
+    if (merged) {
+        fprintf(file, "typedef struct {\n");
+        for (size_t index = 0; index < ALGORITHM_COUNT; ++index) {
+            fprintf(file, "    uint%u_t %s[256];\n", algorithms[index].Width, algorithms[index].Name);
+        }
+        fprintf(file, "} CrcFastTables_Type;\n\n");
+        fprintf(file, "extern const CrcFastTables_Type CrcFastTables;\n\n");
+
+        for (size_t index = 0; index < ALGORITHM_COUNT; ++index) {
+            fprintf(file, "#define CrcFastTables_%s (CrcFastTables.%s)\n", algorithms[index].Name,
+                    algorithms[index].Name);
+        }
+    } else {
+        for (size_t index = 0; index < ALGORITHM_COUNT; ++index) {
+            fprintf(file, "extern const uint%u_t CrcFastTables_%s[256];\n", algorithms[index].Width,
+                    algorithms[index].Name);
+        }
+    }
+
+    fprintf(file, "\n#endif  // CRC_FAST_TABLES_H__\n");
+}
+
+static void writeTableEntries(FILE* file, const CrcTableGenerator_AlgorithmType* algorithm, const char* indent) {
+    const unsigned digits = algorithm->Width / 4U;
+    const unsigned perLine = (algorithm->Width == 64) ? 4U : 8U;
+
+    for (unsigned byte = 0; byte < 256; ++byte) {
+        if ((byte % perLine) == 0) {
+            fprintf(file, "%s", indent);
+        }
+
+        fprintf(file, "0x%0*" PRIx64, (int)digits, tableEntry(algorithm, (uint8_t)byte));
+
+        if (byte == 255) {
+            fprintf(file, "\n");
+        } else if ((byte % perLine) == (perLine - 1)) {
+            fprintf(file, ",\n");
+        } else {
+            fprintf(file, ", ");
+        }
+    }
+}
+
+static void writeSource(FILE* file, bool merged) {
+    writeFileHeader(file, "CrcFastTables.c", merged);
+    fprintf(file, "#include \"CrcFastTables.h\"\n\n");
+
+    if (merged) {
+        fprintf(file, "const CrcFastTables_Type CrcFastTables __attribute__((aligned(64))) = {\n");
+        for (size_t index = 0; index < ALGORITHM_COUNT; ++index) {
+            fprintf(file, "    .%s = {\n", algorithms[index].Name);
+            writeTableEntries(file, &algorithms[index], "        ");
+            fprintf(file, (index == (ALGORITHM_COUNT - 1)) ? "    }\n" : "    },\n");
+        }
+        fprintf(file, "};\n");
+    } else {
+        for (size_t index = 0; index < ALGORITHM_COUNT; ++index) {
+            fprintf(file, "%sconst uint%u_t CrcFastTables_%s[256] __attribute__((aligned(64))) = {\n",
+                    (index == 0) ? "" : "\n", algorithms[index].Width, algorithms[index].Name);
+            writeTableEntries(file, &algorithms[index], "    ");
+            fprintf(file, "};\n");
+        }
+    }
+}
+
+static int writeFile(const char* directory, const char* name, bool merged, void (*write)(FILE*, bool)) {
+    char path[4096];
+    const int pathLength = snprintf(path, sizeof(path), "%s/%s", directory, name);
+
+    if ((pathLength < 0) || ((size_t)pathLength >= sizeof(path))) {
+        fprintf(stderr, "crc_table_generator: output path too long\n");
+        return EXIT_FAILURE;
+    }
+
+    FILE* file = fopen(path, "w");
+    if (file == NULL) {
+        fprintf(stderr, "crc_table_generator: cannot write %s\n", path);
+        return EXIT_FAILURE;
+    }
+
+    write(file, merged);
+
+    return (fclose(file) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main(int argc, char* argv[]) {
+    if ((argc != 3) || ((strcmp(argv[2], "0") != 0) && (strcmp(argv[2], "1") != 0))) {
+        fprintf(stderr, "Usage: %s <output directory> <merged: 0 or 1>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const bool merged = (strcmp(argv[2], "1") == 0);
+
+    if (writeFile(argv[1], "CrcFastTables.h", merged, writeHeader) != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+
+    return writeFile(argv[1], "CrcFastTables.c", merged, writeSource);
+}
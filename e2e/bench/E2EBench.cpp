@@ -0,0 +1,388 @@
+extern "C" {
+    #include "E2E_P01.h"
+    #include "E2E_P05.h"
+    #include "E2E_SM.h"
+}
+
+#include "E2EBenchMessages.h"
+#include "PerfCounters.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Benchmarks of the E2E library for sizing receivers, items_per_second is calls per second:
+ * - E2E_P01Protect/<DataIDMode>/bytes:<DataLength>/crc:<first|last>
+ * - E2E_P01Check/<DataIDMode>/bytes:<DataLength>/crc:<first|last>/mix:<mix>
+ * - E2E_P01MapStatusToSM/<profile|legacy>/mix:<mix>
+ * - E2E_P01SMCheck/mix:<mix>
+ * - E2E_P01Receive/<DataIDMode>/bytes:<DataLength>/crc:<first|last>/mix:<mix>, which is
+ *   E2E_P01Check, E2E_P01MapStatusToSM and E2E_SMCheck for one message
+ * and the same for Profile 5, where the CRC position is its Offset and there is no DataIDMode.
+ *
+ * The check functions receive a ring of protected messages with one of these input mixes:
+ * - steady: consecutive counters and valid CRCs
+ * - counter_jump: the counter advances by 3 from one message to the next, beyond MaxDeltaCounter
+ * - corrupted_crc: consecutive counters and every CRC corrupted
+ *
+ * MapStatusToSM and SMCheck are fed the statuses that the check and mapping of the mix produce.
+ *
+ * Where the kernel allows it, every result also has the hardware counters of PerfCounters.h,
+ * per byte of DataLength for the protect, check and receive benchmarks and per call otherwise.
+ *
+ * For machine-readable results use --benchmark_format=json or --benchmark_out=<file>
+ * --benchmark_out_format=json, or build the run_e2e_bench target.
+ */
+
+namespace {
+    E2E_SMConfigType makeSMConfig() {
+        E2E_SMConfigType config;
+        config.WindowSizeValid = 10;
+        config.MinOkStateInit = 2;
+        config.MaxErrorStateInit = 1;
+        config.MinOkStateValid = 3;
+        config.MaxErrorStateValid = 2;
+        config.MinOkStateInvalid = 3;
+        config.MaxErrorStateInvalid = 1;
+        config.WindowSizeInit = 5;
+        config.WindowSizeInvalid = 10;
+        config.ClearToInvalid = false;
+        return config;
+    }
+
+    const E2E_SMConfigType smConfig = makeSMConfig();
+
+    /**
+     * State machine state with its ProfileStatusWindow
+     */
+    struct SMState {
+        SMState() : window(smConfig.WindowSizeValid) {
+            state.ProfileStatusWindow = window.data();
+            E2E_SMCheckInit(&state, &smConfig);
+        }
+
+        std::vector<uint8_t> window;
+        E2E_SMCheckStateType state;
+    };
+
+    std::string crcPosition(bool crcLast) {
+        return crcLast ? "/crc:last" : "/crc:first";
+    }
+
+    // -------------------------------------------------------------------------------------------
+    // Profile 1
+    // -------------------------------------------------------------------------------------------
+
+    const std::pair<E2E_P01DataIDMode, const char*> p01DataIDModes[] = {
+        {E2E_P01_DATAID_BOTH, "both"},
+        {E2E_P01_DATAID_ALT, "alt"},
+        {E2E_P01_DATAID_LOW, "low"},
+        {E2E_P01_DATAID_NIBBLE, "nibble"},
+    };
+
+    const size_t p01Lengths[] = {2, 8, 32};
+
+    struct P01CheckResult {
+        Std_ReturnType checkReturn;
+        E2E_P01CheckStatusType status;
+    };
+
+    /**
+     * Check results of one pass over the ring after a first pass that leaves the initial state
+     */
+    std::vector<P01CheckResult> p01CheckResults(const InputMix& mix) {
+        const E2E_P01ConfigType config = p01Config(E2E_P01_DATAID_BOTH, 8, false);
+        MessageRing ring = p01Messages(config, mix);
+        std::vector<P01CheckResult> results;
+        E2E_P01CheckStateType state;
+
+        E2E_P01CheckInit(&state);
+        for (size_t index = 0; index < 2 * ring.count(); ++index) {
+            const Std_ReturnType checkReturn = E2E_P01Check(&config, &state, ring.message(index % ring.count()));
+            if (index >= ring.count()) {
+                results.push_back({checkReturn, state.Status});
+            }
+        }
+
+        return results;
+    }
+
+    void benchmarkP01Protect(benchmark::State& benchmarkState, E2E_P01ConfigType config) {
+        std::vector<uint8_t> data(config.DataLength / 8U);
+        E2E_P01ProtectStateType state;
+
+        fillPayload(data.data(), data.size());
+        E2E_P01ProtectInit(&state);
+
+        PerfCountersScope counters(benchmarkState, data.size());
+
+        for (auto _ : benchmarkState) {
+            benchmark::DoNotOptimize(E2E_P01Protect(&config, &state, data.data()));
+            benchmark::ClobberMemory();
+        }
+
+        benchmarkState.SetItemsProcessed(static_cast<int64_t>(benchmarkState.iterations()));
+    }
+
+    void benchmarkP01Check(benchmark::State& benchmarkState, E2E_P01ConfigType config, InputMix mix) {
+        MessageRing ring = p01Messages(config, mix);
+        E2E_P01CheckStateType state;
+        size_t index = 0;
+
+        E2E_P01CheckInit(&state);
+
+        PerfCountersScope counters(benchmarkState, ring.length());
+
+        for (auto _ : benchmarkState) {
+            benchmark::DoNotOptimize(E2E_P01Check(&config, &state, ring.message(index)));
+            index = (index + 1U == ring.count()) ? 0U : index + 1U;
+        }
+
+        benchmarkState.SetItemsProcessed(static_cast<int64_t>(benchmarkState.iterations()));
+    }
+
+    void benchmarkP01MapStatusToSM(benchmark::State& benchmarkState, InputMix mix, bool profileBehavior) {
+        const std::vector<P01CheckResult> results = p01CheckResults(mix);
+        size_t index = 0;
+
+        PerfCountersScope counters(benchmarkState, 0);
+
+        for (auto _ : benchmarkState) {
+            const P01CheckResult& result = results[index];
+            benchmark::DoNotOptimize(E2E_P01MapStatusToSM(result.checkReturn, result.status, profileBehavior));
+            index = (index + 1U == results.size()) ? 0U : index + 1U;
+        }
+
+        benchmarkState.SetItemsProcessed(static_cast<int64_t>(benchmarkState.iterations()));
+    }
+
+    void benchmarkP01SMCheck(benchmark::State& benchmarkState, InputMix mix) {
+        std::vector<E2E_PCheckStatusType> profileStatuses;
+        SMState sm;
+        size_t index = 0;
+
+        for (const P01CheckResult& result : p01CheckResults(mix)) {
+            profileStatuses.push_back(E2E_P01MapStatusToSM(result.checkReturn, result.status, true));
+        }
+
+        PerfCountersScope counters(benchmarkState, 0);
+
+        for (auto _ : benchmarkState) {
+            benchmark::DoNotOptimize(E2E_SMCheck(profileStatuses[index], &smConfig, &sm.state));
+            index = (index + 1U == profileStatuses.size()) ? 0U : index + 1U;
+        }
+
+        benchmarkState.SetItemsProcessed(static_cast<int64_t>(benchmarkState.iterations()));
+    }
+
+    void benchmarkP01Receive(benchmark::State& benchmarkState, E2E_P01ConfigType config, InputMix mix) {
+        MessageRing ring = p01Messages(config, mix);
+        E2E_P01CheckStateType state;
+        SMState sm;
+        size_t index = 0;
+
+        E2E_P01CheckInit(&state);
+
+        PerfCountersScope counters(benchmarkState, ring.length());
+
+        for (auto _ : benchmarkState) {
+            const Std_ReturnType checkReturn = E2E_P01Check(&config, &state, ring.message(index));
+            const E2E_PCheckStatusType profileStatus = E2E_P01MapStatusToSM(checkReturn, state.Status, true);
+            benchmark::DoNotOptimize(E2E_SMCheck(profileStatus, &smConfig, &sm.state));
+            index = (index + 1U == ring.count()) ? 0U : index + 1U;
+        }
+
+        benchmarkState.SetItemsProcessed(static_cast<int64_t>(benchmarkState.iterations()));
+    }
+
+    void registerP01() {
+        for (const auto& dataIDMode : p01DataIDModes) {
+            for (const size_t length : p01Lengths) {
+                for (const bool crcLast : {false, true}) {
+                    const E2E_P01ConfigType config = p01Config(dataIDMode.first, length, crcLast);
+                    const std::string name = std::string("/") + dataIDMode.second + "/bytes:" + std::to_string(length) +
+                                             crcPosition(crcLast);
+
+                    benchmark::RegisterBenchmark(("E2E_P01Protect" + name).c_str(), benchmarkP01Protect, config);
+                    for (const InputMix& mix : inputMixes) {
+                        const std::string mixName = name + "/mix:" + mix.name;
+                        benchmark::RegisterBenchmark(("E2E_P01Check" + mixName).c_str(), benchmarkP01Check, config, mix);
+                        benchmark::RegisterBenchmark(("E2E_P01Receive" + mixName).c_str(), benchmarkP01Receive, config,
+                                                     mix);
+                    }
+                }
+            }
+        }
+
+        for (const InputMix& mix : inputMixes) {
+            const std::string mixName = std::string("/mix:") + mix.name;
+            benchmark::RegisterBenchmark(("E2E_P01MapStatusToSM/profile" + mixName).c_str(), benchmarkP01MapStatusToSM,
+                                         mix, true);
+            benchmark::RegisterBenchmark(("E2E_P01MapStatusToSM/legacy" + mixName).c_str(), benchmarkP01MapStatusToSM,
+                                         mix, false);
+            benchmark::RegisterBenchmark(("E2E_P01SMCheck" + mixName).c_str(), benchmarkP01SMCheck, mix);
+        }
+    }
+
+    // -------------------------------------------------------------------------------------------
+    // Profile 5
+    // -------------------------------------------------------------------------------------------
+
+    const size_t p05Lengths[] = {3, 8, 64, 512, 4096};
+
+    struct P05CheckResult {
+        Std_ReturnType checkReturn;
+        E2E_P05CheckStatusType status;
+    };
+
+    /**
+     * Check results of one pass over the ring after a first pass that leaves the initial state
+     */
+    std::vector<P05CheckResult> p05CheckResults(const InputMix& mix) {
+        const E2E_P05ConfigType config = p05Config(8, false);
+        MessageRing ring = p05Messages(config, mix);
+        std::vector<P05CheckResult> results;
+        E2E_P05CheckStateType state;
+
+        E2E_P05CheckInit(&state);
+        for (size_t index = 0; index < 2 * ring.count(); ++index) {
+            const Std_ReturnType checkReturn = E2E_P05Check(&config, &state, ring.message(index % ring.count()),
+                                                            static_cast<uint16_t>(ring.length()));
+            if (index >= ring.count()) {
+                results.push_back({checkReturn, state.Status});
+            }
+        }
+
+        return results;
+    }
+
+    void benchmarkP05Protect(benchmark::State& benchmarkState, E2E_P05ConfigType config) {
+        std::vector<uint8_t> data(config.DataLength / 8U);
+        const uint16_t length = static_cast<uint16_t>(data.size());
+        E2E_P05ProtectStateType state;
+
+        fillPayload(data.data(), data.size());
+        E2E_P05ProtectInit(&state);
+
+        PerfCountersScope counters(benchmarkState, data.size());
+
+        for (auto _ : benchmarkState) {
+            benchmark::DoNotOptimize(E2E_P05Protect(&config, &state, data.data(), length));
+            benchmark::ClobberMemory();
+        }
+
+        benchmarkState.SetItemsProcessed(static_cast<int64_t>(benchmarkState.iterations()));
+    }
+
+    void benchmarkP05Check(benchmark::State& benchmarkState, E2E_P05ConfigType config, InputMix mix) {
+        MessageRing ring = p05Messages(config, mix);
+        const uint16_t length = static_cast<uint16_t>(ring.length());
+        E2E_P05CheckStateType state;
+        size_t index = 0;
+
+        E2E_P05CheckInit(&state);
+
+        PerfCountersScope counters(benchmarkState, ring.length());
+
+        for (auto _ : benchmarkState) {
+            benchmark::DoNotOptimize(E2E_P05Check(&config, &state, ring.message(index), length));
+            index = (index + 1U == ring.count()) ? 0U : index + 1U;
+        }
+
+        benchmarkState.SetItemsProcessed(static_cast<int64_t>(benchmarkState.iterations()));
+    }
+
+    void benchmarkP05MapStatusToSM(benchmark::State& benchmarkState, InputMix mix) {
+        const std::vector<P05CheckResult> results = p05CheckResults(mix);
+        size_t index = 0;
+
+        PerfCountersScope counters(benchmarkState, 0);
+
+        for (auto _ : benchmarkState) {
+            const P05CheckResult& result = results[index];
+            benchmark::DoNotOptimize(E2E_P05MapStatusToSM(result.checkReturn, result.status));
+            index = (index + 1U == results.size()) ? 0U : index + 1U;
+        }
+
+        benchmarkState.SetItemsProcessed(static_cast<int64_t>(benchmarkState.iterations()));
+    }
+
+    void benchmarkP05SMCheck(benchmark::State& benchmarkState, InputMix mix) {
+        std::vector<E2E_PCheckStatusType> profileStatuses;
+        SMState sm;
+        size_t index = 0;
+
+        for (const P05CheckResult& result : p05CheckResults(mix)) {
+            profileStatuses.push_back(E2E_P05MapStatusToSM(result.checkReturn, result.status));
+        }
+
+        PerfCountersScope counters(benchmarkState, 0);
+
+        for (auto _ : benchmarkState) {
+            benchmark::DoNotOptimize(E2E_SMCheck(profileStatuses[index], &smConfig, &sm.state));
+            index = (index + 1U == profileStatuses.size()) ? 0U : index + 1U;
+        }
+
+        benchmarkState.SetItemsProcessed(static_cast<int64_t>(benchmarkState.iterations()));
+    }
+
+    void benchmarkP05Receive(benchmark::State& benchmarkState, E2E_P05ConfigType config, InputMix mix) {
+        MessageRing ring = p05Messages(config, mix);
+        const uint16_t length = static_cast<uint16_t>(ring.length());
+        E2E_P05CheckStateType state;
+        SMState sm;
+        size_t index = 0;
+
+        E2E_P05CheckInit(&state);
+
+        PerfCountersScope counters(benchmarkState, ring.length());
+
+        for (auto _ : benchmarkState) {
+            const Std_ReturnType checkReturn = E2E_P05Check(&config, &state, ring.message(index), length);
+            const E2E_PCheckStatusType profileStatus = E2E_P05MapStatusToSM(checkReturn, state.Status);
+            benchmark::DoNotOptimize(E2E_SMCheck(profileStatus, &smConfig, &sm.state));
+            index = (index + 1U == ring.count()) ? 0U : index + 1U;
+        }
+
+        benchmarkState.SetItemsProcessed(static_cast<int64_t>(benchmarkState.iterations()));
+    }
+
+    void registerP05() {
+        for (const size_t length : p05Lengths) {
+            for (const bool crcLast : {false, true}) {
+                const E2E_P05ConfigType config = p05Config(length, crcLast);
+                const std::string name = "/bytes:" + std::to_string(length) + crcPosition(crcLast);
+
+                benchmark::RegisterBenchmark(("E2E_P05Protect" + name).c_str(), benchmarkP05Protect, config);
+                for (const InputMix& mix : inputMixes) {
+                    const std::string mixName = name + "/mix:" + mix.name;
+                    benchmark::RegisterBenchmark(("E2E_P05Check" + mixName).c_str(), benchmarkP05Check, config, mix);
+                    benchmark::RegisterBenchmark(("E2E_P05Receive" + mixName).c_str(), benchmarkP05Receive, config, mix);
+                }
+            }
+        }
+
+        for (const InputMix& mix : inputMixes) {
+            const std::string mixName = std::string("/mix:") + mix.name;
+            benchmark::RegisterBenchmark(("E2E_P05MapStatusToSM" + mixName).c_str(), benchmarkP05MapStatusToSM, mix);
+            benchmark::RegisterBenchmark(("E2E_P05SMCheck" + mixName).c_str(), benchmarkP05SMCheck, mix);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    registerP01();
+    registerP05();
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include "E2EBenchMessages.h"
+
+#include <algorithm>
+
+const InputMix inputMixes[3] = {
+    {"steady", 1, false},
+    {"counter_jump", 3, false},
+    {"corrupted_crc", 1, true},
+};
+
+void fillPayload(uint8_t* data, size_t length) {
+    for (size_t byte = 0; byte < length; ++byte) {
+        data[byte] = static_cast<uint8_t>(byte * 7U + 3U);
+    }
+}
+
+E2E_P01ConfigType p01Config(E2E_P01DataIDMode dataIDMode, size_t length, bool crcLast) {
+    const uint16_t crcOffset = crcLast ? static_cast<uint16_t>((length - 1U) * 8U) : 0U;
+    const uint16_t counterOffset = crcLast ? 0U : 8U;
+
+    E2E_P01ConfigType config;
+    config.CounterOffset = counterOffset;
+    config.CRCOffset = crcOffset;
+    config.DataID = 0x0123;
+    config.DataIDNibbleOffset = (dataIDMode == E2E_P01_DATAID_NIBBLE) ? static_cast<uint16_t>(counterOffset + 4U)
+                                                                       : 0U;
+    config.DataIDMode = dataIDMode;
+    config.DataLength = static_cast<uint16_t>(length * 8U);
+    config.MaxDeltaCounterInit = 1;
+    config.MaxNoNewOrRepeatedData = 14;
+    config.SyncCounterInit = 0;
+    return config;
+}
+
+MessageRing p01Messages(const E2E_P01ConfigType& config, const InputMix& mix) {
+    MessageRing ring(config.DataLength / 8U, 15);
+    std::vector<uint8_t> message(ring.length());
+    E2E_P01ProtectStateType state;
+
+    fillPayload(message.data(), message.size());
+    E2E_P01ProtectInit(&state);
+
+    for (size_t index = 0; index < ring.count(); ++index) {
+        for (uint8_t step = 0; step < mix.counterStep; ++step) {
+            E2E_P01Protect(&config, &state, message.data());
+        }
+
+        std::copy(message.begin(), message.end(), ring.message(index));
+        if (mix.corruptCrc) {
+            ring.message(index)[config.CRCOffset / 8U] ^= 0x55;
+        }
+    }
+
+    return ring;
+}
+
+E2E_P05ConfigType p05Config(size_t length, bool crcLast) {
+    E2E_P05ConfigType config;
+    config.Offset = crcLast ? static_cast<uint16_t>((length - 3U) * 8U) : 0U;
+    config.DataLength = static_cast<uint16_t>(length * 8U);
+    config.DataID = 0x1234;
+    config.MaxDeltaCounter = 1;
+    return config;
+}
+
+MessageRing p05Messages(const E2E_P05ConfigType& config, const InputMix& mix) {
+    MessageRing ring(config.DataLength / 8U, 256);
+    std::vector<uint8_t> message(ring.length());
+    const uint16_t length = static_cast<uint16_t>(ring.length());
+    E2E_P05ProtectStateType state;
+
+    fillPayload(message.data(), message.size());
+    E2E_P05ProtectInit(&state);
+
+    for (size_t index = 0; index < ring.count(); ++index) {
+        for (uint8_t step = 0; step < mix.counterStep; ++step) {
+            E2E_P05Protect(&config, &state, message.data(), length);
+        }
+
+        std::copy(message.begin(), message.end(), ring.message(index));
+        if (mix.corruptCrc) {
+            ring.message(index)[config.Offset / 8U] ^= 0x55;
+        }
+    }
+
+    return ring;
+}
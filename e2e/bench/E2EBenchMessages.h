@@ -0,0 +1,76 @@
+#ifndef E2E_BENCH_MESSAGES_H__
+#define E2E_BENCH_MESSAGES_H__
+
+extern "C" {
+    #include "E2E_P01.h"
+    #include "E2E_P05.h"
+}
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Configurations and protected input messages shared by e2e_bench and e2e_latency
+ */
+
+struct InputMix {
+    const char* name;
+
+    /**
+     * Counter increment from one message to the next
+     */
+    uint8_t counterStep;
+
+    bool corruptCrc;
+};
+
+/**
+ * steady, counter_jump and corrupted_crc, see E2EBench.cpp
+ */
+extern const InputMix inputMixes[3];
+
+/**
+ * Protected messages of equal length that are received in turn. The number of messages is
+ * a multiple of the counter range, so the counters continue when the ring wraps around.
+ */
+class MessageRing {
+public:
+    MessageRing(size_t length, size_t count) : length_(length), count_(count), data_(length * count) {}
+
+    size_t length() const {
+        return length_;
+    }
+
+    size_t count() const {
+        return count_;
+    }
+
+    uint8_t* message(size_t index) {
+        return &data_[index * length_];
+    }
+
+private:
+    size_t length_;
+    size_t count_;
+    std::vector<uint8_t> data_;
+};
+
+void fillPayload(uint8_t* data, size_t length);
+
+/**
+ * The counter and the DataID nibble share the byte after the CRC, or the first byte if the
+ * CRC is the last byte.
+ */
+E2E_P01ConfigType p01Config(E2E_P01DataIDMode dataIDMode, size_t length, bool crcLast);
+
+MessageRing p01Messages(const E2E_P01ConfigType& config, const InputMix& mix);
+
+/**
+ * The CRC and counter are at the start of the data or in its last three bytes
+ */
+E2E_P05ConfigType p05Config(size_t length, bool crcLast);
+
+MessageRing p05Messages(const E2E_P05ConfigType& config, const InputMix& mix);
+
+#endif  // E2E_BENCH_MESSAGES_H__
@@ -0,0 +1,522 @@
+extern "C" {
+    #include "E2E_P01.h"
+    #include "E2E_P05.h"
+}
+
+#include "E2EBenchMessages.h"
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define E2E_LATENCY_TSC 1
+#include <x86intrin.h>
+#else
+#define E2E_LATENCY_TSC 0
+#endif
+
+#if E2E_LATENCY_TSC && defined(__linux__)
+#define E2E_LATENCY_FLUSH 1
+#include <link.h>
+#else
+#define E2E_LATENCY_FLUSH 0
+#endif
+
+/**
+ * Latency distribution of single E2E_P01Protect, E2E_P01Check, E2E_P05Protect and E2E_P05Check
+ * calls, for sizing real-time receive loops by their tail latency instead of their throughput.
+ * There is one executable per CRC implementation, e2e_latency_<implementation>, with the e2e
+ * library on top of crc_<implementation>_optimized.
+ *
+ * Every call is timed with the time stamp counter (steady_clock where there is none) and the
+ * time is recorded in a histogram with about 3% resolution, from which p50, p90, p99, p99.9 and
+ * the maximum are reported in nanoseconds. The timer case is an empty call, i.e. the overhead
+ * of the measurement that is included in the other cases.
+ *
+ * Before each call the caches can be evicted, so that the call finds the CRC tables, its code,
+ * its state and the message cold:
+ * - none: no eviction, after 1000 untimed calls
+ * - flush: CLFLUSH of the loaded segments of the executable, which contain the e2e and CRC code
+ *   and tables, and of the message and state of the call (x86 Linux, else sweep, which is then
+ *   the eviction reported)
+ * - sweep: a read-modify-write pass over --evict_bytes of memory, which also evicts the TLB and
+ *   should be larger than the last level cache
+ *
+ * Usage: e2e_latency_<implementation> [--iterations=<calls>] [--evict=none|flush|sweep]
+ *                                     [--evict_bytes=<bytes>[K|M]] [--json=<file>]
+ *
+ * The run_e2e_latency target runs every implementation without eviction and with flush.
+ */
+
+namespace {
+    struct Region {
+        const void* address;
+        size_t length;
+    };
+
+    enum class EvictMode { None, Flush, Sweep };
+
+    struct Options {
+        size_t iterations = 100000;
+        EvictMode evict = EvictMode::None;
+        size_t evictBytes = 64U << 20;
+        std::string json;
+    };
+
+    /**
+     * Histogram of timer ticks. Values below 64 have a bucket each, larger values 32 buckets
+     * per power of two.
+     */
+    class LatencyHistogram {
+    public:
+        LatencyHistogram() : buckets_(bucketCount, 0), count_(0), max_(0) {}
+
+        void record(uint64_t value) {
+            ++buckets_[bucketIndex(value)];
+            ++count_;
+            max_ = (value > max_) ? value : max_;
+        }
+
+        /**
+         * @return The upper bound of the bucket holding the value at the fraction of the sorted
+         *         values, at most the maximum
+         */
+        uint64_t percentile(double fraction) const {
+            uint64_t rank = static_cast<uint64_t>(fraction * static_cast<double>(count_) + 0.999999);
+            uint64_t seen = 0;
+
+            rank = (rank == 0) ? 1 : rank;
+            for (size_t index = 0; index < bucketCount; ++index) {
+                seen += buckets_[index];
+                if (seen >= rank) {
+                    const uint64_t upper = bucketUpperBound(index);
+                    return (upper < max_) ? upper : max_;
+                }
+            }
+            return max_;
+        }
+
+        uint64_t max() const {
+            return max_;
+        }
+
+    private:
+        static constexpr unsigned exactBits = 6;
+        static constexpr unsigned subBucketBits = 5;
+        static constexpr size_t bucketCount = (1U << exactBits) + (64 - exactBits) * (1U << subBucketBits);
+
+        static size_t bucketIndex(uint64_t value) {
+            if (value < (1U << exactBits)) {
+                return static_cast<size_t>(value);
+            }
+
+            const unsigned exponent = 63U - static_cast<unsigned>(__builtin_clzll(value));
+            const uint64_t mantissa = (value >> (exponent - subBucketBits)) & ((1U << subBucketBits) - 1U);
+            return (1U << exactBits) + (exponent - exactBits) * (1U << subBucketBits) + static_cast<size_t>(mantissa);
+        }
+
+        static uint64_t bucketUpperBound(size_t index) {
+            if (index < (1U << exactBits)) {
+                return index;
+            }
+
+            const size_t offset = index - (1U << exactBits);
+            const unsigned exponent = exactBits + static_cast<unsigned>(offset >> subBucketBits);
+            const uint64_t mantissa = offset & ((1U << subBucketBits) - 1U);
+            const unsigned shift = exponent - subBucketBits;
+            return (((1ULL << subBucketBits) + mantissa + 1U) << shift) - 1U;
+        }
+
+        std::vector<uint64_t> buckets_;
+        uint64_t count_;
+        uint64_t max_;
+    };
+
+    inline uint64_t readTimer() {
+#if E2E_LATENCY_TSC
+        _mm_lfence();
+        const uint64_t ticks = __rdtsc();
+        _mm_lfence();
+        return ticks;
+#else
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+#endif
+    }
+
+    double ticksPerNanosecond() {
+#if E2E_LATENCY_TSC
+        const auto start = std::chrono::steady_clock::now();
+        const uint64_t startTicks = readTimer();
+        auto now = start;
+
+        while ((now - start) < std::chrono::milliseconds(100)) {
+            now = std::chrono::steady_clock::now();
+        }
+
+        const uint64_t ticks = readTimer() - startTicks;
+        return static_cast<double>(ticks) /
+               static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - start).count());
+#else
+        return 1.0;
+#endif
+    }
+
+    class Evictor {
+    public:
+        explicit Evictor(const Options& options) : mode_(options.evict) {
+#if !E2E_LATENCY_FLUSH
+            mode_ = (mode_ == EvictMode::Flush) ? EvictMode::Sweep : mode_;
+#else
+            if (mode_ == EvictMode::Flush) {
+                dl_iterate_phdr(addExecutableSegments, &segments_);
+            }
+#endif
+            if (mode_ == EvictMode::Sweep) {
+                sweep_.resize(options.evictBytes, 1);
+            }
+        }
+
+        /**
+         * The eviction that is done, which is sweep where flush is not supported
+         */
+        EvictMode mode() const {
+            return mode_;
+        }
+
+        bool evicting() const {
+            return mode_ != EvictMode::None;
+        }
+
+        template <size_t Count>
+        void evict(const std::array<Region, Count>& regions) {
+            if (mode_ == EvictMode::Flush) {
+                for (const Region& segment : segments_) {
+                    flush(segment);
+                }
+                for (const Region& region : regions) {
+                    flush(region);
+                }
+#if E2E_LATENCY_FLUSH
+                _mm_mfence();
+#endif
+            } else if (mode_ == EvictMode::Sweep) {
+                for (size_t byte = 0; byte < sweep_.size(); byte += cacheLineLength) {
+                    sweep_[byte] = static_cast<uint8_t>(sweep_[byte] + 1U);
+                }
+            }
+        }
+
+    private:
+        static constexpr size_t cacheLineLength = 64;
+
+        static void flush(const Region& region) {
+#if E2E_LATENCY_FLUSH
+            const uintptr_t address = reinterpret_cast<uintptr_t>(region.address);
+            const uintptr_t end = address + region.length;
+            const uintptr_t start = address & ~static_cast<uintptr_t>(cacheLineLength - 1U);
+
+            for (uintptr_t line = start; line < end; line += cacheLineLength) {
+                _mm_clflush(reinterpret_cast<const void*>(line));
+            }
+#else
+            (void)region;
+#endif
+        }
+
+#if E2E_LATENCY_FLUSH
+        /**
+         * The first object is the executable, which has the e2e and CRC libraries linked in
+         */
+        static int addExecutableSegments(struct dl_phdr_info* info, size_t, void* data) {
+            std::vector<Region>* segments = static_cast<std::vector<Region>*>(data);
+
+            for (ElfW(Half) index = 0; index < info->dlpi_phnum; ++index) {
+                const ElfW(Phdr)& header = info->dlpi_phdr[index];
+                if (header.p_type == PT_LOAD) {
+                    segments->push_back({reinterpret_cast<const void*>(info->dlpi_addr + header.p_vaddr),
+                                         static_cast<size_t>(header.p_memsz)});
+                }
+            }
+            return 1;
+        }
+#endif
+
+        EvictMode mode_;
+        std::vector<Region> segments_;
+        std::vector<uint8_t> sweep_;
+    };
+
+    struct Result {
+        std::string name;
+        double p50;
+        double p90;
+        double p99;
+        double p999;
+        double max;
+    };
+
+    class LatencyRun {
+    public:
+        LatencyRun(const Options& options) : options_(options), evictor_(options), ticksPerNs_(ticksPerNanosecond()) {}
+
+        double ticksPerNs() const {
+            return ticksPerNs_;
+        }
+
+        EvictMode evictMode() const {
+            return evictor_.mode();
+        }
+
+        const std::vector<Result>& results() const {
+            return results_;
+        }
+
+        /**
+         * Times call() options.iterations times, each after evicting the caches and the regions
+         * returned by regions(), which are the data call() is about to use
+         */
+        template <typename Regions, typename Call>
+        void measure(const std::string& name, Regions regions, Call call) {
+            LatencyHistogram histogram;
+
+            if (!evictor_.evicting()) {
+                for (size_t iteration = 0; iteration < warmupIterations; ++iteration) {
+                    call();
+                }
+            }
+
+            for (size_t iteration = 0; iteration < options_.iterations; ++iteration) {
+                evictor_.evict(regions());
+
+                const uint64_t start = readTimer();
+                call();
+                const uint64_t end = readTimer();
+
+                histogram.record(end - start);
+            }
+
+            results_.push_back({name, nanoseconds(histogram.percentile(0.5)), nanoseconds(histogram.percentile(0.9)),
+                                nanoseconds(histogram.percentile(0.99)), nanoseconds(histogram.percentile(0.999)),
+                                nanoseconds(histogram.max())});
+        }
+
+    private:
+        static constexpr size_t warmupIterations = 1000;
+
+        double nanoseconds(uint64_t ticks) const {
+            return static_cast<double>(ticks) / ticksPerNs_;
+        }
+
+        const Options& options_;
+        Evictor evictor_;
+        double ticksPerNs_;
+        std::vector<Result> results_;
+    };
+
+    volatile Std_ReturnType sink;
+
+    void measureP01(LatencyRun& run, size_t length) {
+        const E2E_P01ConfigType config = p01Config(E2E_P01_DATAID_BOTH, length, false);
+        const std::string name = "/bytes:" + std::to_string(length);
+        std::vector<uint8_t> data(length);
+        E2E_P01ProtectStateType protectState;
+
+        fillPayload(data.data(), data.size());
+        E2E_P01ProtectInit(&protectState);
+        run.measure(
+            "E2E_P01Protect" + name,
+            [&]() {
+                return std::array<Region, 2>{{{data.data(), data.size()}, {&protectState, sizeof(protectState)}}};
+            },
+            [&]() { sink = E2E_P01Protect(&config, &protectState, data.data()); });
+
+        MessageRing ring = p01Messages(config, inputMixes[0]);
+        E2E_P01CheckStateType checkState;
+        size_t index = 0;
+
+        E2E_P01CheckInit(&checkState);
+        run.measure(
+            "E2E_P01Check" + name,
+            [&]() {
+                return std::array<Region, 2>{{{ring.message(index), ring.length()}, {&checkState, sizeof(checkState)}}};
+            },
+            [&]() {
+                sink = E2E_P01Check(&config, &checkState, ring.message(index));
+                index = (index + 1U == ring.count()) ? 0U : index + 1U;
+            });
+    }
+
+    void measureP05(LatencyRun& run, size_t length) {
+        const E2E_P05ConfigType config = p05Config(length, false);
+        const std::string name = "/bytes:" + std::to_string(length);
+        const uint16_t dataLength = static_cast<uint16_t>(length);
+        std::vector<uint8_t> data(length);
+        E2E_P05ProtectStateType protectState;
+
+        fillPayload(data.data(), data.size());
+        E2E_P05ProtectInit(&protectState);
+        run.measure(
+            "E2E_P05Protect" + name,
+            [&]() {
+                return std::array<Region, 2>{{{data.data(), data.size()}, {&protectState, sizeof(protectState)}}};
+            },
+            [&]() { sink = E2E_P05Protect(&config, &protectState, data.data(), dataLength); });
+
+        MessageRing ring = p05Messages(config, inputMixes[0]);
+        E2E_P05CheckStateType checkState;
+        size_t index = 0;
+
+        E2E_P05CheckInit(&checkState);
+        run.measure(
+            "E2E_P05Check" + name,
+            [&]() {
+                return std::array<Region, 2>{{{ring.message(index), ring.length()}, {&checkState, sizeof(checkState)}}};
+            },
+            [&]() {
+                sink = E2E_P05Check(&config, &checkState, ring.message(index), dataLength);
+                index = (index + 1U == ring.count()) ? 0U : index + 1U;
+            });
+    }
+
+    const char* evictModeName(EvictMode mode) {
+        switch (mode) {
+            case EvictMode::Flush:
+                return "flush";
+            case EvictMode::Sweep:
+                return "sweep";
+            default:
+                return "none";
+        }
+    }
+
+    bool parseSize(const char* text, size_t& size) {
+        char* end = nullptr;
+        const unsigned long long value = std::strtoull(text, &end, 10);
+
+        if ((end == text) || (value == 0)) {
+            return false;
+        }
+
+        if (std::strcmp(end, "K") == 0) {
+            size = static_cast<size_t>(value) << 10;
+        } else if (std::strcmp(end, "M") == 0) {
+            size = static_cast<size_t>(value) << 20;
+        } else if (*end == '\0') {
+            size = static_cast<size_t>(value);
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    bool parseOptions(int argc, char** argv, Options& options) {
+        for (int index = 1; index < argc; ++index) {
+            const std::string argument = argv[index];
+            const size_t separator = argument.find('=');
+            const std::string name = argument.substr(0, separator);
+            const char* value = (separator == std::string::npos) ? "" : &argv[index][separator + 1];
+
+            if (name == "--iterations") {
+                if (!parseSize(value, options.iterations)) {
+                    return false;
+                }
+            } else if (name == "--evict") {
+                if (std::strcmp(value, "none") == 0) {
+                    options.evict = EvictMode::None;
+                } else if (std::strcmp(value, "flush") == 0) {
+                    options.evict = EvictMode::Flush;
+                } else if (std::strcmp(value, "sweep") == 0) {
+                    options.evict = EvictMode::Sweep;
+                } else {
+                    return false;
+                }
+            } else if (name == "--evict_bytes") {
+                if (!parseSize(value, options.evictBytes)) {
+                    return false;
+                }
+            } else if ((name == "--json") && (*value != '\0')) {
+                options.json = value;
+            } else {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void printResults(const Options& options, const LatencyRun& run) {
+        std::printf("e2e_latency, CRC implementation %s, %zu calls per case, eviction %s", E2E_LATENCY_CRC,
+                    options.iterations, evictModeName(run.evictMode()));
+        if (run.evictMode() == EvictMode::Sweep) {
+            std::printf(" of %zu bytes", options.evictBytes);
+        }
+        std::printf(", %.3f timer ticks per ns\n", run.ticksPerNs());
+
+        std::printf("%-28s %10s %10s %10s %10s %10s\n", "Case", "p50 ns", "p90 ns", "p99 ns", "p99.9 ns", "max ns");
+        for (const Result& result : run.results()) {
+            std::printf("%-28s %10.1f %10.1f %10.1f %10.1f %10.1f\n", result.name.c_str(), result.p50, result.p90,
+                        result.p99, result.p999, result.max);
+        }
+    }
+
+    bool writeJson(const Options& options, const LatencyRun& run) {
+        FILE* file = std::fopen(options.json.c_str(), "w");
+        if (file == nullptr) {
+            std::fprintf(stderr, "e2e_latency: cannot write %s\n", options.json.c_str());
+            return false;
+        }
+
+        std::fprintf(file,
+                     "{\n  \"context\": {\"crc\": \"%s\", \"iterations\": %zu, \"evict\": \"%s\", \"evict_bytes\": %zu, "
+                     "\"ticks_per_ns\": %.6f},\n  \"results\": [\n",
+                     E2E_LATENCY_CRC, options.iterations, evictModeName(run.evictMode()),
+                     (run.evictMode() == EvictMode::Sweep) ? options.evictBytes : 0U, run.ticksPerNs());
+
+        const std::vector<Result>& results = run.results();
+        for (size_t index = 0; index < results.size(); ++index) {
+            const Result& result = results[index];
+            std::fprintf(file,
+                         "    {\"name\": \"%s\", \"p50_ns\": %.1f, \"p90_ns\": %.1f, \"p99_ns\": %.1f, "
+                         "\"p99.9_ns\": %.1f, \"max_ns\": %.1f}%s\n",
+                         result.name.c_str(), result.p50, result.p90, result.p99, result.p999, result.max,
+                         (index + 1U == results.size()) ? "" : ",");
+        }
+
+        std::fprintf(file, "  ]\n}\n");
+        return std::fclose(file) == 0;
+    }
+}
+
+int main(int argc, char** argv) {
+    Options options;
+
+    if (!parseOptions(argc, argv, options)) {
+        std::fprintf(stderr,
+                     "Usage: %s [--iterations=<calls>] [--evict=none|flush|sweep] [--evict_bytes=<bytes>[K|M]] "
+                     "[--json=<file>]\n",
+                     argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    LatencyRun run(options);
+
+    run.measure(
+        "timer", []() { return std::array<Region, 0>{}; }, []() {});
+    measureP01(run, 8);
+    for (const size_t length : {8U, 64U, 512U, 4096U}) {
+        measureP05(run, length);
+    }
+
+    printResults(options, run);
+
+    if (!options.json.empty() && !writeJson(options, run)) {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -18,21 +18,21 @@
 #include "Std_Types.h"
 
 
-const Std_ReturnType E2E_E_OK = 0x00U;
+#define E2E_E_OK 0x00U
 
 /**
  * At least one pointer parameter is a NULL pointer
  *
  * Specified in [1] 7.1.1 Development Errors, SWS_E2E_00047
  */
-const Std_ReturnType E2E_E_INPUTERR_NULL = 0x13U;
+#define E2E_E_INPUTERR_NULL 0x13U
 
 /**
  * At least one input parameter is erroneous, e.g. out of range
  *
  * Specified in [1] 7.1.1 Development Errors, SWS_E2E_00047
  */
-const Std_ReturnType E2E_E_INPUTERR_WRONG = 0x17U;
+#define E2E_E_INPUTERR_WRONG 0x17U
 
 /**
  * An internal library error has occurred (e.g. error detected by
@@ -40,14 +40,14 @@ const Std_ReturnType E2E_E_INPUTERR_WRONG = 0x17U;
  *
  * Specified in [1] 7.1.1 Development Errors, SWS_E2E_00047
  */
-const Std_ReturnType E2E_E_INTERR = 0x19U;
+#define E2E_E_INTERR 0x19U
 
 /**
  * Function executed in wrong state
  *
  * Specified in [1] 7.1.1 Development Errors, SWS_E2E_00047
  */
-const Std_ReturnType E2E_E_WRONGSTATE = 0x1AU;
+#define E2E_E_WRONGSTATE 0x1AU
 
 /**
  * Returns the version information of this module.
@@ -117,7 +117,7 @@ static uint8_t E2E_P01_getDataIdCRC(const E2E_P01ConfigType* Config,
     const uint8_t DataIDMSB = Config->DataID >> 8;
     const uint8_t DataIDLSB = Config->DataID & 0xFF;
 
-    uint8_t CRC;
+    uint8_t CRC = 0;
     switch (Config->DataIDMode) {
         case E2E_P01_DATAID_BOTH:
             CRC = Crc_CalculateCRC8(&DataIDLSB, 1, 0xFF, false);
@@ -9,28 +9,21 @@ static uint16_t ComputeCrc(const E2E_P05ConfigType* Config,
     const uint16_t Offset = Config->Offset / 8U;
     const uint16_t firstDataAfterCRCByteIndex = Offset + 2U;
 
-    uint16_t ComputedCRC = 0;
-
-    if (Config->Offset > 0) {
-        // Calculate CRC for parts before CRC position
-        ComputedCRC = Crc_CalculateCRC16(Data, Offset, 0xFFFF, true);
-
-        // Calculate CRC for parts after CRC position
-        const uint16_t dataLengthAfterCrc = Length - Offset - 2U;
-        ComputedCRC = Crc_CalculateCRC16(&Data[firstDataAfterCRCByteIndex], dataLengthAfterCrc, ComputedCRC, false);
-
-    } else {
-        // Calculate CRC over data
-
-        ComputedCRC = Crc_CalculateCRC16(&Data[firstDataAfterCRCByteIndex], (Length - 2U), 0xFFFF, true);
-    }
-
-    // Calculate CRC for DataID
-    const uint8_t dataIDLSB = Config->DataID & 0xFF;
-    const uint8_t dataIDMSB = (Config->DataID >> 8U) & 0xFF;
-
-    ComputedCRC = Crc_CalculateCRC16(&dataIDLSB, 1, ComputedCRC, false);
-    ComputedCRC = Crc_CalculateCRC16(&dataIDMSB, 1, ComputedCRC, false);
+    // DataID is appended low byte first
+    const uint8_t dataID[2] = {
+        Config->DataID & 0xFF,
+        (Config->DataID >> 8U) & 0xFF
+    };
+
+    // Calculate CRC for parts before and after CRC position and for DataID, the part
+    // before the CRC position is empty when Offset is 0
+    const Crc_SegmentType segments[3] = {
+        {Data, Offset},
+        {&Data[firstDataAfterCRCByteIndex], Length - Offset - 2U},
+        {dataID, sizeof(dataID)}
+    };
+
+    const uint16_t ComputedCRC = Crc_CalculateCRC16V(segments, 3U, 0xFFFF, true);
 
     return ComputedCRC;
 }